@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "AssbinLoader.h"
 #include "Common/assbin_chunks.h"
+#include "Material/MaterialSystem.h"
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/anim.h>
 #include <assimp/importerdesc.h>
@@ -452,16 +453,12 @@ void AssbinImporter::ReadBinaryMaterial(IOStream *stream, aiMaterial *mat) {
         throw DeadlyImportError("Magic chunk identifiers are wrong!");
     /*uint32_t size =*/Read<uint32_t>(stream);
 
-    mat->mNumAllocated = mat->mNumProperties = Read<unsigned int>(stream);
-    if (mat->mNumProperties) {
-        if (mat->mProperties) {
-            delete[] mat->mProperties;
-        }
-        mat->mProperties = new aiMaterialProperty *[mat->mNumProperties];
-        for (unsigned int i = 0; i < mat->mNumProperties; ++i) {
-            mat->mProperties[i] = new aiMaterialProperty();
-            ReadBinaryMaterialProperty(stream, mat->mProperties[i]);
-        }
+    const unsigned int numProperties = Read<unsigned int>(stream);
+    ReserveMaterialProperties(mat, numProperties);
+    for (unsigned int i = 0; i < numProperties; ++i) {
+        mat->mProperties[i] = new aiMaterialProperty();
+        mat->mNumProperties = i + 1;
+        ReadBinaryMaterialProperty(stream, mat->mProperties[i]);
     }
 }
 
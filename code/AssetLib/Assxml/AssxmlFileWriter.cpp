@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AssxmlFileWriter.h"
 
 #include "PostProcessing/ProcessHelper.h"
+#include "Common/TextStreamWriter.h"
 
 #include <assimp/version.h>
 #include <assimp/Exporter.hpp>
@@ -70,7 +71,7 @@ namespace Assimp {
 namespace AssxmlFileWriter {
 
 // -----------------------------------------------------------------------------------
-static int ioprintf(IOStream *io, const char *format, ...) {
+static int ioprintf(TextStreamWriter *io, const char *format, ...) {
     using namespace std;
     if (nullptr == io) {
         return -1;
@@ -78,14 +79,13 @@ static int ioprintf(IOStream *io, const char *format, ...) {
 
     static const int Size = 4096;
     char sz[Size];
-    ::memset(sz, '\0', Size);
     va_list va;
     va_start(va, format);
     const unsigned int nSize = vsnprintf(sz, Size - 1, format, va);
     ai_assert(nSize < Size);
     va_end(va);
 
-    io->Write(sz, sizeof(char), nSize);
+    io->Write(sz, nSize);
 
     return nSize;
 }
@@ -120,7 +120,7 @@ static void ConvertName(aiString &out, const aiString &in) {
 
 // -----------------------------------------------------------------------------------
 // Write a single node as text dump
-static void WriteNode(const aiNode *node, IOStream *io, unsigned int depth) {
+static void WriteNode(const aiNode *node, TextStreamWriter *io, unsigned int depth) {
     char prefix[512];
     for (unsigned int i = 0; i < depth; ++i)
         prefix[i] = '\t';
@@ -186,7 +186,7 @@ static std::string encodeXML(const std::string &data) {
 
 // -----------------------------------------------------------------------------------
 // Write a text model dump
-static void WriteDump(const char *pFile, const char *cmd, const aiScene *scene, IOStream *io, bool shortened) {
+static void WriteDump(const char *pFile, const char *cmd, const aiScene *scene, TextStreamWriter *io, bool shortened) {
     time_t tt = ::time(nullptr);
 #if _WIN32
     tm *p = gmtime(&tt);
@@ -649,12 +649,16 @@ static void WriteDump(const char *pFile, const char *cmd, const aiScene *scene,
 void DumpSceneToAssxml(
         const char *pFile, const char *cmd, IOSystem *pIOSystem,
         const aiScene *pScene, bool shortened) {
-    std::unique_ptr<IOStream> file(pIOSystem->Open(pFile, "wt"));
-    if (!file) {
+    ExportOutputFile file(pIOSystem, pFile, "wt");
+    if (!file.Get()) {
         throw std::runtime_error("Unable to open output file " + std::string(pFile) + '\n');
     }
 
-    AssxmlFileWriter::WriteDump(pFile, cmd, pScene, file.get(), shortened);
+    // the dump is written while it is generated
+    TextStreamWriter writer(file.Get());
+    AssxmlFileWriter::WriteDump(pFile, cmd, pScene, &writer, shortened);
+    writer.Flush();
+    file.Commit();
 }
 
 } // end of namespace Assimp
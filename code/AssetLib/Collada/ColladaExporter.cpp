@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <ctime>
 #include <memory>
+#include <sstream>
 
 namespace Assimp {
 
@@ -99,21 +100,16 @@ void ExportSceneCollada(const char *pFile, IOSystem *pIOSystem, const aiScene *p
     std::string path = DefaultIOSystem::absolutePath(std::string(pFile));
     std::string file = DefaultIOSystem::completeBaseName(std::string(pFile));
 
-    // invoke the exporter
-    ColladaExporter iDoTheExportThing(pScene, pIOSystem, path, file);
-
-    if (iDoTheExportThing.mOutput.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write result to the given IOSYstem
-    std::unique_ptr<IOStream> outfile(pIOSystem->Open(pFile, "wt"));
-    if (outfile == nullptr) {
+    // the output is written while it is generated
+    ExportOutputFile outfile(pIOSystem, pFile, "wt");
+    if (outfile.Get() == nullptr) {
         throw DeadlyExportError("could not open output .dae file: " + std::string(pFile));
     }
 
-    // XXX maybe use a small wrapper around IOStream that behaves like std::stringstream in order to avoid the extra copy.
-    outfile->Write(iDoTheExportThing.mOutput.str().c_str(), static_cast<size_t>(iDoTheExportThing.mOutput.tellp()), 1);
+    // invoke the exporter
+    ColladaExporter iDoTheExportThing(pScene, pIOSystem, path, file, outfile.Get());
+    iDoTheExportThing.mOutput.Flush();
+    outfile.Commit();
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -167,15 +163,14 @@ inline std::string MakeUniqueId(const std::unordered_set<std::string> &idSet, co
 
 // ------------------------------------------------------------------------------------------------
 // Constructor for a specific scene to export
-ColladaExporter::ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, const std::string &path, const std::string &file) :
+ColladaExporter::ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, const std::string &path, const std::string &file, IOStream *pStream) :
+        mOutput(pStream),
         mIOSystem(pIOSystem),
         mPath(path),
         mFile(file),
         mScene(pScene),
         endstr("\n") {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    mOutput.imbue(std::locale("C"));
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
+    mOutput.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
 
     // start writing the file
     WriteFile();
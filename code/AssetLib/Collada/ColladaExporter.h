@@ -47,10 +47,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/ai_assert.h>
 #include <assimp/material.h>
+#include "Common/TextStreamWriter.h"
 
 #include <array>
 #include <map>
-#include <sstream>
 #include <unordered_set>
 #include <vector>
 
@@ -68,7 +68,7 @@ class IOSystem;
 class ColladaExporter {
 public:
     /// Constructor for a specific scene to export
-    ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, const std::string &path, const std::string &file);
+    ColladaExporter(const aiScene *pScene, IOSystem *pIOSystem, const std::string &path, const std::string &file, IOStream *pStream);
 
     /// Destructor
     virtual ~ColladaExporter() = default;
@@ -182,8 +182,8 @@ private:
     std::array<IndexIdMap, static_cast<size_t>(AiObjectType::Count)> mObjectNameMap; // Cache of encoded names
 
 public:
-    /// Stringstream to write all output into
-    std::stringstream mOutput;
+    /// Buffered writer the output goes to while it is generated
+    TextStreamWriter mOutput;
 
     /// The IOSystem for output
     IOSystem *mIOSystem;
@@ -449,8 +449,11 @@ ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
         }
     }
 
-    // generate a XML reader for it
-    if (!mXmlParser.parse(daeFile.get())) {
+    // generate a XML reader for it, the bulk data is parsed while the document is read
+    const XmlElementHandler handler = [this](XmlPullParser &parser, XmlNode &node) {
+        ReadBulkData(parser, node);
+    };
+    if (!mXmlParser.parseStreaming(daeFile.get(), handler)) {
         throw DeadlyImportError("Unable to read file, malformed XML");
     }
     // start reading
@@ -1442,6 +1445,47 @@ void ColladaParser::ReadSource(XmlNode &node) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Parses the contents of the bulk elements while the document is streamed
+void ColladaParser::ReadBulkData(XmlPullParser &parser, XmlNode &node) {
+    const std::string &name = parser.getName();
+    const char *content = nullptr;
+    const char *end = nullptr;
+    if (name == "float_array") {
+        std::vector<ai_real> &values = mBulkValues[node.internal_object()];
+        while (parser.readTextBlock(content, end)) {
+            // every value takes at least two characters including the separator
+            size_t parsed = 0;
+            const size_t first = values.size();
+            values.resize(first + static_cast<size_t>(end - content) / 2 + 1);
+            content = fast_atoreal_batch<ai_real>(content, end, values.data() + first, values.size() - first, parsed);
+            values.resize(first + parsed);
+            SkipSpacesAndLineEnd(&content, end);
+
+            // the values the batch parser left over
+            while (content != end) {
+                ai_real value;
+                content = fast_atoreal_move<ai_real>(content, value);
+                values.push_back(value);
+                SkipSpacesAndLineEnd(&content, end);
+            }
+        }
+    } else if ((name == "p" && std::strcmp(node.parent().name(), "ph") != 0) || (name == "vcount" && std::strcmp(node.parent().name(), "polylist") == 0)) {
+        std::vector<size_t> &indices = mBulkIndices[node.internal_object()];
+        while (parser.readTextBlock(content, end)) {
+            SkipSpacesAndLineEnd(&content, end);
+            while (content != end) {
+                // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
+                const char *next = content;
+                indices.push_back(size_t(std::max(0, strtol10(content, &next))));
+                // skip anything which is not a number
+                content = next != content ? next : content + 1;
+                SkipSpacesAndLineEnd(&content, end);
+            }
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads a data array holding a number of floats, and stores it in the global library
 void ColladaParser::ReadDataArray(XmlNode &node) {
@@ -1464,6 +1508,18 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
     Data &data = mDataLibrary[id];
     data.mIsStringArray = isStringArray;
 
+    // the values were parsed while the document was read
+    const auto bulk = mBulkValues.find(node.internal_object());
+    if (!isStringArray && bulk != mBulkValues.end()) {
+        if (bulk->second.size() < count) {
+            throw DeadlyImportError("Expected more values while reading float_array contents.");
+        }
+        data.mValues = std::move(bulk->second);
+        data.mValues.resize(count);
+        mBulkValues.erase(bulk);
+        return;
+    }
+
     // some exporters write empty data arrays, but we need to conserve them anyways because others might reference them
     if (content) {
         if (isStringArray) {
@@ -1485,9 +1541,14 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
                 SkipSpacesAndLineEnd(&content, end);
             }
         } else {
-            data.mValues.reserve(count);
+            // parse the bulk of the values in one go, leave errors to the loop below
+            size_t parsed = 0;
+            data.mValues.resize(count);
+            content = fast_atoreal_batch<ai_real>(content, end, data.mValues.data(), count, parsed);
+            data.mValues.resize(parsed);
+            SkipSpacesAndLineEnd(&content, end);
 
-            for (unsigned int a = 0; a < count; a++) {
+            for (unsigned int a = static_cast<unsigned int>(parsed); a < count; a++) {
                 if (*content == 0) {
                     throw DeadlyImportError("Expected more values while reading float_array contents.");
                 }
@@ -1659,6 +1720,17 @@ void ColladaParser::ReadIndexData(XmlNode &node, Mesh &pMesh) {
                 if (numPrimitives) // It is possible to define a mesh without any primitives
                 {
                     // case <polylist> - specifies the number of indices for each polygon
+                    const auto bulk = mBulkIndices.find(currentNode.internal_object());
+                    if (bulk != mBulkIndices.end()) {
+                        if (bulk->second.size() < numPrimitives) {
+                            throw DeadlyImportError("Expected more values while reading <vcount> contents.");
+                        }
+                        vcount = std::move(bulk->second);
+                        vcount.resize(numPrimitives);
+                        mBulkIndices.erase(bulk);
+                        continue;
+                    }
+
                     std::string v;
                     XmlParser::getValueAsString(currentNode, v);
                     const char *content = v.c_str();
@@ -1777,7 +1849,13 @@ size_t ColladaParser::ReadPrimitives(XmlNode &node, Mesh &pMesh, std::vector<Inp
     }
 
     // It is possible to not contain any indices
-    if (pNumPrimitives > 0) {
+    const auto bulk = mBulkIndices.find(node.internal_object());
+    if (bulk != mBulkIndices.end()) {
+        if (pNumPrimitives > 0) {
+            indices = std::move(bulk->second);
+        }
+        mBulkIndices.erase(bulk);
+    } else if (pNumPrimitives > 0) {
         std::string v;
         XmlParser::getValueAsString(node, v);
         const char *content = v.c_str();
@@ -157,6 +157,10 @@ public:
     /// Reads a mesh from the geometry library
     void ReadMesh(XmlNode &node, Collada::Mesh &pMesh);
 
+    /// Parses the contents of the bulk elements <float_array>, <p> and <vcount> while
+    /// the document is streamed, so their text is never stored in the document
+    void ReadBulkData(XmlPullParser &parser, XmlNode &node);
+
     /// Reads a source element - a combination of raw data and an accessor defining
     ///things that should not be definable. Yes, that's another rant.
     void ReadSource(XmlNode &node);
@@ -233,6 +237,10 @@ private:
     /// XML reader, member for everyday use
     XmlParser mXmlParser;
 
+    /// Values and indices of the bulk elements by node, see ReadBulkData()
+    std::map<const pugi::xml_node_struct *, std::vector<ai_real>> mBulkValues;
+    std::map<const pugi::xml_node_struct *, std::vector<size_t>> mBulkIndices;
+
     /// All data arrays found in the file by ID. Might be referred to by actually
     ///     everyone. Collada, you are a steaming pile of indirection.
     using DataLibrary = std::map<std::string, Collada::Data> ;
@@ -299,140 +299,240 @@ void ReadData(const char*& sbegin_out, const char*& send_out, const char* input,
 }
 
 
+} // anonymous namespace
+
 // ------------------------------------------------------------------------------------------------
-bool ReadScope(TokenList &output_tokens, StackAllocator &token_allocator, const char *input, const char *&cursor, const char *end, bool const is64bits) {
-    // the first word contains the offset at which this block ends
-	const uint64_t end_offset = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
-
-    // we may get 0 if reading reached the end of the file -
-    // fbx files have a mysterious extra footer which I don't know
-    // how to extract any information from, but at least it always
-    // starts with a 0.
-    if(!end_offset) {
-        return false;
-    }
+// TODO: Test FBX Binary files newer than the 7500 version to check if the 64 bits address behaviour is consistent
+BinaryTokenizer::BinaryTokenizer(const char *input, size_t length, StackAllocator &token_allocator, bool transientPunctuation) :
+        input(input),
+        end(input + length),
+        cursor(input),
+        token_allocator(token_allocator),
+        transient_punctuation(transientPunctuation),
+        version(0),
+        is64bits(false),
+        sentinel_block_length(0),
+        state(State_Scope),
+        scopes(),
+        scope_end_offset(0),
+        props_left(0),
+        props_begin(input),
+        props_end(input),
+        pending_comma(false),
+        transient(),
+        next_transient(0) {
+	ai_assert(input);
+	ASSIMP_LOG_DEBUG("Tokenizing binary FBX file");
 
-    if(end_offset > Offset(input, end)) {
-        TokenizeError("block offset is out of range",input, cursor);
-    }
-    else if(end_offset < Offset(input, cursor)) {
-        TokenizeError("block offset is negative out of range",input, cursor);
+    if(length < 0x1b) {
+        TokenizeError("file is too short",0);
     }
 
-    // the second data word contains the number of properties in the scope
-	const uint64_t prop_count = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
-
-    // the third data word contains the length of the property list
-	const uint64_t prop_length = is64bits ? ReadDoubleWord(input, cursor, end) : ReadWord(input, cursor, end);
-
-    // now comes the name of the scope/key
-    const char* sbeg, *send;
-    ReadString(sbeg, send, input, cursor, end);
-
-    output_tokens.push_back(new_Token(sbeg, send, TokenType_KEY, Offset(input, cursor) ));
-
-    // now come the individual properties
-    const char* begin_cursor = cursor;
-
-    if ((begin_cursor + prop_length) > end) {
-        TokenizeError("property length out of bounds reading length ", input, cursor);
-    }
+    //uint32_t offset = 0x15;
+/*    const char* cursor = input + 0x15;
 
-    for (unsigned int i = 0; i < prop_count; ++i) {
-        ReadData(sbeg, send, input, cursor, begin_cursor + prop_length);
+    const uint32_t flags = ReadWord(input, cursor, input + length);
 
-        output_tokens.push_back(new_Token(sbeg, send, TokenType_DATA, Offset(input, cursor) ));
+    const uint8_t padding_0 = ReadByte(input, cursor, input + length); // unused
+    const uint8_t padding_1 = ReadByte(input, cursor, input + length); // unused*/
 
-        if(i != prop_count-1) {
-            output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_COMMA, Offset(input, cursor) ));
-        }
+    if (strncmp(input,"Kaydara FBX Binary",18)) {
+        TokenizeError("magic bytes not found",0);
     }
 
-    if (Offset(begin_cursor, cursor) != prop_length) {
-        TokenizeError("property length not reached, something is wrong",input, cursor);
-    }
+    cursor = input + 18;
+	/*Result ignored*/ ReadByte(input, cursor, end);
+	/*Result ignored*/ ReadByte(input, cursor, end);
+	/*Result ignored*/ ReadByte(input, cursor, end);
+	/*Result ignored*/ ReadByte(input, cursor, end);
+	/*Result ignored*/ ReadByte(input, cursor, end);
+	version = ReadWord(input, cursor, end);
+	ASSIMP_LOG_DEBUG("FBX version: ", version);
+	is64bits = version >= 7500;
 
     // at the end of each nested block, there is a NUL record to indicate
     // that the sub-scope exists (i.e. to distinguish between P: and P : {})
     // this NUL record is 13 bytes long on 32 bit version and 25 bytes long on 64 bit.
-	const size_t sentinel_block_length = is64bits ? (sizeof(uint64_t)* 3 + 1) : (sizeof(uint32_t)* 3 + 1);
+	sentinel_block_length = is64bits ? (sizeof(uint64_t)* 3 + 1) : (sizeof(uint32_t)* 3 + 1);
+}
 
-    if (Offset(input, cursor) < end_offset) {
-        if (end_offset - Offset(input, cursor) < sentinel_block_length) {
-            TokenizeError("insufficient padding bytes at block end",input, cursor);
+// ------------------------------------------------------------------------------------------------
+BinaryTokenizer::~BinaryTokenizer() {
+    for (Token *token : transient) {
+        if (token) {
+            token->~Token();
         }
+    }
+#ifdef DEBUG
+    for (TokenPtr token : persistent_tokens) {
+        delete_Token(token);
+    }
+#endif
+}
 
-        output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_OPEN_BRACKET, Offset(input, cursor) ));
-
-        // XXX this is vulnerable to stack overflowing ..
-        while(Offset(input, cursor) < end_offset - sentinel_block_length) {
-            ReadScope(output_tokens, token_allocator, input, cursor, input + end_offset - sentinel_block_length, is64bits);
+// ------------------------------------------------------------------------------------------------
+TokenPtr BinaryTokenizer::Next() {
+    try {
+        return ReadNext();
+    } catch (const DeadlyImportError& e) {
+        state = State_Done;
+        const size_t length = Offset(input, end);
+        if (!is64bits && (length > std::numeric_limits<uint32_t>::max())) {
+            throw DeadlyImportError("The FBX file is invalid. This may be because the content is too big for this older version (", ai_to_string(version), ") of the FBX format. (", e.what(), ")");
         }
-        output_tokens.push_back(new_Token(cursor, cursor + 1, TokenType_CLOSE_BRACKET, Offset(input, cursor) ));
+        throw;
+    }
+}
 
-        for (unsigned int i = 0; i < sentinel_block_length; ++i) {
-            if(cursor[i] != '\0') {
-                TokenizeError("failed to read nested block sentinel, expected all bytes to be 0",input, cursor);
-            }
-        }
-        cursor += sentinel_block_length;
+// ------------------------------------------------------------------------------------------------
+TokenPtr BinaryTokenizer::Persistent(const char *sbegin, const char *send, TokenType type) {
+    TokenPtr token = new_Token(sbegin, send, type, Offset(input, cursor));
+#ifdef DEBUG
+    if (transient_punctuation) {
+        persistent_tokens.push_back(token);
     }
+#endif
+    return token;
+}
 
-    if (Offset(input, cursor) != end_offset) {
-        TokenizeError("scope length not reached, something is wrong",input, cursor);
+// ------------------------------------------------------------------------------------------------
+TokenPtr BinaryTokenizer::Punctuation(TokenType type) {
+    if (!transient_punctuation) {
+        return Persistent(cursor, cursor + 1, type);
     }
 
-    return true;
+    // the parser only looks at the current and the previous token, so a
+    // slot is never overwritten while it is still referenced
+    const unsigned int slot = next_transient;
+    next_transient = (next_transient + 1) % NumTransientTokens;
+    if (transient[slot]) {
+        transient[slot]->~Token();
+    }
+    transient[slot] = new (transient_storage[slot]) Token(cursor, cursor + 1, type, Offset(input, cursor));
+    return transient[slot];
 }
 
-} // anonymous namespace
-
 // ------------------------------------------------------------------------------------------------
-// TODO: Test FBX Binary files newer than the 7500 version to check if the 64 bits address behaviour is consistent
-void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &token_allocator) {
-	ai_assert(input);
-	ASSIMP_LOG_DEBUG("Tokenizing binary FBX file");
+TokenPtr BinaryTokenizer::ReadNext() {
+    for (;;) {
+        switch (state) {
+        case State_Done:
+            return nullptr;
+
+        case State_Properties: {
+            if (props_left) {
+                if (pending_comma) {
+                    pending_comma = false;
+                    return Punctuation(TokenType_COMMA);
+                }
+
+                const char *sbeg, *send;
+                ReadData(sbeg, send, input, cursor, props_end);
+                pending_comma = --props_left != 0;
+                return Persistent(sbeg, send, TokenType_DATA);
+            }
 
-    if(length < 0x1b) {
-        TokenizeError("file is too short",0);
-    }
+            if (cursor != props_end) {
+                TokenizeError("property length not reached, something is wrong",input, cursor);
+            }
 
-    //uint32_t offset = 0x15;
-/*    const char* cursor = input + 0x15;
+            state = State_Scope;
+            if (Offset(input, cursor) < scope_end_offset) {
+                if (scope_end_offset - Offset(input, cursor) < sentinel_block_length) {
+                    TokenizeError("insufficient padding bytes at block end",input, cursor);
+                }
 
-    const uint32_t flags = ReadWord(input, cursor, input + length);
+                scopes.push_back(NestedScope{ scope_end_offset });
+                return Punctuation(TokenType_OPEN_BRACKET);
+            }
 
-    const uint8_t padding_0 = ReadByte(input, cursor, input + length); // unused
-    const uint8_t padding_1 = ReadByte(input, cursor, input + length); // unused*/
+            if (Offset(input, cursor) != scope_end_offset) {
+                TokenizeError("scope length not reached, something is wrong",input, cursor);
+            }
+            break;
+        }
 
-    if (strncmp(input,"Kaydara FBX Binary",18)) {
-        TokenizeError("magic bytes not found",0);
-    }
+        case State_Scope: {
+            // the end of the region the next scope has to fit in
+            const char *scope_end = end;
+            if (!scopes.empty()) {
+                const uint64_t nested_end = scopes.back().end_offset;
+                if (Offset(input, cursor) >= nested_end - sentinel_block_length) {
+                    TokenPtr token = Punctuation(TokenType_CLOSE_BRACKET);
+
+                    for (unsigned int i = 0; i < sentinel_block_length; ++i) {
+                        if(cursor[i] != '\0') {
+                            TokenizeError("failed to read nested block sentinel, expected all bytes to be 0",input, cursor);
+                        }
+                    }
+                    cursor += sentinel_block_length;
+
+                    if (Offset(input, cursor) != nested_end) {
+                        TokenizeError("scope length not reached, something is wrong",input, cursor);
+                    }
+                    scopes.pop_back();
+                    return token;
+                }
+                scope_end = input + nested_end - sentinel_block_length;
+            } else if (cursor >= end) {
+                state = State_Done;
+                return nullptr;
+            }
 
-    const char* cursor = input + 18;
-	/*Result ignored*/ ReadByte(input, cursor, input + length);
-	/*Result ignored*/ ReadByte(input, cursor, input + length);
-	/*Result ignored*/ ReadByte(input, cursor, input + length);
-	/*Result ignored*/ ReadByte(input, cursor, input + length);
-	/*Result ignored*/ ReadByte(input, cursor, input + length);
-	const uint32_t version = ReadWord(input, cursor, input + length);
-	ASSIMP_LOG_DEBUG("FBX version: ", version);
-	const bool is64bits = version >= 7500;
-    const char *end = input + length;
-    try
-    {
-        while (cursor < end ) {
-            if (!ReadScope(output_tokens, token_allocator, input, cursor, input + length, is64bits)) {
+            // the first word contains the offset at which this block ends
+            const uint64_t end_offset = is64bits ? ReadDoubleWord(input, cursor, scope_end) : ReadWord(input, cursor, scope_end);
+
+            // we may get 0 if reading reached the end of the file -
+            // fbx files have a mysterious extra footer which I don't know
+            // how to extract any information from, but at least it always
+            // starts with a 0.
+            if(!end_offset) {
+                if (scopes.empty()) {
+                    state = State_Done;
+                    return nullptr;
+                }
                 break;
             }
+
+            if(end_offset > Offset(input, scope_end)) {
+                TokenizeError("block offset is out of range",input, cursor);
+            }
+            else if(end_offset < Offset(input, cursor)) {
+                TokenizeError("block offset is negative out of range",input, cursor);
+            }
+
+            // the second data word contains the number of properties in the scope
+            const uint64_t prop_count = is64bits ? ReadDoubleWord(input, cursor, scope_end) : ReadWord(input, cursor, scope_end);
+
+            // the third data word contains the length of the property list
+            const uint64_t prop_length = is64bits ? ReadDoubleWord(input, cursor, scope_end) : ReadWord(input, cursor, scope_end);
+
+            // now comes the name of the scope/key
+            const char* sbeg, *send;
+            ReadString(sbeg, send, input, cursor, scope_end);
+
+            // now come the individual properties
+            if (prop_length > Offset(cursor, scope_end)) {
+                TokenizeError("property length out of bounds reading length ", input, cursor);
+            }
+
+            scope_end_offset = end_offset;
+            props_left = prop_count;
+            props_begin = cursor;
+            props_end = cursor + prop_length;
+            pending_comma = false;
+            state = State_Properties;
+            return Persistent(sbeg, send, TokenType_KEY);
         }
-    }
-    catch (const DeadlyImportError& e)
-    {
-        if (!is64bits && (length > std::numeric_limits<uint32_t>::max())) {
-            throw DeadlyImportError("The FBX file is invalid. This may be because the content is too big for this older version (", ai_to_string(version), ") of the FBX format. (", e.what(), ")");
         }
-        throw;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &token_allocator) {
+    BinaryTokenizer tokenizer(input, length, token_allocator, false);
+    while (TokenPtr token = tokenizer.Next()) {
+        output_tokens.push_back(token);
     }
 }
 
@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FBXExportNode.h"
 #include "FBXCommon.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/StreamWriter.h> // StreamWriterLE
 #include <assimp/Exceptional.h> // DeadlyExportError
@@ -138,9 +139,11 @@ void FBX::Node::AddP70time(
 
 void FBX::Node::Dump(
         const std::shared_ptr<Assimp::IOStream> &outfile,
-        bool binary, int indent) {
+        bool binary, int indent,
+        const ArrayCompression &compression) {
     if (binary) {
         Assimp::StreamWriterLE outstream(outfile);
+        CompressArrays(compression);
         DumpBinary(outstream);
     } else {
         std::ostringstream ss;
@@ -152,9 +155,11 @@ void FBX::Node::Dump(
 
 void FBX::Node::Dump(
     Assimp::StreamWriterLE &outstream,
-    bool binary, int indent
+    bool binary, int indent,
+    const ArrayCompression &compression
 ) {
     if (binary) {
+        CompressArrays(compression);
         DumpBinary(outstream);
     } else {
         std::ostringstream ss;
@@ -278,6 +283,37 @@ void FBX::Node::DumpBinary(Assimp::StreamWriterLE &s)
 }
 
 
+void FBX::Node::CollectArrays(
+    std::vector<FBX::FBXExportProperty*> &arrays,
+    const ArrayCompression &compression
+) {
+    for (auto &p : properties) {
+        if (p.NeedsCompression(compression)) { arrays.push_back(&p); }
+    }
+    for (FBX::Node& child : children) {
+        child.CollectArrays(arrays, compression);
+    }
+}
+
+void FBX::Node::CompressArrays(const ArrayCompression &compression)
+{
+    if (compression.threshold == 0) { return; }
+
+    // the arrays are independent, so deflate them all at once
+    std::vector<FBX::FBXExportProperty*> arrays;
+    CollectArrays(arrays, compression);
+    if (compression.pool != nullptr && arrays.size() > 1) {
+        compression.pool->ParallelFor(arrays.size(), [&](size_t i) {
+            arrays[i]->Compress(compression);
+        });
+    } else {
+        for (FBX::FBXExportProperty* p : arrays) {
+            p->Compress(compression);
+        }
+    }
+}
+
+
 // public member functions for writing to ascii fbx
 
 void FBX::Node::DumpAscii(std::ostream &s, int indent)
@@ -478,38 +514,61 @@ void FBX::Node::WritePropertyNodeAscii(
     node.End(s, false, indent, false);
 }
 
+// write the header and data of a deflated array property
+static void WriteDeflatedArray(
+    char type, size_t count,
+    const std::vector<char>& deflated,
+    Assimp::StreamWriterLE& s
+){
+    s.PutU1(type);
+    s.PutU4(uint32_t(count)); // number of elements
+    s.PutU4(1); // zip-compressed
+    s.PutU4(uint32_t(deflated.size())); // compressed data size
+    for (char c : deflated) { s.PutChar(c); }
+}
+
 // binary property node from vector of doubles
-// TODO: optional zip compression!
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<double>& v,
-    Assimp::StreamWriterLE& s
+    Assimp::StreamWriterLE& s,
+    const ArrayCompression& compression
 ){
     FBX::Node node(name);
     node.BeginBinary(s);
-    s.PutU1('d');
-    s.PutU4(uint32_t(v.size())); // number of elements
-    s.PutU4(0); // no encoding (1 would be zip-compressed)
-    s.PutU4(uint32_t(v.size()) * 8); // data size
-    for (auto it = v.begin(); it != v.end(); ++it) { s.PutF8(*it); }
+    std::vector<char> deflated;
+    if (DeflateArray(v.data(), v.size() * 8, compression, deflated)) {
+        WriteDeflatedArray('d', v.size(), deflated, s);
+    } else {
+        s.PutU1('d');
+        s.PutU4(uint32_t(v.size())); // number of elements
+        s.PutU4(0); // no encoding
+        s.PutU4(uint32_t(v.size()) * 8); // data size
+        for (auto it = v.begin(); it != v.end(); ++it) { s.PutF8(*it); }
+    }
     node.EndPropertiesBinary(s, 1);
     node.EndBinary(s, false);
 }
 
 // binary property node from vector of int32_t
-// TODO: optional zip compression!
 void FBX::Node::WritePropertyNodeBinary(
     const std::string& name,
     const std::vector<int32_t>& v,
-    Assimp::StreamWriterLE& s
+    Assimp::StreamWriterLE& s,
+    const ArrayCompression& compression
 ){
     FBX::Node node(name);
     node.BeginBinary(s);
-    s.PutU1('i');
-    s.PutU4(uint32_t(v.size())); // number of elements
-    s.PutU4(0); // no encoding (1 would be zip-compressed)
-    s.PutU4(uint32_t(v.size()) * 4); // data size
-    for (auto it = v.begin(); it != v.end(); ++it) { s.PutI4(*it); }
+    std::vector<char> deflated;
+    if (DeflateArray(v.data(), v.size() * 4, compression, deflated)) {
+        WriteDeflatedArray('i', v.size(), deflated, s);
+    } else {
+        s.PutU1('i');
+        s.PutU4(uint32_t(v.size())); // number of elements
+        s.PutU4(0); // no encoding
+        s.PutU4(uint32_t(v.size()) * 4); // data size
+        for (auto it = v.begin(); it != v.end(); ++it) { s.PutI4(*it); }
+    }
     node.EndPropertiesBinary(s, 1);
     node.EndBinary(s, false);
 }
@@ -523,10 +582,11 @@ void FBX::Node::WritePropertyNode(
     const std::string& name,
     const std::vector<double>& v,
     Assimp::StreamWriterLE& s,
-    bool binary, int indent
+    bool binary, int indent,
+    const ArrayCompression& compression
 ){
     if (binary) {
-        FBX::Node::WritePropertyNodeBinary(name, v, s);
+        FBX::Node::WritePropertyNodeBinary(name, v, s, compression);
     } else {
         FBX::Node::WritePropertyNodeAscii(name, v, s, indent);
     }
@@ -539,10 +599,11 @@ void FBX::Node::WritePropertyNode(
     const std::string& name,
     const std::vector<int32_t>& v,
     Assimp::StreamWriterLE& s,
-    bool binary, int indent
+    bool binary, int indent,
+    const ArrayCompression& compression
 ){
     if (binary) {
-        FBX::Node::WritePropertyNodeBinary(name, v, s);
+        FBX::Node::WritePropertyNodeBinary(name, v, s, compression);
     } else {
         FBX::Node::WritePropertyNodeAscii(name, v, s, indent);
     }
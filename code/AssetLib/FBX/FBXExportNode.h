@@ -145,11 +145,15 @@ public:
         AddChild(n);
     }
 
-    // write the full node to the given file or stream
+    // write the full node to the given file or stream.
+    // in binary mode large arrays are deflated first, see ArrayCompression.
     void Dump(
             const std::shared_ptr<Assimp::IOStream> &outfile,
-            bool binary, int indent);
-    void Dump(Assimp::StreamWriterLE &s, bool binary, int indent);
+            bool binary, int indent,
+            const ArrayCompression &compression = {});
+    void Dump(
+            Assimp::StreamWriterLE &s, bool binary, int indent,
+            const ArrayCompression &compression = {});
 
     // these other functions are for writing data piece by piece.
     // they must be used carefully.
@@ -176,11 +180,12 @@ public:
         const std::string& name,
         const T value,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const ArrayCompression& compression = {}
     ) {
         FBX::FBXExportProperty p(value);
         FBX::Node node(name, std::move(p));
-        node.Dump(s, binary, indent);
+        node.Dump(s, binary, indent, compression);
     }
 
     // convenience function to create and write a property node,
@@ -190,7 +195,8 @@ public:
         const std::string& name,
         const std::vector<double>& v,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const ArrayCompression& compression = {}
     );
 
     // convenience function to create and write a property node,
@@ -200,12 +206,17 @@ public:
         const std::string& name,
         const std::vector<int32_t>& v,
         Assimp::StreamWriterLE& s,
-        bool binary, int indent
+        bool binary, int indent,
+        const ArrayCompression& compression = {}
     );
 
 private: // internal functions used for writing
 
     void DumpBinary(Assimp::StreamWriterLE &s);
+    void CollectArrays(
+        std::vector<FBX::FBXExportProperty*> &arrays,
+        const ArrayCompression &compression);
+    void CompressArrays(const ArrayCompression &compression);
     void DumpAscii(Assimp::StreamWriterLE &s, int indent);
     void DumpAscii(std::ostream &s, int indent);
 
@@ -238,12 +249,14 @@ private: // internal functions used for writing
     static void WritePropertyNodeBinary(
         const std::string& name,
         const std::vector<double>& v,
-        Assimp::StreamWriterLE& s
+        Assimp::StreamWriterLE& s,
+        const ArrayCompression& compression
     );
     static void WritePropertyNodeBinary(
         const std::string& name,
         const std::vector<int32_t>& v,
-        Assimp::StreamWriterLE& s
+        Assimp::StreamWriterLE& s,
+        const ArrayCompression& compression
     );
 
 private: // data used for binary dumps
@@ -42,6 +42,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_EXPORTER
 
 #include "FBXExportProperty.h"
+#include "Common/Compression.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/StreamWriter.h> // StreamWriterLE
 #include <assimp/Exceptional.h> // DeadlyExportError
@@ -187,10 +189,99 @@ size_t FBXExportProperty::size() {
     }
 }
 
+bool DeflateArray(
+    const void* data, size_t size,
+    const ArrayCompression& compression,
+    std::vector<char>& out
+) {
+#ifdef AI_BUILD_BIG_ENDIAN
+    // arrays are deflated as they are in memory, but FBX is little-endian
+    (void)data; (void)size; (void)compression; (void)out;
+    return false;
+#else
+    if (compression.threshold == 0 || size < compression.threshold) {
+        return false;
+    }
+    bool compressed = false;
+    if (compression.deflated != nullptr && compression.deflated->Take(data, size, out, compressed)) {
+        return compressed;
+    }
+    return Compression::compress(data, size, out, compression.level)
+        && out.size() < size;
+#endif
+}
+
+void DeflatedArrays::Add(const void* data, size_t size) {
+    arrays.push_back({ data, size, false, {} });
+}
+
+void DeflatedArrays::Deflate(const ArrayCompression& compression) {
+    std::vector<Array*> pending;
+    for (Array& a : arrays) {
+        if (compression.threshold != 0 && a.size >= compression.threshold) {
+            pending.push_back(&a);
+        }
+    }
+    ArrayCompression settings = compression;
+    settings.deflated = nullptr;
+    auto deflate = [&](size_t i) {
+        pending[i]->compressed = DeflateArray(pending[i]->data, pending[i]->size, settings, pending[i]->deflated);
+    };
+    if (compression.pool != nullptr && pending.size() > 1) {
+        compression.pool->ParallelFor(pending.size(), deflate);
+    } else {
+        for (size_t i = 0; i < pending.size(); ++i) {
+            deflate(i);
+        }
+    }
+}
+
+bool DeflatedArrays::Take(const void* data, size_t size, std::vector<char>& out, bool& compressed) {
+    for (Array& a : arrays) {
+        if (a.data == data && a.size == size) {
+            compressed = a.compressed;
+            out.swap(a.deflated);
+            a.compressed = false;
+            a.deflated.clear();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FBXExportProperty::IsArray() const {
+    return type == 'i' || type == 'l' || type == 'f' || type == 'd';
+}
+
+bool FBXExportProperty::NeedsCompression(const ArrayCompression& compression) const {
+    return IsArray() && compressed_count == 0
+        && compression.threshold != 0 && data.size() >= compression.threshold;
+}
+
+void FBXExportProperty::Compress(const ArrayCompression& compression) {
+    if (!IsArray() || compressed_count != 0) {
+        return;
+    }
+    std::vector<char> deflated;
+    if (!DeflateArray(data.data(), data.size(), compression, deflated)) {
+        return;
+    }
+    const size_t stride = (type == 'i' || type == 'f') ? 4 : 8;
+    compressed_count = uint32_t(data.size() / stride);
+    data.assign(deflated.begin(), deflated.end());
+}
+
 void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
     s.PutU1(type);
     uint8_t* d = data.data();
     size_t N;
+    if (compressed_count != 0) {
+        s.PutU4(compressed_count); // number of elements
+        s.PutU4(1); // zip-compressed
+        s.PutU4(uint32_t(data.size())); // compressed data size
+        for (size_t i = 0; i < data.size(); ++i) { s.PutU1(data[i]); }
+        return;
+    }
     switch (type) {
         case 'C': s.PutU1(*(reinterpret_cast<uint8_t*>(d))); return;
         case 'Y': s.PutI2(*(reinterpret_cast<int16_t*>(d))); return;
@@ -206,8 +297,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'i':
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding, see Compress()
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI4((reinterpret_cast<int32_t*>(d))[i]);
@@ -216,8 +306,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'l':
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding, see Compress()
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutI8((reinterpret_cast<int64_t*>(d))[i]);
@@ -226,8 +315,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'f':
             N = data.size() / 4;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding, see Compress()
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF4((reinterpret_cast<float*>(d))[i]);
@@ -236,8 +324,7 @@ void FBXExportProperty::DumpBinary(Assimp::StreamWriterLE& s) {
         case 'd':
             N = data.size() / 8;
             s.PutU4(uint32_t(N)); // number of elements
-            s.PutU4(0); // no encoding (1 would be zip-compressed)
-            // TODO: compress if large?
+            s.PutU4(0); // no encoding, see Compress()
             s.PutU4(uint32_t(data.size())); // data size
             for (size_t i = 0; i < N; ++i) {
                 s.PutF8((reinterpret_cast<double*>(d))[i]);
@@ -56,8 +56,69 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <type_traits> // is_void
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace FBX {
 
+class DeflatedArrays;
+
+/** @brief Settings for the zlib compression of data arrays in binary files.
+ *
+ *  Arrays of at least threshold bytes are deflated with the given level,
+ *  see AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD. When a pool is given,
+ *  the arrays of a node and its children are deflated in parallel, and so
+ *  are the streamed geometry arrays collected in a DeflatedArrays.
+ */
+struct ArrayCompression {
+    size_t threshold = 0; // 0 disables compression
+    int level = -1; // zlib compression level, -1 is the zlib default
+    ThreadPool *pool = nullptr;
+    DeflatedArrays *deflated = nullptr; // arrays deflated ahead of writing
+};
+
+// deflate size bytes of array data into out, if compression is enabled,
+// the array is large enough and the compressed data is smaller.
+// returns whether out holds the data to write.
+bool DeflateArray(
+    const void* data, size_t size,
+    const ArrayCompression& compression,
+    std::vector<char>& out
+);
+
+/** @brief Arrays written piece by piece, deflated together beforehand.
+ *
+ *  FBX::Node::WritePropertyNode() streams large arrays without copying
+ *  them into a node, so they are not deflated along with one. Adding them
+ *  here and calling Deflate() compresses all of them at once, through the
+ *  pool of the compression settings. DeflateArray() then hands out the
+ *  results when the settings point to this.
+ */
+class DeflatedArrays {
+public:
+    template <typename T>
+    void Add(const std::vector<T>& v) {
+        Add(v.data(), v.size() * sizeof(T));
+    }
+    void Add(const void* data, size_t size);
+
+    // deflate all added arrays which meet the threshold
+    void Deflate(const ArrayCompression& compression);
+
+    // move the result for the given array into out.
+    // returns false if the array was not added.
+    bool Take(const void* data, size_t size, std::vector<char>& out, bool& compressed);
+
+private:
+    struct Array {
+        const void* data;
+        size_t size;
+        bool compressed;
+        std::vector<char> deflated;
+    };
+    std::vector<Array> arrays;
+};
+
 /** @brief FBX::Property
  *
  *  Holds a value of any of FBX's recognized types,
@@ -110,6 +171,16 @@ public:
     // the size of this property node in a binary file, in bytes
     size_t size();
 
+    // whether this is one of the array types
+    bool IsArray() const;
+
+    // whether this is an array which Compress() would deflate
+    bool NeedsCompression(const ArrayCompression& compression) const;
+
+    // deflate the data of an array property, see DeflateArray().
+    // the property can only be written as binary afterwards.
+    void Compress(const ArrayCompression& compression);
+
     // write this property node as binary data to the given stream
     void DumpBinary(Assimp::StreamWriterLE& s);
     void DumpAscii(Assimp::StreamWriterLE& s, int indent = 0);
@@ -119,6 +190,7 @@ public:
 private:
     char type;
     std::vector<uint8_t> data;
+    uint32_t compressed_count = 0; // element count of a compressed array
 };
 
 } // Namespace FBX
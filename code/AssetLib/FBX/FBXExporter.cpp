@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXExportProperty.h"
 #include "FBXCommon.h"
 #include "FBXUtil.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/version.h> // aiGetVersion
 #include <assimp/IOSystem.hpp>
@@ -59,6 +60,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/mesh.h>
 
 // Header files, standard library.
+#include <algorithm>
 #include <array>
 #include <ctime> // localtime, tm_*
 #include <map>
@@ -155,10 +157,22 @@ void FBXExporter::ExportBinary (
     // remember that we're exporting in binary mode
     binary = true;
 
-    // we're not currently using these preferences,
-    // but clang will cry about it if we never touch it.
-    // TODO: some of these might be relevant to export
-    (void)mProperties;
+    // optionally deflate large data arrays, as most DCC tools do
+    compression = FBX::ArrayCompression();
+    const int threshold = mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, 0);
+    if (threshold > 0) {
+        compression.threshold = static_cast<size_t>(threshold);
+        compression.level = mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_LEVEL, -1);
+        if (compression.level < -1 || compression.level > 9) {
+            ASSIMP_LOG_WARN("FBX export: invalid compression level ", compression.level, ", using the zlib default");
+            compression.level = -1;
+        }
+        const int threads = mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_FBX_DEFLATE_THREADS, 1);
+        if (threads != 1) {
+            deflatePool.reset(new ThreadPool(static_cast<unsigned int>(std::max(0, threads))));
+            compression.pool = deflatePool.get();
+        }
+    }
 
     // open the indicated file for writing (in binary mode)
     outfile.reset(pIOSystem->Open(pFile,"wb"));
@@ -183,6 +197,8 @@ void FBXExporter::ExportBinary (
     // explicitly release file pointer,
     // so we don't have to rely on class destruction.
     outfile.reset();
+    compression = FBX::ArrayCompression();
+    deflatePool.reset();
 }
 
 void FBXExporter::ExportAscii (
@@ -362,7 +378,7 @@ void FBXExporter::WriteHeaderExtension ()
     CreationTimeStamp.AddChild("Minute", int32_t(now->tm_min));
     CreationTimeStamp.AddChild("Second", int32_t(now->tm_sec));
     CreationTimeStamp.AddChild("Millisecond", int32_t(0));
-    CreationTimeStamp.Dump(outstream, binary, indent);
+    CreationTimeStamp.Dump(outstream, binary, indent, compression);
 
     std::stringstream creator;
     creator << "Open Asset Import Library (Assimp) " << aiGetVersionMajor()
@@ -481,7 +497,7 @@ void FBXExporter::WriteGlobalSettings () {
     WritePropInt(mScene, p, "CurrentTimeMarker", -1);
     gs.AddChild(p);
 
-    gs.Dump(outfile, binary, 0);
+    gs.Dump(outfile, binary, 0, compression);
 }
 
 void FBXExporter::WriteDocuments() {
@@ -510,7 +526,7 @@ void FBXExporter::WriteDocuments() {
     doc.AddChild("RootNode", int64_t(0));
 
     docs.AddChild(doc);
-    docs.Dump(outfile, binary, 0);
+    docs.Dump(outfile, binary, 0, compression);
 }
 
 void FBXExporter::WriteReferences() {
@@ -521,7 +537,7 @@ void FBXExporter::WriteReferences() {
     // not really sure what this is for.
     FBX::Node n("References");
     n.force_has_children = true;
-    n.Dump(outfile, binary, 0);
+    n.Dump(outfile, binary, 0, compression);
 }
 
 
@@ -1008,7 +1024,7 @@ void FBXExporter::WriteDefinitions () {
     for (auto &on : object_nodes) {
         defs.AddChild(on);
     }
-    defs.Dump(outfile, binary, 0);
+    defs.Dump(outfile, binary, 0, compression);
 }
 
 
@@ -1239,8 +1255,25 @@ void FBXExporter::WriteObjects () {
         }
 
 
-        FBX::Node::WritePropertyNode("Vertices", flattened_vertices, outstream, binary, indent);
-        FBX::Node::WritePropertyNode("PolygonVertexIndex", polygon_data, outstream, binary, indent);
+        // the large arrays are streamed instead of being node properties,
+        // deflate them together so the pool works on all of them at once
+        FBX::DeflatedArrays deflated;
+        FBX::ArrayCompression geometryCompression = compression;
+        if (binary && compression.threshold != 0) {
+            deflated.Add(flattened_vertices);
+            deflated.Add(polygon_data);
+            deflated.Add(normal_data);
+            deflated.Add(color_data);
+            for (size_t uvi = 0; uvi < uv_data.size(); ++uvi) {
+                deflated.Add(uv_data[uvi]);
+                deflated.Add(uv_indices[uvi]);
+            }
+            deflated.Deflate(compression);
+            geometryCompression.deflated = &deflated;
+        }
+
+        FBX::Node::WritePropertyNode("Vertices", flattened_vertices, outstream, binary, indent, geometryCompression);
+        FBX::Node::WritePropertyNode("PolygonVertexIndex", polygon_data, outstream, binary, indent, geometryCompression);
         FBX::Node::WritePropertyNode("GeometryVersion", int32_t(124), outstream, binary, indent);
 
 	if (!normal_data.empty()) {
@@ -1254,7 +1287,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Normals", normal_data, outstream, binary, indent);
+	    FBX::Node::WritePropertyNode("Normals", normal_data, outstream, binary, indent, geometryCompression);
 	    // note: version 102 has a NormalsW also... not sure what it is,
 	    // so stick with version 101 for now.
 	    indent = 2;
@@ -1275,7 +1308,7 @@ void FBXExporter::WriteObjects () {
 	    FBX::Node::WritePropertyNode("Name", (const char *)layerName, outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
 	    FBX::Node::WritePropertyNode("ReferenceInformationType", "Direct", outstream, binary, indent);
-	    FBX::Node::WritePropertyNode("Colors", color_data, outstream, binary, indent);
+	    FBX::Node::WritePropertyNode("Colors", color_data, outstream, binary, indent, geometryCompression);
 	    indent = 2;
 	    vertexcolors.End(outstream, binary, indent, true);
         }
@@ -1291,8 +1324,8 @@ void FBXExporter::WriteObjects () {
           FBX::Node::WritePropertyNode("Name", "", outstream, binary, indent);
           FBX::Node::WritePropertyNode("MappingInformationType", "ByPolygonVertex", outstream, binary, indent);
           FBX::Node::WritePropertyNode("ReferenceInformationType", "IndexToDirect", outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UV", uv_data[uvi], outstream, binary, indent);
-          FBX::Node::WritePropertyNode("UVIndex", uv_indices[uvi], outstream, binary, indent);
+          FBX::Node::WritePropertyNode("UV", uv_data[uvi], outstream, binary, indent, geometryCompression);
+          FBX::Node::WritePropertyNode("UVIndex", uv_indices[uvi], outstream, binary, indent, geometryCompression);
           indent = 2;
           uv.End(outstream, binary, indent, true);
         }
@@ -1323,7 +1356,7 @@ void FBXExporter::WriteObjects () {
           }
           mat.AddChild("Materials", mat_indices);
         }
-        mat.Dump(outstream, binary, indent);
+        mat.Dump(outstream, binary, indent, compression);
 
         // finally we have the layer specifications,
         // which select the normals / UV set / etc to use.
@@ -1354,7 +1387,7 @@ void FBXExporter::WriteObjects () {
         le.AddChild("Type", "LayerElementUV");
         le.AddChild("TypedIndex", int32_t(0));
         layer.AddChild(le);
-        layer.Dump(outstream, binary, indent);
+        layer.Dump(outstream, binary, indent, compression);
 
         for(unsigned int lr = 1; lr < uv_data.size(); ++ lr) {
             FBX::Node layerExtra("Layer", int32_t(lr));
@@ -1363,7 +1396,7 @@ void FBXExporter::WriteObjects () {
             leExtra.AddChild("Type", "LayerElementUV");
             leExtra.AddChild("TypedIndex", int32_t(lr));
             layerExtra.AddChild(leExtra);
-            layerExtra.Dump(outstream, binary, indent);
+            layerExtra.Dump(outstream, binary, indent, compression);
         }
         // finish the node record
         indent = 1;
@@ -1527,7 +1560,7 @@ void FBXExporter::WriteObjects () {
 
         n.AddChild(p);
 
-        n.Dump(outstream, binary, indent);
+        n.Dump(outstream, binary, indent, compression);
     }
 
     // we need to look up all the images we're using,
@@ -1597,7 +1630,7 @@ void FBXExporter::WriteObjects () {
         n.AddChild("UseMipMap", int32_t(0));
         n.AddChild("Filename", path);
         n.AddChild("RelativeFilename", path);
-        n.Dump(outstream, binary, indent);
+        n.Dump(outstream, binary, indent, compression);
     }
 
     // Textures
@@ -1723,7 +1756,7 @@ void FBXExporter::WriteObjects () {
             tnode.AddChild(
                 "Cropping", int32_t(0), int32_t(0), int32_t(0), int32_t(0)
             );
-            tnode.Dump(outstream, binary, indent);
+            tnode.Dump(outstream, binary, indent, compression);
         }
     }
 
@@ -1738,7 +1771,7 @@ void FBXExporter::WriteObjects () {
       FBX::Node dnode("Deformer");
       dnode.AddProperties(deformer_uid, m->mName.data + FBX::SEPARATOR + "Blendshapes", "BlendShape");
       dnode.AddChild("Version", int32_t(101));
-      dnode.Dump(outstream, binary, indent);
+      dnode.Dump(outstream, binary, indent, compression);
       // connect it
       const auto node = get_node_for_mesh((unsigned int)mi, mScene->mRootNode);
       connections.emplace_back("C", "OO", deformer_uid, mesh_uids[node]);
@@ -1786,16 +1819,16 @@ void FBXExporter::WriteObjects () {
           }
 
           FBX::Node::WritePropertyNode(
-              "Indexes", shape_indices, outstream, binary, indent
+              "Indexes", shape_indices, outstream, binary, indent, compression
           );
 
           FBX::Node::WritePropertyNode(
-              "Vertices", pPositionDiff, outstream, binary, indent
+              "Vertices", pPositionDiff, outstream, binary, indent, compression
           );
 
           if (pNormalDiff.size()>0) {
             FBX::Node::WritePropertyNode(
-                "Normals", pNormalDiff, outstream, binary, indent
+                "Normals", pNormalDiff, outstream, binary, indent, compression
             );
           }
         }
@@ -1817,7 +1850,7 @@ void FBXExporter::WriteObjects () {
         std::vector<double>fFullWeights;
         fFullWeights.push_back(100.);
         sdnode.AddChild("FullWeights", fFullWeights);
-        sdnode.Dump(outstream, binary, indent);
+        sdnode.Dump(outstream, binary, indent, compression);
 
         connections.emplace_back("C", "OO", blendchannel_uid, deformer_uid);
         connections.emplace_back("C", "OO", blendshape_uid, blendchannel_uid);
@@ -1986,7 +2019,7 @@ void FBXExporter::WriteObjects () {
         // "acuracy"... this is not a typo....
         dnode.AddChild("Link_DeformAcuracy", double(50));
         dnode.AddChild("SkinningType", "Linear"); // TODO: other modes?
-        dnode.Dump(outstream, binary, indent);
+        dnode.Dump(outstream, binary, indent, compression);
 
         // connect it
         connections.emplace_back("C", "OO", deformer_uid, mesh_uids[mesh_node]);
@@ -2083,7 +2116,7 @@ void FBXExporter::WriteObjects () {
             // there's not really any way around this at the moment.
 
             // done
-            sdnode.Dump(outstream, binary, indent);
+            sdnode.Dump(outstream, binary, indent, compression);
 
             // lastly, connect to the parent deformer
             connections.emplace_back(
@@ -2201,7 +2234,7 @@ void FBXExporter::WriteObjects () {
         }
 
         // now write it
-        bpnode.Dump(outstream, binary, indent);
+        bpnode.Dump(outstream, binary, indent, compression);
     }*/
 
     // lights
@@ -2256,7 +2289,7 @@ void FBXExporter::WriteObjects () {
         lna.AddChild(lnap);
         lna.AddChild("TypeFlags", FBX::FBXExportProperty("Light"));
         lna.AddChild("GeometryVersion", FBX::FBXExportProperty(int32_t(124)));
-        lna.Dump(outstream, binary, indent);
+        lna.Dump(outstream, binary, indent, compression);
 
         // Store name and uid (will be used later when parsing scene nodes)
         lights_uids[l->mName.C_Str()] = uid;
@@ -2319,7 +2352,7 @@ void FBXExporter::WriteObjects () {
         // this node absurdly always pretends it has children
         // (in this case it does, but just in case...)
         asnode.force_has_children = true;
-        asnode.Dump(outstream, binary, indent);
+        asnode.Dump(outstream, binary, indent, compression);
 
         // note: animation stacks are not connected to anything
     }
@@ -2334,7 +2367,7 @@ void FBXExporter::WriteObjects () {
 
         // this node absurdly always pretends it has children
         alnode.force_has_children = true;
-        alnode.Dump(outstream, binary, indent);
+        alnode.Dump(outstream, binary, indent, compression);
 
         // connect to the relevant animstack
         connections.emplace_back(
@@ -2603,7 +2636,7 @@ void FBXExporter::WriteModelNode(
     m.AddChild("Shading", FBXExportProperty(true));
     m.AddChild("Culling", FBXExportProperty("CullingOff"));
 
-    m.Dump(outstream, binary, 1);
+    m.Dump(outstream, binary, 1, compression);
 }
 
 // wrapper for WriteModelNodes to create and pass a blank transform chain
@@ -2713,7 +2746,7 @@ void FBXExporter::WriteModelNodes(
             node_attribute_uid, FBX::SEPARATOR + "NodeAttribute", "LimbNode"
         );
         na.AddChild("TypeFlags", FBXExportProperty("Skeleton"));
-        na.Dump(outstream, binary, 1);
+        na.Dump(outstream, binary, 1, compression);
         // and connect them
         connections.emplace_back("C", "OO", node_attribute_uid, node_uid);
     } else if (node->mNumMeshes >= 1) {
@@ -2781,7 +2814,7 @@ void FBXExporter::WriteAnimationCurveNode(
     p.AddP70numberA("d|Y", default_value.y);
     p.AddP70numberA("d|Z", default_value.z);
     n.AddChild(p);
-    n.Dump(outstream, binary, 1);
+    n.Dump(outstream, binary, 1, compression);
     // connect to layer
     this->connections.emplace_back("C", "OO", uid, layer_uid);
     // connect to bone
@@ -2810,7 +2843,7 @@ void FBXExporter::WriteAnimationCurve(
         "KeyAttrRefCount",
         std::vector<int32_t>{static_cast<int32_t>(times.size())}
     );
-    n.Dump(outstream, binary, 1);
+    n.Dump(outstream, binary, 1, compression);
     this->connections.emplace_back(
         "C", "OP", curve_uid, curvenode_uid, property_link
     );
@@ -2830,7 +2863,7 @@ void FBXExporter::WriteConnections ()
     conn.Begin(outstream, binary, 0);
     conn.BeginChildren(outstream, binary, 0);
     for (auto &n : connections) {
-        n.Dump(outstream, binary, 1);
+        n.Dump(outstream, binary, 1, compression);
     }
     conn.End(outstream, binary, 0, !connections.empty());
     connections.clear();
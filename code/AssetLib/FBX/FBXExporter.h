@@ -68,6 +68,7 @@ namespace Assimp {
     class IOSystem;
     class IOStream;
     class ExportProperties;
+    class ThreadPool;
 
     // ---------------------------------------------------------------------
     /** Helper class to export a given scene to an FBX file. */
@@ -85,8 +86,10 @@ namespace Assimp {
     private:
         bool binary; // whether current export is in binary or ascii format
         const aiScene* mScene; // the scene to export
-        const ExportProperties* mProperties; // currently unused
+        const ExportProperties* mProperties; // export settings
         std::shared_ptr<IOStream> outfile; // file to write to
+        FBX::ArrayCompression compression; // deflating of data arrays
+        std::unique_ptr<ThreadPool> deflatePool; // to deflate arrays in parallel
 
         std::vector<FBX::Node> connections; // connection storage
 
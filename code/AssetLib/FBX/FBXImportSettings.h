@@ -65,7 +65,8 @@ struct ImportSettings {
             optimizeEmptyAnimationCurves(true),
             useLegacyEmbeddedTextureNaming(false),
             removeEmptyBones(true),
-            convertToMeters(false) {
+            convertToMeters(false),
+            inflateThreads(1) {
         // empty
     }
 
@@ -159,6 +160,11 @@ struct ImportSettings {
 
     // Set to true to ignore the axis configuration in the file
     bool ignoreUpDirection = false;
+
+    /** Number of threads to inflate compressed binary arrays up front,
+     *  1 inflates them lazily, 0 uses all hardware threads
+    */
+    unsigned int inflateThreads;
 };
 
 } // namespace FBX
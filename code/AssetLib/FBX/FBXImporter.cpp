@@ -51,9 +51,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXDocument.h"
 #include "FBXParser.h"
 #include "FBXTokenizer.h"
+#include "Common/ThreadPool.h"
 #include "FBXUtil.h"
 
 #include <assimp/MemoryIOWrapper.h>
+#include <assimp/Profiler.h>
 #include <assimp/StreamReader.h>
 #include <assimp/importerdesc.h>
 #include <assimp/Importer.hpp>
@@ -119,6 +121,7 @@ void FBXImporter::SetupProperties(const Importer *pImp) {
     mSettings.convertToMeters = pImp->GetPropertyBool(AI_CONFIG_FBX_CONVERT_TO_M, false);
     mSettings.ignoreUpDirection = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_IGNORE_UP_DIRECTION, false);
     mSettings.useSkeleton = pImp->GetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, false);
+    mSettings.inflateThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_FBX_INFLATE_THREADS, 1)));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -139,34 +142,70 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
 	// streaming input data would be very low.
+	// Binary files are tokenized in place if the stream already holds
+	// the whole file in memory, e.g. for memory mapped files. The text
+	// tokenizer needs a terminating zero, so it always works on a copy.
+	const size_t fileSize = stream->FileSize();
+	const char *const mapped = reinterpret_cast<const char *>(stream->GetMappedData());
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = nullptr;
+	size_t length = 0;
+	if (mapped != nullptr && fileSize >= 18 && !strncmp(mapped, "Kaydara FBX Binary", 18)) {
+		begin = mapped;
+		length = fileSize;
+	} else {
+		contents.resize(fileSize + 1);
+		stream->Read(&*contents.begin(), 1, contents.size() - 1);
+		contents[contents.size() - 1] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
 
 	// broad-phase tokenized pass in which we identify the core
-	// syntax elements of FBX (brackets, commas, key:value mappings)
+	// syntax elements of FBX (brackets, commas, key:value mappings).
+	// Binary files are tokenized on demand while parsing, which saves
+	// building the full token list.
 	TokenList tokens;
     Assimp::StackAllocator tempAllocator;
     try {
-		bool is_binary = false;
+		std::unique_ptr<BinaryTokenizer> binaryTokenizer;
 		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
-			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+			binaryTokenizer.reset(new BinaryTokenizer(begin, length, tempAllocator));
 		} else {
+			if (m_profiler) {
+				m_profiler->BeginRegion("tokenize");
+			}
             Tokenize(tokens, begin, tempAllocator);
+			if (m_profiler) {
+				m_profiler->EndRegion("tokenize");
+			}
 		}
 
 		// use this information to construct a very rudimentary
 		// parse-tree representing the FBX scope structure
-        Parser parser(tokens, tempAllocator, is_binary);
+		if (m_profiler) {
+			m_profiler->BeginRegion("parse");
+		}
+		std::unique_ptr<Parser> parser(binaryTokenizer ? new Parser(*binaryTokenizer, tempAllocator) : new Parser(tokens, tempAllocator, false));
+		if (binaryTokenizer && mSettings.inflateThreads != 1) {
+			ThreadPool pool(mSettings.inflateThreads);
+			parser->InflateBinaryArrays(pool);
+		}
 
 		// take the raw parse-tree and convert it to a FBX DOM
-		Document doc(parser, mSettings);
+		Document doc(*parser, mSettings);
+		if (m_profiler) {
+			m_profiler->EndRegion("parse");
+		}
 
 		// convert the FBX DOM to aiScene
+		if (m_profiler) {
+			m_profiler->BeginRegion("convert");
+		}
 		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		if (m_profiler) {
+			m_profiler->EndRegion("convert");
+		}
 
 		// size relative to cm
 		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
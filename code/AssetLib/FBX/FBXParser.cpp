@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "Common/Compression.h"
+#include "Common/ThreadPool.h"
 
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
@@ -57,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 
 #include <iostream>
+#include <limits>
 
 using namespace Assimp;
 using namespace Assimp::FBX;
@@ -95,6 +97,7 @@ namespace {
     // Initially, we did reinterpret_cast, breaking strict aliasing rules.
     // This actually caused trouble on Android, so let's be safe this time.
     // https://github.com/assimp/assimp/issues/24
+
     template <typename T>
     T SafeParse(const char* data, const char* end) {
         // Actual size validation happens during Tokenization so
@@ -105,6 +108,9 @@ namespace {
         ::memcpy(&result, data, sizeof(T));
         return result;
     }
+
+    // token list of parsers which pull their tokens from a tokenizer
+    const TokenList noTokens;
 }
 
 namespace Assimp {
@@ -226,23 +232,147 @@ Scope::~Scope()
 
 // ------------------------------------------------------------------------------------------------
 Parser::Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary) :
-        tokens(tokens), allocator(allocator), last(), current(), cursor(tokens.begin()), is_binary(is_binary)
+        tokens(tokens), tokenizer(nullptr), allocator(allocator), last(), current(), cursor(tokens.begin()), is_binary(is_binary)
 {
     ASSIMP_LOG_DEBUG("Parsing FBX tokens");
     root = new_Scope(*this, true);
 }
 
+// ------------------------------------------------------------------------------------------------
+Parser::Parser(BinaryTokenizer &tokenizer, StackAllocator &allocator) :
+        tokens(noTokens), tokenizer(&tokenizer), allocator(allocator), last(), current(), cursor(noTokens.begin()), is_binary(true)
+{
+    ASSIMP_LOG_DEBUG("Parsing FBX tokens while tokenizing");
+    root = new_Scope(*this, true);
+}
+
 // ------------------------------------------------------------------------------------------------
 Parser::~Parser()
 {
     delete_Scope(root);
+
+    for (TokenPtr token : inflated_tokens) {
+        delete_Token(token);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Parser::InflateBinaryArrays(ThreadPool &pool)
+{
+    struct CompressedArray {
+        Element *element;
+        size_t index;
+        uint32_t length;
+    };
+
+    // collect all compressed arrays, they can only be found in data tokens
+    std::vector<CompressedArray> arrays;
+    std::vector<const Scope*> scopes(1, root);
+    while (!scopes.empty()) {
+        const Scope *scope = scopes.back();
+        scopes.pop_back();
+
+        for (const ElementMap::value_type &entry : scope->Elements()) {
+            Element *element = entry.second;
+            if (element->Compound()) {
+                scopes.push_back(element->Compound());
+            }
+
+            for (size_t i = 0; i < element->tokens.size(); ++i) {
+                const Token &token = *element->tokens[i];
+                const char *data = token.begin();
+                if (!token.IsBinary() || token.end() - data < 13) {
+                    continue;
+                }
+
+                uint32_t stride = 0;
+                switch (*data) {
+                case 'f':
+                case 'i':
+                    stride = 4;
+                    break;
+                case 'd':
+                case 'l':
+                    stride = 8;
+                    break;
+                default:
+                    continue;
+                }
+
+                BE_NCONST uint32_t count = SafeParse<uint32_t>(data + 1, token.end());
+                AI_SWAP4(count);
+                BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data + 5, token.end());
+                AI_SWAP4(encmode);
+                if (encmode != 1 || !count) {
+                    continue;
+                }
+
+                // the inflated header stores the length as uint32 again, so
+                // arrays beyond that can't be represented
+                const uint64_t length = static_cast<uint64_t>(count) * stride;
+                if (length > std::numeric_limits<uint32_t>::max()) {
+                    ParseError("binary data array is too large", token);
+                }
+                arrays.push_back(CompressedArray{ element, i, static_cast<uint32_t>(length) });
+            }
+        }
+    }
+
+    if (arrays.empty()) {
+        return;
+    }
+    ASSIMP_LOG_DEBUG("Inflating ", arrays.size(), " FBX arrays on ", pool.GetNumThreads(), " threads");
+
+    // every array is inflated behind a header describing an uncompressed
+    // array, so the ParseVectorDataArray() functions don't need to know
+    static const size_t header_length = 13;
+    inflated.resize(arrays.size());
+    pool.ParallelFor(arrays.size(), [&](size_t a) {
+        const CompressedArray &array = arrays[a];
+        const Token &token = *array.element->tokens[array.index];
+        std::vector<char> &buff = inflated[a];
+        buff.resize(header_length + array.length);
+
+        // type code and element count stay the same
+        ::memcpy(buff.data(), token.begin(), 5);
+        BE_NCONST uint32_t encmode = 0, length = array.length;
+        AI_SWAP4(encmode);
+        AI_SWAP4(length);
+        ::memcpy(buff.data() + 5, &encmode, 4);
+        ::memcpy(buff.data() + 9, &length, 4);
+
+        const char *data = token.begin() + header_length;
+        if (data == token.end()) {
+            ParseError("binary data array is missing its compressed data", token);
+        }
+        Compression compress;
+        if (!compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
+            ParseError("failed to initialize decompression of binary data array", token);
+        }
+        const size_t unused = compress.decompress(data, static_cast<size_t>(token.end() - data), buff.data() + header_length, array.length);
+        compress.close();
+        if (unused != 0) {
+            ParseError("decompressed binary data array is shorter than its element count", token);
+        }
+    });
+
+    for (size_t a = 0; a < arrays.size(); ++a) {
+        const CompressedArray &array = arrays[a];
+        TokenPtr &token = array.element->tokens[array.index];
+        const char *begin = inflated[a].data();
+        const size_t offset = token->Offset();
+        token = new (allocator.Allocate(sizeof(Token))) Token(begin, begin + inflated[a].size(), TokenType_DATA, offset);
+        inflated_tokens.push_back(token);
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
 TokenPtr Parser::AdvanceToNextToken()
 {
     last = current;
-    if (cursor == tokens.end()) {
+    if (tokenizer) {
+        current = tokenizer->Next();
+    } else if (cursor == tokens.end()) {
         current = nullptr;
     } else {
         current = *cursor++;
@@ -57,6 +57,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXTokenizer.h"
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace FBX {
 
 class Scope;
@@ -102,6 +105,8 @@ public:
     }
 
 private:
+    friend class Parser;
+
     const Token& key_token;
     TokenList tokens;
     Scope* compound;
@@ -160,6 +165,10 @@ public:
     /** Parse given a token list. Does not take ownership of the tokens -
      *  the objects must persist during the entire parser lifetime */
     Parser(const TokenList &tokens, StackAllocator &allocator, bool is_binary);
+
+    /** Parse binary FBX, pulling the tokens from the tokenizer as needed.
+     *  The tokenizer must persist during the entire parser lifetime */
+    Parser(BinaryTokenizer &tokenizer, StackAllocator &allocator);
     ~Parser();
 
     const Scope& GetRootScope() const {
@@ -174,6 +183,11 @@ public:
         return allocator;
     }
 
+    /** Inflate all zlib-compressed binary data arrays of the DOM in parallel.
+     *  The data tokens are replaced by tokens referring to the uncompressed
+     *  arrays, which are kept until the parser is destroyed. */
+    void InflateBinaryArrays(ThreadPool &pool);
+
 private:
     friend class Scope;
     friend class Element;
@@ -184,12 +198,17 @@ private:
 
 private:
     const TokenList& tokens;
+    BinaryTokenizer *tokenizer;
     StackAllocator &allocator;
     TokenPtr last, current;
     TokenList::const_iterator cursor;
     Scope *root;
 
     const bool is_binary;
+
+    // storage of the arrays inflated by InflateBinaryArrays()
+    std::vector<std::vector<char>> inflated;
+    std::vector<TokenPtr> inflated_tokens;
 };
 
 
@@ -182,6 +182,82 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
 void TokenizeBinary(TokenList &output_tokens, const char *input, size_t length, StackAllocator &tokenAllocator);
 
 
+/** Pull-based tokenizer for binary FBX files.
+ *
+ *  Emits the same tokens as TokenizeBinary(), but one at a time as the
+ *  parser requests them, so the full token list is never materialized.
+ *  Keys and data tokens are allocated from the token allocator because the
+ *  DOM keeps referencing them. Commas and brackets are only looked at by the
+ *  parser, with transient punctuation they live in a small ring buffer and
+ *  are overwritten a few tokens later.
+ *
+ *  Data tokens are views into the input buffer, arrays are decoded only
+ *  when the DOM requests them. */
+class BinaryTokenizer {
+public:
+    /** @param input Binary input buffer, must outlive all tokens.
+     *  @param length Length of input buffer, in bytes.
+     *  @param transientPunctuation Reuse the storage of comma and bracket tokens.
+     *  @throw DeadlyImportError if the file header is invalid */
+    BinaryTokenizer(const char *input, size_t length, StackAllocator &tokenAllocator, bool transientPunctuation = true);
+    ~BinaryTokenizer();
+
+    BinaryTokenizer(const BinaryTokenizer &) = delete;
+    BinaryTokenizer &operator=(const BinaryTokenizer &) = delete;
+
+    /** Returns the next token or nullptr once the end of the input is reached.
+     *  @throw DeadlyImportError if something goes wrong */
+    TokenPtr Next();
+
+private:
+    TokenPtr ReadNext();
+    TokenPtr Persistent(const char *sbegin, const char *send, TokenType type);
+    TokenPtr Punctuation(TokenType type);
+
+    enum State {
+        State_Scope,
+        State_Properties,
+        State_Done
+    };
+
+    // Enclosing nested scope, i.e. one which has been opened with a bracket
+    struct NestedScope {
+        uint64_t end_offset;
+    };
+
+    static const unsigned int NumTransientTokens = 4;
+
+    const char *const input;
+    const char *const end;
+    const char *cursor;
+    StackAllocator &token_allocator;
+    const bool transient_punctuation;
+    uint32_t version;
+    bool is64bits;
+    size_t sentinel_block_length;
+
+    State state;
+    std::vector<NestedScope> scopes;
+
+    // the scope whose properties are being read
+    uint64_t scope_end_offset;
+    uint64_t props_left;
+    const char *props_begin;
+    const char *props_end;
+    bool pending_comma;
+
+    Token *transient[NumTransientTokens];
+    alignas(Token) unsigned char transient_storage[NumTransientTokens][sizeof(Token)];
+    unsigned int next_transient;
+
+#ifdef DEBUG
+    // tokens own a string copy in debug builds. With transient punctuation
+    // nobody else keeps a list of them, so the tokenizer destroys them.
+    TokenList persistent_tokens;
+#endif
+};
+
+
 } // ! FBX
 } // ! Assimp
 
@@ -819,6 +819,7 @@ bool ProcessGeometricItem(const Schema_2x3::IfcRepresentationItem& geo,
         mesh->mMaterialIndex = matid;
         mesh_indices.insert(static_cast<unsigned int>(conv.meshes.size()));
         conv.meshes.push_back(mesh);
+        conv.mesh_origins.emplace_back(&geo, matid);
         return true;
     }
     return false;
@@ -58,6 +58,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "../STEPParser/STEPFileReader.h"
+#include "Common/ThreadPool.h"
 #include "IFCLoader.h"
 
 #include "IFCUtil.h"
@@ -140,6 +141,8 @@ void IFCImporter::SetupProperties(const Importer *pImp) {
     settings.conicSamplingAngle = std::min(std::max((float)pImp->GetPropertyFloat(AI_CONFIG_IMPORT_IFC_SMOOTHING_ANGLE, AI_IMPORT_IFC_DEFAULT_SMOOTHING_ANGLE), 5.0f), 120.0f);
     settings.cylindricalTessellation = std::min(std::max(pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_CYLINDRICAL_TESSELLATION, AI_IMPORT_IFC_DEFAULT_CYLINDRICAL_TESSELLATION), 3), 180);
     settings.skipAnnotations = true;
+    settings.geometryThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_GEOMETRY_THREADS, 1)));
+    settings.parseThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_IFC_PARSE_THREADS, 1)));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -254,7 +257,7 @@ void IFCImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     };
 
     // feed the IFC schema into the reader and pre-parse all lines
-    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track);
+    STEP::ReadFile(*db, schema, types_to_track, inverse_indices_to_track, settings.parseThreads);
     const STEP::LazyObject *proj = db->GetObject("ifcproject");
     if (!proj) {
         ThrowException("missing IfcProject entity");
@@ -799,7 +802,12 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
         }
 
         if (!skipGeometry) {
-            ProcessProductRepresentation(el, nd, subnodes, conv);
+            if (conv.deferred_products && !conv.collect_openings && el.Representation) {
+                // openings are still collected right away as the parent element needs them
+                conv.deferred_products->push_back(DeferredProduct{ &el, nd, std::move(openings) });
+            } else {
+                ProcessProductRepresentation(el, nd, subnodes, conv);
+            }
             conv.apply_openings = conv.collect_openings = nullptr;
         }
 
@@ -821,6 +829,138 @@ aiNode *ProcessSpatialStructure(aiNode *parent, const Schema_2x3::IfcProduct &el
     return nd;
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int MergeMaterial(ConversionData &local, unsigned int index, const IFC::Schema_2x3::IfcSurfaceStyle *style, ConversionData &conv) {
+    aiMaterial *mat = local.materials[index];
+    local.materials[index] = nullptr;
+
+    if (style) {
+        ConversionData::MaterialCache::const_iterator it = conv.cached_materials.find(style);
+        if (it != conv.cached_materials.end()) {
+            delete mat;
+            return it->second;
+        }
+    } else {
+        // default materials are identified by their name, see ProcessMaterials()
+        aiString name;
+        mat->Get(AI_MATKEY_NAME, name);
+        for (size_t a = 0; a < conv.materials.size(); ++a) {
+            aiString mname;
+            conv.materials[a]->Get(AI_MATKEY_NAME, mname);
+            if (name == mname) {
+                delete mat;
+                return static_cast<unsigned int>(a);
+            }
+        }
+    }
+
+    conv.materials.push_back(mat);
+    const unsigned int matindex = static_cast<unsigned int>(conv.materials.size() - 1);
+    if (style) {
+        conv.cached_materials[style] = matindex;
+    }
+    return matindex;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RemapMeshes(aiNode *nd, const std::vector<unsigned int> &mesh_map) {
+    if (!nd->mNumMeshes) {
+        return;
+    }
+
+    std::set<unsigned int> meshes;
+    for (unsigned int i = 0; i < nd->mNumMeshes; ++i) {
+        meshes.insert(mesh_map[nd->mMeshes[i]]);
+    }
+
+    nd->mNumMeshes = static_cast<unsigned int>(meshes.size());
+    std::copy(meshes.begin(), meshes.end(), nd->mMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Generates the geometry of the products collected by ProcessSpatialStructure(). Each product
+// is converted with its own ConversionData, afterwards the meshes and materials are merged in
+// the order the products were encountered in, so the output does not depend on the scheduling.
+void ProcessDeferredProducts(std::vector<DeferredProduct> &products, ConversionData &conv) {
+    struct Result {
+        std::unique_ptr<ConversionData> conv;
+        std::vector<aiNode *> subnodes;
+    };
+    std::vector<Result> results(products.size());
+
+    try {
+        ThreadPool pool(conv.settings.geometryThreads);
+        pool.ParallelFor(products.size(), [&](size_t i) {
+            DeferredProduct &product = products[i];
+            Result &result = results[i];
+
+            result.conv.reset(new ConversionData(conv.db, conv.proj, conv.out, conv.settings));
+            ConversionData &local = *result.conv;
+            local.len_scale = conv.len_scale;
+            local.angle_scale = conv.angle_scale;
+            local.plane_angle_in_radians = conv.plane_angle_in_radians;
+            local.wcs = conv.wcs;
+            local.apply_openings = &product.openings;
+
+            ProcessProductRepresentation(*product.product, product.nd, result.subnodes, local);
+        });
+    } catch (...) {
+        for (Result &result : results) {
+            std::for_each(result.subnodes.begin(), result.subnodes.end(), delete_fun<aiNode>());
+        }
+        throw;
+    }
+
+    // a representation item shared by several products yields one mesh, as with the mesh cache
+    std::map<ConversionData::MeshCacheIndex, unsigned int> merged_meshes;
+
+    for (size_t i = 0; i < products.size(); ++i) {
+        ConversionData &local = *results[i].conv;
+
+        std::map<unsigned int, const IFC::Schema_2x3::IfcSurfaceStyle *> styles;
+        for (const ConversionData::MaterialCache::value_type &entry : local.cached_materials) {
+            styles[entry.second] = entry.first;
+        }
+
+        std::vector<unsigned int> material_map(local.materials.size());
+        for (unsigned int m = 0; m < local.materials.size(); ++m) {
+            std::map<unsigned int, const IFC::Schema_2x3::IfcSurfaceStyle *>::const_iterator it = styles.find(m);
+            material_map[m] = MergeMaterial(local, m, it != styles.end() ? it->second : nullptr, conv);
+        }
+        local.materials.clear();
+
+        std::vector<unsigned int> mesh_map(local.meshes.size());
+        for (size_t m = 0; m < local.meshes.size(); ++m) {
+            aiMesh *mesh = local.meshes[m];
+            if (mesh->mMaterialIndex < material_map.size()) {
+                mesh->mMaterialIndex = material_map[mesh->mMaterialIndex];
+            }
+
+            const ConversionData::MeshCacheIndex key(local.mesh_origins[m].item, mesh->mMaterialIndex);
+            std::map<ConversionData::MeshCacheIndex, unsigned int>::const_iterator it = merged_meshes.find(key);
+            if (it != merged_meshes.end()) {
+                mesh_map[m] = it->second;
+                delete mesh;
+                continue;
+            }
+
+            mesh_map[m] = static_cast<unsigned int>(conv.meshes.size());
+            merged_meshes[key] = mesh_map[m];
+            conv.meshes.push_back(mesh);
+        }
+        local.meshes.clear();
+
+        DeferredProduct &product = products[i];
+        std::vector<aiNode *> &subnodes = results[i].subnodes;
+        RemapMeshes(product.nd, mesh_map);
+        for (aiNode *nd : subnodes) {
+            RemapMeshes(nd, mesh_map);
+        }
+        product.nd->addChildren(static_cast<unsigned int>(subnodes.size()), subnodes.data());
+        subnodes.clear();
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 void ProcessSpatialStructures(ConversionData &conv) {
     // XXX add support for multiple sites (i.e. IfcSpatialStructureElements with composition == COMPLEX)
@@ -843,6 +983,11 @@ void ProcessSpatialStructures(ConversionData &conv) {
 
     std::vector<aiNode *> nodes;
 
+    std::vector<DeferredProduct> deferred_products;
+    if (conv.settings.geometryThreads != 1) {
+        conv.deferred_products = &deferred_products;
+    }
+
     for (const STEP::LazyObject *lz : *range) {
         const Schema_2x3::IfcSpatialStructureElement *const prod = lz->ToPtr<Schema_2x3::IfcSpatialStructureElement>();
         if (!prod) {
@@ -885,6 +1030,16 @@ void ProcessSpatialStructures(ConversionData &conv) {
         nb_nodes = nodes.size();
     }
 
+    conv.deferred_products = nullptr;
+    if (!deferred_products.empty()) {
+        try {
+            ProcessDeferredProducts(deferred_products, conv);
+        } catch (...) {
+            std::for_each(nodes.begin(), nodes.end(), delete_fun<aiNode>());
+            throw;
+        }
+    }
+
     if (nb_nodes == 1) {
         conv.out->mRootNode = nodes[0];
     } else if (nb_nodes > 1) {
@@ -77,13 +77,15 @@ public:
     // loader settings, publicly accessible via their corresponding AI_CONFIG constants
     struct Settings {
         Settings() :
-                skipSpaceRepresentations(), useCustomTriangulation(), skipAnnotations(), conicSamplingAngle(10.f), cylindricalTessellation(32) {}
+                skipSpaceRepresentations(), useCustomTriangulation(), skipAnnotations(), conicSamplingAngle(10.f), cylindricalTessellation(32), geometryThreads(1), parseThreads(1) {}
 
         bool skipSpaceRepresentations;
         bool useCustomTriangulation;
         bool skipAnnotations;
         float conicSamplingAngle;
         int cylindricalTessellation;
+        unsigned int geometryThreads;
+        unsigned int parseThreads;
     };
 
     IFCImporter() = default;
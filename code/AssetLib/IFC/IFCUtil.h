@@ -164,6 +164,18 @@ struct TempOpening
 };
 
 
+// ------------------------------------------------------------------------------------------------
+// A product whose geometry is generated after the node graph has been built. The node
+// belongs to the graph already, the openings are those which need to be cut from it.
+// ------------------------------------------------------------------------------------------------
+struct DeferredProduct
+{
+    const IFC::Schema_2x3::IfcProduct *product;
+    aiNode *nd;
+    std::vector<TempOpening> openings;
+};
+
+
 // ------------------------------------------------------------------------------------------------
 // Intermediate data storage during conversion. Keeps everything and a bit more.
 // ------------------------------------------------------------------------------------------------
@@ -178,6 +190,7 @@ struct ConversionData
         , settings(settings)
         , apply_openings()
         , collect_openings()
+        , deferred_products()
     {}
 
     ~ConversionData() {
@@ -206,6 +219,9 @@ struct ConversionData
     typedef std::map<MeshCacheIndex, std::set<unsigned int> > MeshCache;
     MeshCache cached_meshes;
 
+    // representation item and material each entry in 'meshes' was generated from
+    std::vector<MeshCacheIndex> mesh_origins;
+
     typedef std::map<const IFC::Schema_2x3::IfcSurfaceStyle*, unsigned int> MaterialCache;
     MaterialCache cached_materials;
 
@@ -220,6 +236,10 @@ struct ConversionData
     std::vector<TempOpening>* apply_openings;
     std::vector<TempOpening>* collect_openings;
 
+    // if present, the geometry of products is not generated during the traversal
+    // of the spatial structure but collected here and generated in parallel later.
+    std::vector<DeferredProduct>* deferred_products;
+
     std::set<uint64_t> already_processed;
 };
 
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "IRRLoader.h"
 #include "Common/Importer.h"
+#include "Material/MaterialSystem.h"
 
 #include <assimp/GenericProperty.h>
 #include <assimp/MathFunctions.h>
@@ -590,13 +591,11 @@ void SetupMapping(aiMaterial *mat, aiTextureMapping mode, const aiVector3D &axis
 
     // rebuild the output array
     if (p.size() > mat->mNumAllocated) {
-        delete[] mat->mProperties;
-        mat->mProperties = new aiMaterialProperty *[p.size() * 2];
-
-        mat->mNumAllocated = static_cast<unsigned int>(p.size() * 2);
+        ReserveMaterialProperties(mat, static_cast<unsigned int>(p.size() * 2));
     }
     mat->mNumProperties = (unsigned int)p.size();
     ::memcpy(mat->mProperties, &p[0], sizeof(void *) * mat->mNumProperties);
+    InvalidateMaterialPropertyIndex(mat);
 }
 
 // ------------------------------------------------------------------------------------------------
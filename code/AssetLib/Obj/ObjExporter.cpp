@@ -60,50 +60,38 @@ namespace Assimp {
 // ------------------------------------------------------------------------------------------------
 // Worker function for exporting a scene to Wavefront OBJ. Prototyped and registered in Exporter.cpp
 void ExportSceneObj(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene, const ExportProperties* props) {
-    // invoke the exporter
-    ObjExporter exporter(pFile, pScene, false, props);
-
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
+    // the main OBJ file and the material script are written while they are generated
+    ExportOutputFile outfile (pIOSystem, pFile, "wt");
+    if (outfile.Get() == nullptr) {
+        throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
     }
-
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
-    {
-        std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-        if (outfile == nullptr) {
-            throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
-        }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
-    }
-    {
-        std::unique_ptr<IOStream> outfile (pIOSystem->Open(exporter.GetMaterialLibFileName(),"wt"));
-        if (outfile == nullptr) {
-            throw DeadlyExportError("could not open output .mtl file: " + std::string(exporter.GetMaterialLibFileName()));
-        }
-        outfile->Write( exporter.mOutputMat.str().c_str(), static_cast<size_t>(exporter.mOutputMat.tellp()),1);
+    const std::string mtlFile = ObjExporter::GetMaterialLibFileName(pFile);
+    ExportOutputFile mtlfile (pIOSystem, mtlFile, "wt");
+    if (mtlfile.Get() == nullptr) {
+        throw DeadlyExportError("could not open output .mtl file: " + mtlFile);
     }
+
+    // invoke the exporter
+    ObjExporter exporter(pFile, pScene, outfile.Get(), mtlfile.Get(), false, props);
+    exporter.mOutput.Flush();
+    exporter.mOutputMat.Flush();
+    outfile.Commit();
+    mtlfile.Commit();
 }
 
 // ------------------------------------------------------------------------------------------------
 // Worker function for exporting a scene to Wavefront OBJ without the material file. Prototyped and registered in Exporter.cpp
 void ExportSceneObjNoMtl(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene, const ExportProperties* props) {
-    // invoke the exporter
-    ObjExporter exporter(pFile, pScene, true, props);
-
-    if (exporter.mOutput.fail() || exporter.mOutputMat.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
+    // the OBJ file is written while it is generated
+    ExportOutputFile outfile (pIOSystem, pFile, "wt");
+    if (outfile.Get() == nullptr) {
+        throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
     }
 
-    // we're still here - export successfully completed. Write both the main OBJ file and the material script
-    {
-        std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-        if (outfile == nullptr) {
-            throw DeadlyExportError("could not open output .obj file: " + std::string(pFile));
-        }
-        outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
-    }
-
-
+    // invoke the exporter
+    ObjExporter exporter(pFile, pScene, outfile.Get(), nullptr, true, props);
+    exporter.mOutput.Flush();
+    outfile.Commit();
 }
 
 } // end of namespace Assimp
@@ -111,8 +99,11 @@ void ExportSceneObjNoMtl(const char* pFile,IOSystem* pIOSystem, const aiScene* p
 static const std::string MaterialExt = ".mtl";
 
 // ------------------------------------------------------------------------------------------------
-ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMtl, const ExportProperties* props)
-: filename(_filename)
+ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, IOStream* pStream, IOStream* pMtlStream,
+        bool noMtl, const ExportProperties* props)
+: mOutput(pStream)
+, mOutputMat(pMtlStream)
+, filename(_filename)
 , pScene(pScene)
 , vn()
 , vt()
@@ -123,12 +114,8 @@ ObjExporter::ObjExporter(const char* _filename, const aiScene* pScene, bool noMt
 , mVpMap()
 , mMeshes()
 , endl("\n") {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    const std::locale& l = std::locale("C");
-    mOutput.imbue(l);
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
-    mOutputMat.imbue(l);
-    mOutputMat.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
+    mOutput.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
+    mOutputMat.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
 
     WriteGeometryFile(
         noMtl,
@@ -156,17 +143,22 @@ std::string ObjExporter::GetMaterialLibName() {
 
 // ------------------------------------------------------------------------------------------------
 std::string ObjExporter::GetMaterialLibFileName() {
+    return GetMaterialLibFileName(filename);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ObjExporter::GetMaterialLibFileName(const std::string& objFile) {
     // Remove existing .obj file extension so that the final material file name will be fileName.mtl and not fileName.obj.mtl
-    size_t lastdot = filename.find_last_of('.');
+    size_t lastdot = objFile.find_last_of('.');
     if ( lastdot != std::string::npos ) {
-        return filename.substr( 0, lastdot ) + MaterialExt;
+        return objFile.substr( 0, lastdot ) + MaterialExt;
     }
 
-    return filename + MaterialExt;
+    return objFile + MaterialExt;
 }
 
 // ------------------------------------------------------------------------------------------------
-void ObjExporter::WriteHeader(std::ostringstream& out) {
+void ObjExporter::WriteHeader(TextStreamWriter& out) {
     out << "# File produced by Open Asset Import Library (http://www.assimp.sf.net)" << endl;
     out << "# (assimp v" << aiGetVersionMajor() << '.' << aiGetVersionMinor() << '.'
         << aiGetVersionRevision() << ")" << endl  << endl;
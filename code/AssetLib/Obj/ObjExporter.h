@@ -47,11 +47,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_OBJEXPORTER_H_INC
 
 #include <assimp/types.h>
-#include <sstream>
 #include <vector>
 #include <map>
 
 #include <assimp/Exporter.hpp>
+#include "Common/TextStreamWriter.h"
 
 struct aiScene;
 struct aiNode;
@@ -65,13 +65,15 @@ namespace Assimp {
 class ObjExporter final {
 public:
     /// Constructor for a specific scene to export
-    ObjExporter(const char* filename, const aiScene* pScene, bool noMtl=false, const ExportProperties* props = nullptr);
+    ObjExporter(const char* filename, const aiScene* pScene, IOStream* pStream, IOStream* pMtlStream = nullptr,
+            bool noMtl=false, const ExportProperties* props = nullptr);
     ~ObjExporter();
     std::string GetMaterialLibName();
     std::string GetMaterialLibFileName();
+    static std::string GetMaterialLibFileName(const std::string& objFile);
 
-    /// public string-streams to write all output into
-    std::ostringstream mOutput, mOutputMat;
+    /// public buffered writers the output goes to while it is generated
+    TextStreamWriter mOutput, mOutputMat;
 
 private:
     // intermediate data structures
@@ -97,7 +99,7 @@ private:
         std::vector<Face> faces;
     };
 
-    void WriteHeader(std::ostringstream& out);
+    void WriteHeader(TextStreamWriter& out);
     void WriteMaterialFile();
     void WriteGeometryFile(bool noMtl=false, bool merge_identical_vertices = false);
     std::string GetMaterialName(unsigned int index);
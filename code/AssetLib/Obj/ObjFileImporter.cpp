@@ -44,6 +44,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileImporter.h"
 #include "ObjFileData.h"
 #include "ObjFileParser.h"
+#include "Common/ThreadPool.h"
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/IOStreamBuffer.h>
 #include <assimp/ai_assert.h>
@@ -52,6 +53,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 #include <assimp/ObjMaterial.h>
+#include <assimp/config.h>
+#include <algorithm>
 #include <memory>
 
 static constexpr aiImporterDesc desc = {
@@ -78,7 +81,8 @@ using namespace std;
 ObjFileImporter::ObjFileImporter() :
         m_Buffer(),
         m_pRootObject(nullptr),
-        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())) {
+        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())),
+        mParseThreads(1) {
     // empty
 }
 
@@ -95,6 +99,11 @@ bool ObjFileImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bo
     return BaseImporter::SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens), 200, false, true);
 }
 
+// ------------------------------------------------------------------------------------------------
+void ObjFileImporter::SetupProperties(const Importer *pImp) {
+    mParseThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARSE_THREADS, 1)));
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *ObjFileImporter::GetInfo() const {
     return &desc;
@@ -124,12 +133,6 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
-    streamedBuffer.open(fileStream.get());
-
-    // Allocate buffer and read file into it
-    //TextFileToBuffer( fileStream.get(),m_Buffer);
-
     // Get the model name
     std::string modelName, folderName;
     std::string::size_type pos = file.find_last_of("\\/");
@@ -143,16 +146,39 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         modelName = file;
     }
 
-    // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    if (mParseThreads != 1) {
+        // the parallel parser needs the whole file, use the mapped contents if possible
+        const char *data = reinterpret_cast<const char *>(fileStream->GetMappedData());
+        if (nullptr == data) {
+            m_Buffer.resize(fileSize);
+            if (fileStream->Read(m_Buffer.data(), 1, fileSize) != fileSize) {
+                throw DeadlyImportError("Failed to read file ", file, ".");
+            }
+            data = m_Buffer.data();
+        }
+
+        // parse the file into a temporary representation
+        ThreadPool pool(mParseThreads);
+        ObjFileParser parser(data, fileSize, modelName, pIOHandler, m_progress, file, pool);
+
+        // And create the proper return structures out of it
+        CreateDataFromImport(parser.GetModel(), pScene);
+    } else {
+        IOStreamBuffer<char> streamedBuffer;
+        streamedBuffer.open(fileStream.get());
+
+        // parse the file into a temporary representation
+        ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
 
-    // And create the proper return structures out of it
-    CreateDataFromImport(parser.GetModel(), pScene);
+        // And create the proper return structures out of it
+        CreateDataFromImport(parser.GetModel(), pScene);
 
-    streamedBuffer.close();
+        streamedBuffer.close();
+    }
 
     // Clean up allocated storage for the next import
     m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
 
     // Pop directory stack
     if (pIOHandler->StackSize() > 0) {
@@ -44,12 +44,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileData.h"
 #include "ObjFileMtlImporter.h"
 #include "ObjTools.h"
+#include "Common/ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -83,6 +85,32 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
         m_originalObjFileName(originalObjFileName) {
     std::fill_n(m_buffer, Buffersize, '\0');
 
+    createModel(modelName);
+
+    // Start parsing the file
+    parseFile(streamBuffer);
+}
+
+ObjFileParser::ObjFileParser(const char *data, size_t size, const std::string &modelName,
+        IOSystem *io, ProgressHandler *progress,
+        const std::string &originalObjFileName, ThreadPool &pool) :
+        m_DataIt(),
+        m_DataItEnd(),
+        m_pModel(nullptr),
+        m_uiLine(0),
+        m_buffer(),
+        m_pIO(io),
+        m_progress(progress),
+        m_originalObjFileName(originalObjFileName) {
+    std::fill_n(m_buffer, Buffersize, '\0');
+
+    createModel(modelName);
+
+    // Start parsing the file
+    parseFile(data, size, pool);
+}
+
+void ObjFileParser::createModel(const std::string &modelName) {
     // Create the model instance to store all the data
     m_pModel.reset(new ObjFile::Model());
     m_pModel->mModelName = modelName;
@@ -92,14 +120,12 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     m_pModel->mDefaultMaterial->MaterialName.Set(DEFAULT_MATERIAL);
     m_pModel->mMaterialLib.emplace_back(DEFAULT_MATERIAL);
     m_pModel->mMaterialMap[DEFAULT_MATERIAL] = m_pModel->mDefaultMaterial;
-
-    // Start parsing the file
-    parseFile(streamBuffer);
 }
 
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
     m_DataIt = buffer.begin();
     m_DataItEnd = buffer.end();
+    mEnd = buffer.data() + buffer.size();
 }
 
 ObjFile::Model *ObjFileParser::GetModel() const {
@@ -117,9 +143,7 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
     bool insideCstype = false;
     std::vector<char> buffer;
     while (streamBuffer.getNextDataLine(buffer, '\\')) {
-        m_DataIt = buffer.begin();
-        m_DataItEnd = buffer.end();
-        mEnd = &buffer[buffer.size() - 1] + 1;
+        setBuffer(buffer);
 
         // Handle progress reporting
         const size_t filePos(streamBuffer.getFilePos());
@@ -129,127 +153,396 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
             m_progress->UpdateFileRead(processed, progressTotal);
         }
 
-        // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
-        if (insideCstype) {
-            switch (*m_DataIt) {
-            case 'e': {
-                std::string name;
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
-                insideCstype = name != "end";
-            } break;
+        parseLine(insideCstype);
+    }
+}
+
+// -------------------------------------------------------------------
+//  Minimum number of bytes parsed by one chunk.
+static constexpr size_t MinChunkSize = 64 * 1024;
+
+// -------------------------------------------------------------------
+//  The data of one chunk of a file parsed in parallel. Vertex data goes
+//  to the model of the chunk, all other lines are recorded in order and
+//  are replayed on the model of the file once all chunks are done.
+struct ObjFileParser::Chunk {
+    struct Statement {
+        /// Offset of the line in the file
+        size_t mOffset;
+        /// Number of vertices, texture coordinates and normals in the chunk before the line
+        unsigned int mNumVertices;
+        unsigned int mNumTexCoords;
+        unsigned int mNumNormals;
+        /// Face, line or point statement
+        bool mIsFace;
+        /// The parsed face has normals
+        bool mHasNormal;
+        /// The parsed face, nullptr for empty faces
+        std::unique_ptr<ObjFile::Face> mFace;
+    };
+
+    /// Range of the chunk in the file
+    size_t mBegin;
+    size_t mEnd;
+    /// Vertex data of the chunk
+    std::unique_ptr<ObjFile::Model> mModel;
+    /// All lines which are no vertex data
+    std::vector<Statement> mStatements;
+    /// Number of vertices, texture coordinates and normals in the chunks before
+    unsigned int mVertexBase = 0;
+    unsigned int mTexCoordBase = 0;
+    unsigned int mNormalBase = 0;
+    /// The chunk ends inside of a cstype section
+    bool mEndsInsideCstype = false;
+};
+
+// -------------------------------------------------------------------
+//  Copies the next line of [it, end) to line like IOStreamBuffer::getNextDataLine()
+//  does: lines continued with a '\' are joined and the line end is consumed.
+static bool getNextDataLine(const char *&it, const char *end, std::vector<char> &line) {
+    if (it >= end) {
+        return false;
+    }
+
+    line.clear();
+    while (it != end) {
+        if (*it == '\\' && it + 1 != end && IsLineEnd(it[1])) {
+            while (it != end && *it != '\n') {
+                ++it;
             }
-            goto pf_skip_line;
+            if (it != end) {
+                ++it;
+            }
+            continue;
         }
+        if (IsLineEnd(*it)) {
+            ++it;
+            break;
+        }
+        line.push_back(*it);
+        ++it;
+    }
+    line.push_back('\n');
+    line.push_back('\0');
 
-        // parse line
-        switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
-            ++m_DataIt;
-            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(m_pModel->mVertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(m_pModel->mVertices);
-                } else if (numComponents == 6) {
-                    // fill previous omitted vertex-colors by default
-                    if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                        m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                    }
-                    // read vertex and vertex-color
-                    getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
-                }
-                // append omitted vertex-colors as default for the end if any vertex-color exists
-                if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                    m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                }
-            } else if (*m_DataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++m_DataIt;
-                size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
-                m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
-            } else if (*m_DataIt == 'n') {
-                // Read in normal vector definition
-                ++m_DataIt;
-                getVector3(m_pModel->mNormals);
+    return true;
+}
+
+// -------------------------------------------------------------------
+//  Returns the offset of the first line at or behind pos which does not
+//  continue the line in front of it.
+static size_t findLineStart(const char *data, size_t size, size_t pos) {
+    while (pos < size) {
+        const char *lineEnd = static_cast<const char *>(::memchr(data + pos, '\n', size - pos));
+        if (nullptr == lineEnd) {
+            return size;
+        }
+
+        // the '\n' belongs to a line continuation if the line has a '\' in front of a line end
+        const char *lineStart = lineEnd;
+        while (lineStart != data && lineStart[-1] != '\n') {
+            --lineStart;
+        }
+        bool continued = false;
+        for (const char *it = lineStart; it != lineEnd; ++it) {
+            if (*it == '\\' && IsLineEnd(it[1])) {
+                continued = true;
+                break;
             }
-        } break;
+        }
+        pos = static_cast<size_t>(lineEnd - data) + 1;
+        if (!continued) {
+            return pos;
+        }
+    }
+    return size;
+}
 
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f': {
-            getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
+void ObjFileParser::parseFile(const char *data, size_t size, ThreadPool &pool) {
+    const size_t numChunks = std::max<size_t>(1, std::min<size_t>(pool.GetNumThreads() * 4, size / MinChunkSize));
+    std::vector<Chunk> chunks;
+    chunks.reserve(numChunks);
+    size_t begin = 0;
+    for (size_t i = 1; i <= numChunks && begin < size; ++i) {
+        const size_t end = i == numChunks ? size : findLineStart(data, size, std::max(begin, size / numChunks * i));
+        chunks.emplace_back();
+        chunks.back().mBegin = begin;
+        chunks.back().mEnd = end;
+        begin = end;
+    }
 
-        case '#': // Parse a comment
-        {
-            getComment();
-        } break;
+    pool.ParallelFor(chunks.size(), [&](size_t i) {
+        parseChunk(data, chunks[i]);
+    });
 
-        case 'u': // Parse a material desc. setter
-        {
-            std::string name;
+    // the chunks assume that they do not start inside of a cstype section,
+    // otherwise parse the file again in one go
+    bool valid = true;
+    for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+        valid = valid && !chunks[i].mEndsInsideCstype;
+    }
+    if (!valid) {
+        ASSIMP_LOG_WARN("OBJ: cstype section spans a chunk boundary, parsing on one thread");
+        chunks.resize(1);
+        chunks[0].mBegin = 0;
+        chunks[0].mEnd = size;
+        chunks[0].mStatements.clear();
+        parseChunk(data, chunks[0]);
+    }
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    // relative indices of the faces refer to the vertex data of all chunks before
+    size_t numVertices = 0, numTexCoords = 0, numNormals = 0;
+    bool hasVertexColors = false;
+    for (Chunk &chunk : chunks) {
+        chunk.mVertexBase = static_cast<unsigned int>(numVertices);
+        chunk.mTexCoordBase = static_cast<unsigned int>(numTexCoords);
+        chunk.mNormalBase = static_cast<unsigned int>(numNormals);
+        numVertices += chunk.mModel->mVertices.size();
+        numTexCoords += chunk.mModel->mTextureCoord.size();
+        numNormals += chunk.mModel->mNormals.size();
+        hasVertexColors = hasVertexColors || !chunk.mModel->mVertexColors.empty();
+    }
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+    pool.ParallelFor(chunks.size(), [&](size_t i) {
+        parseChunkFaces(data, chunks[i]);
+    });
+
+    // stitch the vertex data
+    m_pModel->mVertices.reserve(numVertices);
+    m_pModel->mTextureCoord.reserve(numTexCoords);
+    m_pModel->mNormals.reserve(numNormals);
+    if (hasVertexColors) {
+        m_pModel->mVertexColors.reserve(numVertices);
+    }
+    for (Chunk &chunk : chunks) {
+        const ObjFile::Model &model = *chunk.mModel;
+        m_pModel->mVertices.insert(m_pModel->mVertices.end(), model.mVertices.begin(), model.mVertices.end());
+        m_pModel->mTextureCoord.insert(m_pModel->mTextureCoord.end(), model.mTextureCoord.begin(), model.mTextureCoord.end());
+        m_pModel->mNormals.insert(m_pModel->mNormals.end(), model.mNormals.begin(), model.mNormals.end());
+        if (hasVertexColors) {
+            // omitted vertex-colors are filled by default
+            m_pModel->mVertexColors.insert(m_pModel->mVertexColors.end(), model.mVertexColors.begin(), model.mVertexColors.end());
+            m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+        }
+        m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, model.mTextureCoordDim);
+        chunk.mModel.reset();
+    }
 
-            if (name == "usemtl") {
-                getMaterialDesc();
+    // replay all other lines in file order
+    bool insideCstype = false;
+    std::vector<char> line;
+    for (Chunk &chunk : chunks) {
+        for (Chunk::Statement &statement : chunk.mStatements) {
+            if (statement.mIsFace) {
+                if (statement.mFace) {
+                    storeFace(statement.mFace.release(), statement.mHasNormal);
+                }
+                continue;
             }
-        } break;
 
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
+            const char *it = data + statement.mOffset;
+            getNextDataLine(it, data + chunk.mEnd, line);
+            setBuffer(line);
+            parseLine(insideCstype);
+        }
+        chunk.mStatements.clear();
+        chunk.mStatements.shrink_to_fit();
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        m_progress->UpdateFileRead(static_cast<unsigned int>(chunk.mEnd), static_cast<unsigned int>(size));
+    }
+}
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+void ObjFileParser::parseChunk(const char *data, Chunk &chunk) {
+    ObjFileParser parser;
+    parser.m_pModel.reset(new ObjFile::Model());
+    const ObjFile::Model &model = *parser.m_pModel;
 
-            if (name == "mg")
-                getGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
+    bool insideCstype = false;
+    std::vector<char> line;
+    const char *it = data + chunk.mBegin, *end = data + chunk.mEnd;
+    while (it < end) {
+        const size_t offset = static_cast<size_t>(it - data);
+        getNextDataLine(it, end, line);
+        parser.setBuffer(line);
+
+        const char token = line[0];
+        if (insideCstype) {
+            if (token == 'e') {
+                std::string name;
+                getNameNoSpace(parser.m_DataIt, parser.m_DataItEnd, name);
+                insideCstype = name != "end";
+            }
+        } else if (token == 'v') {
+            parser.getVertexData();
+            continue;
+        } else if (token == '#' || IsLineEnd(token)) {
+            continue;
+        } else if (token == 'c') {
+            std::string name;
+            getNameNoSpace(parser.m_DataIt, parser.m_DataItEnd, name);
+            insideCstype = name == "cstype";
+        }
 
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
+        chunk.mStatements.emplace_back();
+        Chunk::Statement &statement = chunk.mStatements.back();
+        statement.mOffset = offset;
+        statement.mNumVertices = static_cast<unsigned int>(model.mVertices.size());
+        statement.mNumTexCoords = static_cast<unsigned int>(model.mTextureCoord.size());
+        statement.mNumNormals = static_cast<unsigned int>(model.mNormals.size());
+        statement.mIsFace = !insideCstype && (token == 'f' || token == 'l' || token == 'p');
+        statement.mHasNormal = false;
+    }
 
-        case 's': // Parse group number
-        {
-            getGroupNumber();
-        } break;
+    chunk.mEndsInsideCstype = insideCstype;
+    chunk.mModel = std::move(parser.m_pModel);
+}
 
-        case 'o': // Parse object name
-        {
-            getObjectName();
-        } break;
+void ObjFileParser::parseChunkFaces(const char *data, Chunk &chunk) {
+    ObjFileParser parser;
+    std::vector<char> line;
+    for (Chunk::Statement &statement : chunk.mStatements) {
+        if (!statement.mIsFace) {
+            continue;
+        }
+
+        const char *it = data + statement.mOffset;
+        getNextDataLine(it, data + chunk.mEnd, line);
+        parser.setBuffer(line);
 
-        case 'c': // handle cstype section start
-        {
+        const aiPrimitiveType type = line[0] == 'f' ? aiPrimitiveType_POLYGON : (line[0] == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT);
+        statement.mFace.reset(parser.parseFace(type,
+                static_cast<int>(chunk.mVertexBase + statement.mNumVertices),
+                static_cast<int>(chunk.mTexCoordBase + statement.mNumTexCoords),
+                static_cast<int>(chunk.mNormalBase + statement.mNumNormals),
+                statement.mHasNormal));
+    }
+}
+
+void ObjFileParser::parseLine(bool &insideCstype) {
+    // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
+    if (insideCstype) {
+        switch (*m_DataIt) {
+        case 'e': {
             std::string name;
             getNameNoSpace(m_DataIt, m_DataItEnd, name);
-            insideCstype = name == "cstype";
-            goto pf_skip_line;
+            insideCstype = name != "end";
+        } break;
         }
+        goto pf_skip_line;
+    }
 
-        default: {
-        pf_skip_line:
-            m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
-        } break;
+    // parse line
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex texture coordinate
+    {
+        getVertexData();
+    } break;
+
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
+
+    case '#': // Parse a comment
+    {
+        getComment();
+    } break;
+
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "usemtl") {
+            getMaterialDesc();
         }
+    } break;
+
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "mg")
+            getGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
+            goto pf_skip_line;
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        getGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    case 'c': // handle cstype section start
+    {
+        std::string name;
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        insideCstype = name == "cstype";
+        goto pf_skip_line;
+    }
+
+    default: {
+    pf_skip_line:
+        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    } break;
+    }
+}
+
+void ObjFileParser::getVertexData() {
+    ++m_DataIt;
+    if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+        size_t numComponents = getNumComponentsInDataDefinition();
+        if (numComponents == 3) {
+            // read in vertex definition
+            getVector3(m_pModel->mVertices);
+        } else if (numComponents == 4) {
+            // read in vertex definition (homogeneous coords)
+            getHomogeneousVector3(m_pModel->mVertices);
+        } else if (numComponents == 6) {
+            // fill previous omitted vertex-colors by default
+            if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+                m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+            }
+            // read vertex and vertex-color
+            getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
+        }
+        // append omitted vertex-colors as default for the end if any vertex-color exists
+        if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+            m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+        }
+    } else if (*m_DataIt == 't') {
+        // read in texture coordinate ( 2D or 3D )
+        ++m_DataIt;
+        size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
+        m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
+    } else if (*m_DataIt == 'n') {
+        // Read in normal vector definition
+        ++m_DataIt;
+        getVector3(m_pModel->mNormals);
     }
 }
 
@@ -316,28 +609,28 @@ size_t ObjFileParser::getNumComponentsInDataDefinition() {
     return numComponents;
 }
 
-size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
-    size_t numComponents = getNumComponentsInDataDefinition();
-    ai_real x, y, z;
-    if (2 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
-
-        copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
-        z = 0.0;
-    } else if (3 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
+void ObjFileParser::getFloats(ai_real *values, size_t count) {
+    // plain numbers are parsed in one batch, anything else word by word
+    size_t parsed = 0;
+    const char *begin = &*m_DataIt;
+    const char *next = fast_atoreal_batch<ai_real>(begin, mEnd, values, count, parsed, false);
+    m_DataIt += next - begin;
 
+    for (size_t i = parsed; i < count; ++i) {
         copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
+        values[i] = (ai_real)fast_atof(m_buffer);
+    }
+}
 
-        copyNextWord(m_buffer, Buffersize);
-        z = (ai_real)fast_atof(m_buffer);
+size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
+    size_t numComponents = getNumComponentsInDataDefinition();
+    ai_real values[3] = { 0.0, 0.0, 0.0 };
+    if (2 == numComponents || 3 == numComponents) {
+        getFloats(values, numComponents);
     } else {
         throw DeadlyImportError("OBJ: Invalid number of components");
     }
+    ai_real x = values[0], y = values[1], z = values[2];
 
     // Coerce nan and inf to 0 as is the OBJ default value
     if (!std::isfinite(x))
@@ -355,33 +648,17 @@ size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array)
 }
 
 void ObjFileParser::getVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
+    ai_real values[3];
+    getFloats(values, 3);
 
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(values[0], values[1], values[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getHomogeneousVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z, w;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    w = (ai_real)fast_atof(m_buffer);
+    ai_real values[4];
+    getFloats(values, 4);
+    const ai_real x = values[0], y = values[1], z = values[2], w = values[3];
 
     if (w == 0)
         throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
@@ -391,41 +668,20 @@ void ObjFileParser::getHomogeneousVector3(std::vector<aiVector3D> &point3d_array
 }
 
 void ObjFileParser::getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
+    ai_real values[6];
+    getFloats(values, 6);
 
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_a.emplace_back(x, y, z);
-
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_b.emplace_back(x, y, z);
+    point3d_array_a.emplace_back(values[0], values[1], values[2]);
+    point3d_array_b.emplace_back(values[3], values[4], values[5]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
-    ai_real x, y;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
+    ai_real values[2];
+    getFloats(values, 2);
 
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    point2d_array.emplace_back(x, y);
+    point2d_array.emplace_back(values[0], values[1]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
@@ -433,20 +689,28 @@ void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
 static constexpr char DefaultObjName[] = "defaultobject";
 
 void ObjFileParser::getFace(aiPrimitiveType type) {
+    bool hasNormal = false;
+    ObjFile::Face *face = parseFace(type,
+            static_cast<unsigned int>(m_pModel->mVertices.size()),
+            static_cast<unsigned int>(m_pModel->mTextureCoord.size()),
+            static_cast<unsigned int>(m_pModel->mNormals.size()),
+            hasNormal);
+    if (nullptr != face) {
+        storeFace(face, hasNormal);
+    }
+}
+
+ObjFile::Face *ObjFileParser::parseFace(aiPrimitiveType type, int vSize, int vtSize, int vnSize, bool &hasNormal) {
+    hasNormal = false;
     m_DataIt = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
     if (m_DataIt == m_DataItEnd || *m_DataIt == '\0') {
-        return;
+        return nullptr;
     }
 
     ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
-
-    const int vSize = static_cast<unsigned int>(m_pModel->mVertices.size());
-    const int vtSize = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
-    const int vnSize = static_cast<unsigned int>(m_pModel->mNormals.size());
 
-    const bool vt = (!m_pModel->mTextureCoord.empty());
-    const bool vn = (!m_pModel->mNormals.empty());
+    const bool vt = (vtSize > 0);
+    const bool vn = (vnSize > 0);
     int iPos = 0;
     while (m_DataIt < m_DataItEnd) {
         int iStep = 1;
@@ -529,9 +793,15 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         // skip line and clean up
         m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
         delete face;
-        return;
+        return nullptr;
     }
 
+    // Skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    return face;
+}
+
+void ObjFileParser::storeFace(ObjFile::Face *face, bool hasNormal) {
     // Set active material, if one set
     if (nullptr != m_pModel->mCurrentMaterial) {
         face->m_pMaterial = m_pModel->mCurrentMaterial;
@@ -556,8 +826,6 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     if (!m_pModel->mCurrentMesh->m_hasNormals && hasNormal) {
         m_pModel->mCurrentMesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getMaterialDesc() {
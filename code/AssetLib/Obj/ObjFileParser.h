@@ -59,6 +59,7 @@ namespace Assimp {
 class ObjFileImporter;
 class IOSystem;
 class ProgressHandler;
+class ThreadPool;
 
 // ------------------------------------------------------------------------------------------------
 /// \class  ObjFileParser
@@ -75,6 +76,10 @@ public:
     ObjFileParser();
     /// @brief  Constructor with data array.
     ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @brief  Constructor with the complete file in memory, which is parsed in
+    ///         newline-aligned chunks on the given thread pool.
+    ObjFileParser(const char *data, size_t size, const std::string &modelName, IOSystem *io, ProgressHandler *progress,
+            const std::string &originalObjFileName, ThreadPool &pool);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -88,10 +93,16 @@ public:
 protected:
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse a file in memory, the chunks are parsed in parallel.
+    void parseFile(const char *data, size_t size, ThreadPool &pool);
+    /// Parse the line in the current buffer.
+    void parseLine(bool &insideCstype);
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
     /// Get the number of components in a line.
     size_t getNumComponentsInDataDefinition();
+    /// Reads the following count floats of the current line.
+    void getFloats(ai_real *values, size_t count);
     /// Stores the vector
     size_t getTexCoordVector(std::vector<aiVector3D> &point3d_array);
     /// Stores the following 3d vector.
@@ -102,8 +113,15 @@ protected:
     void getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b);
     /// Stores the following 3d vector.
     void getVector2(std::vector<aiVector2D> &point2d_array);
+    /// Stores the vertex data of a line starting with 'v'.
+    void getVertexData();
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Parses the following face, the sizes are the number of vertices, texture
+    /// coordinates and normals defined so far. Returns nullptr for an empty face.
+    ObjFile::Face *parseFace(aiPrimitiveType type, int vSize, int vtSize, int vnSize, bool &hasNormal);
+    /// Assigns a parsed face to the current mesh.
+    void storeFace(ObjFile::Face *face, bool hasNormal);
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
@@ -132,6 +150,14 @@ protected:
     void reportErrorTokenInFace();
 
 private:
+    struct Chunk;
+    /// Parses the vertex data of a chunk and records all other lines.
+    void parseChunk(const char *data, Chunk &chunk);
+    /// Parses the faces recorded for a chunk.
+    void parseChunkFaces(const char *data, Chunk &chunk);
+    /// Creates the model with the default material.
+    void createModel(const std::string &modelName);
+
     /// Default material name
     static constexpr const char DEFAULT_MATERIAL[] = AI_DEFAULT_MATERIAL_NAME;
     //! Iterator to current position in buffer
@@ -61,33 +61,29 @@ template<> const char* type_of(double&) { return "double"; }
 // ------------------------------------------------------------------------------------------------
 // Worker function for exporting a scene to PLY. Prototyped and registered in Exporter.cpp
 void ExportScenePly(const char* pFile,IOSystem* pIOSystem, const aiScene* pScene, const ExportProperties* /*pProperties*/) {
-    // invoke the exporter
-    PlyExporter exporter(pFile, pScene);
-
-    if (exporter.mOutput.fail()) {
-        throw DeadlyExportError("output data creation failed. Most likely the file became too large: " + std::string(pFile));
-    }
-
-    // we're still here - export successfully completed. Write the file.
-    std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-    if (outfile == nullptr) {
+    // the output is written while it is generated
+    ExportOutputFile outfile (pIOSystem, pFile, "wt");
+    if (outfile.Get() == nullptr) {
         throw DeadlyExportError("could not open output .ply file: " + std::string(pFile));
     }
 
-    outfile->Write( exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()),1);
+    // invoke the exporter
+    PlyExporter exporter(pFile, pScene, outfile.Get());
+    exporter.mOutput.Flush();
+    outfile.Commit();
 }
 
 void ExportScenePlyBinary(const char* pFile, IOSystem* pIOSystem, const aiScene* pScene, const ExportProperties* /*pProperties*/) {
-    // invoke the exporter
-    PlyExporter exporter(pFile, pScene, true);
-
-    // we're still here - export successfully completed. Write the file.
-    std::unique_ptr<IOStream> outfile(pIOSystem->Open(pFile, "wb"));
-    if (outfile == nullptr) {
+    // the output is written while it is generated
+    ExportOutputFile outfile(pIOSystem, pFile, "wb");
+    if (outfile.Get() == nullptr) {
         throw DeadlyExportError("could not open output .ply file: " + std::string(pFile));
     }
 
-    outfile->Write(exporter.mOutput.str().c_str(), static_cast<size_t>(exporter.mOutput.tellp()), 1);
+    // invoke the exporter
+    PlyExporter exporter(pFile, pScene, outfile.Get(), true);
+    exporter.mOutput.Flush();
+    outfile.Commit();
 }
 
 #define PLY_EXPORT_HAS_NORMALS 0x1
@@ -96,12 +92,9 @@ void ExportScenePlyBinary(const char* pFile, IOSystem* pIOSystem, const aiScene*
 #define PLY_EXPORT_HAS_COLORS (PLY_EXPORT_HAS_TEXCOORDS << AI_MAX_NUMBER_OF_TEXTURECOORDS)
 
 // ------------------------------------------------------------------------------------------------
-PlyExporter::PlyExporter(const char* _filename, const aiScene* pScene, bool binary) : 
-        filename(_filename), endl("\n") {
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    const std::locale& l = std::locale("C");
-    mOutput.imbue(l);
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
+PlyExporter::PlyExporter(const char* _filename, const aiScene* pScene, IOStream* pStream, bool binary) :
+        mOutput(pStream), filename(_filename), endl("\n") {
+    mOutput.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
 
     unsigned int faces = 0u, vertices = 0u, components = 0u;
     for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
@@ -294,20 +287,20 @@ void PlyExporter::WriteMeshVertsBinary(const aiMesh* m, unsigned int components)
     aiVector2D defaultUV(-1, -1);
     aiColor4D defaultColor(-1, -1, -1, -1);
     for (unsigned int i = 0; i < m->mNumVertices; ++i) {
-        mOutput.write(reinterpret_cast<const char*>(&m->mVertices[i].x), 12);
+        mOutput.Write(reinterpret_cast<const char*>(&m->mVertices[i].x), 12);
         if (components & PLY_EXPORT_HAS_NORMALS) {
             if (m->HasNormals()) {
-                mOutput.write(reinterpret_cast<const char*>(&m->mNormals[i].x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&m->mNormals[i].x), 12);
             } else {
-                mOutput.write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
             }
         }
 
         for (unsigned int n = PLY_EXPORT_HAS_TEXCOORDS, c = 0; (components & n) && c != AI_MAX_NUMBER_OF_TEXTURECOORDS; n <<= 1, ++c) {
             if (m->HasTextureCoords(c)) {
-                mOutput.write(reinterpret_cast<const char*>(&m->mTextureCoords[c][i].x), 8);
+                mOutput.Write(reinterpret_cast<const char*>(&m->mTextureCoords[c][i].x), 8);
             } else {
-                mOutput.write(reinterpret_cast<const char*>(&defaultUV.x), 8);
+                mOutput.Write(reinterpret_cast<const char*>(&defaultUV.x), 8);
             }
         }
 
@@ -319,7 +312,7 @@ void PlyExporter::WriteMeshVertsBinary(const aiMesh* m, unsigned int components)
                     static_cast<unsigned char>(m->mColors[c][i].b * 255),
                     static_cast<unsigned char>(m->mColors[c][i].a * 255)
                 };
-                mOutput.write(reinterpret_cast<const char*>(&rgba), 4);
+                mOutput.Write(reinterpret_cast<const char*>(&rgba), 4);
             } else {
                 unsigned char rgba[4] = {
                     static_cast<unsigned char>(defaultColor.r * 255),
@@ -327,17 +320,17 @@ void PlyExporter::WriteMeshVertsBinary(const aiMesh* m, unsigned int components)
                     static_cast<unsigned char>(defaultColor.b * 255),
                     static_cast<unsigned char>(defaultColor.a * 255)
                 };
-                mOutput.write(reinterpret_cast<const char*>(&rgba), 4);
+                mOutput.Write(reinterpret_cast<const char*>(&rgba), 4);
             }
         }
 
         if (components & PLY_EXPORT_HAS_TANGENTS_BITANGENTS) {
             if (m->HasTangentsAndBitangents()) {
-                mOutput.write(reinterpret_cast<const char*>(&m->mTangents[i].x), 12);
-                mOutput.write(reinterpret_cast<const char*>(&m->mBitangents[i].x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&m->mTangents[i].x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&m->mBitangents[i].x), 12);
             } else {
-                mOutput.write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
-                mOutput.write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
+                mOutput.Write(reinterpret_cast<const char*>(&defaultNormal.x), 12);
             }
         }
     }
@@ -358,14 +351,14 @@ void PlyExporter::WriteMeshIndices(const aiMesh* m, unsigned int offset) {
 // ------------------------------------------------------------------------------------------------
 // Generic method in case we want to use different data types for the indices or make this configurable.
 template<typename NumIndicesType, typename IndexType>
-void WriteMeshIndicesBinary_Generic(const aiMesh* m, unsigned int offset, std::ostringstream& output) {
+void WriteMeshIndicesBinary_Generic(const aiMesh* m, unsigned int offset, TextStreamWriter& output) {
     for (unsigned int i = 0; i < m->mNumFaces; ++i) {
         const aiFace& f = m->mFaces[i];
         NumIndicesType numIndices = static_cast<NumIndicesType>(f.mNumIndices);
-        output.write(reinterpret_cast<const char*>(&numIndices), sizeof(NumIndicesType));
+        output.Write(reinterpret_cast<const char*>(&numIndices), sizeof(NumIndicesType));
         for (unsigned int c = 0; c < f.mNumIndices; ++c) {
             IndexType index = f.mIndices[c] + offset;
-            output.write(reinterpret_cast<const char*>(&index), sizeof(IndexType));
+            output.Write(reinterpret_cast<const char*>(&index), sizeof(IndexType));
         }
     }
 }
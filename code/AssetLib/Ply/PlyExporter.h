@@ -45,7 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_PLYEXPORTER_H_INC
 #define AI_PLYEXPORTER_H_INC
 
-#include <sstream>
+#include "Common/TextStreamWriter.h"
 
 struct aiScene;
 struct aiNode;
@@ -59,7 +59,7 @@ namespace Assimp {
 class PlyExporter {
 public:
     /// The class constructor for a specific scene to export
-    PlyExporter(const char* filename, const aiScene* pScene, bool binary = false);
+    PlyExporter(const char* filename, const aiScene* pScene, IOStream* pStream, bool binary = false);
     /// The class destructor, empty.
     ~PlyExporter() = default;
 
@@ -67,8 +67,8 @@ public:
     PlyExporter &operator = ( const PlyExporter & ) = delete;
 
 public:
-    /// public string-streams to write all output into:
-    std::ostringstream mOutput;
+    /// public buffered writer the output goes to while it is generated:
+    TextStreamWriter mOutput;
 
 private:
     void WriteMeshVerts(const aiMesh* m, unsigned int components);
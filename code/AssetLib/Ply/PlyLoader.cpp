@@ -102,6 +102,75 @@ namespace {
         return isBigEndian;
     }
 
+    // ------------------------------------------------------------------------------------------------
+    // Wrap a binary value for NormalizeColorValue
+    inline PLY::PropertyInstance::ValueUnion ToValueUnion(float v) {
+        PLY::PropertyInstance::ValueUnion out;
+        out.fFloat = v;
+        return out;
+    }
+
+    inline PLY::PropertyInstance::ValueUnion ToValueUnion(double v) {
+        PLY::PropertyInstance::ValueUnion out;
+        out.fDouble = v;
+        return out;
+    }
+
+    inline PLY::PropertyInstance::ValueUnion ToValueUnion(int32_t v) {
+        PLY::PropertyInstance::ValueUnion out;
+        out.iInt = v;
+        return out;
+    }
+
+    inline PLY::PropertyInstance::ValueUnion ToValueUnion(uint32_t v) {
+        PLY::PropertyInstance::ValueUnion out;
+        out.iUInt = v;
+        return out;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Invoke func(i, value) for a single property of count fixed-size records
+    template <typename T, typename Func>
+    inline void DecodeColumn(const char *data, unsigned int stride, unsigned int count, Func func) {
+        for (unsigned int i = 0; i < count; ++i, data += stride) {
+            T t;
+            ::memcpy(&t, data, sizeof(T));
+            func(i, t);
+        }
+    }
+
+    template <typename Func>
+    void DecodeColumn(const char *data, PLY::EDataType eType, unsigned int stride, unsigned int count, Func func) {
+        switch (eType) {
+        case EDT_Char:
+            DecodeColumn<int8_t>(data, stride, count, func);
+            break;
+        case EDT_UChar:
+            DecodeColumn<uint8_t>(data, stride, count, func);
+            break;
+        case EDT_Short:
+            DecodeColumn<int16_t>(data, stride, count, func);
+            break;
+        case EDT_UShort:
+            DecodeColumn<uint16_t>(data, stride, count, func);
+            break;
+        case EDT_Int:
+            DecodeColumn<int32_t>(data, stride, count, func);
+            break;
+        case EDT_UInt:
+            DecodeColumn<uint32_t>(data, stride, count, func);
+            break;
+        case EDT_Float:
+            DecodeColumn<float>(data, stride, count, func);
+            break;
+        case EDT_Double:
+            DecodeColumn<double>(data, stride, count, func);
+            break;
+        default:
+            break;
+        }
+    }
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -476,6 +545,102 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Extract a block of vertices, same semantics as LoadVertex() but decoded column by column
+void PLYImporter::LoadVertices(const PLY::Element *pcElement, const PLY::BinaryLayout &layout,
+        const char *data, unsigned int pos, unsigned int count) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != data);
+
+    // index of the property for every vertex semantic, from EST_XCoord to EST_Alpha
+    unsigned int aiProperties[PLY::EST_Alpha + 1];
+    std::fill(aiProperties, aiProperties + PLY::EST_Alpha + 1, NotSet);
+
+    unsigned int cnt = 0;
+    for (unsigned int a = 0; a < pcElement->alProperties.size(); ++a) {
+        const PLY::ESemantic semantic = pcElement->alProperties[a].Semantic;
+        if (semantic <= PLY::EST_Alpha) {
+            aiProperties[semantic] = a;
+            ++cnt;
+        }
+    }
+
+    // check whether we have a valid source for the vertex data
+    if (0 == cnt) {
+        return;
+    }
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (pos + count > mGeneratedMesh->mNumVertices) {
+        throw DeadlyImportError("Invalid .ply file: Too many vertices");
+    }
+
+    const auto decodeVectors = [&](aiVector3D *out, unsigned int first, unsigned int num) {
+        for (unsigned int c = 0; c < num; ++c) {
+            const unsigned int prop = aiProperties[first + c];
+            if (NotSet != prop) {
+                DecodeColumn(data + layout.aiOffsets[prop], pcElement->alProperties[prop].eType, layout.uiStride, count,
+                        [out, c](unsigned int i, auto v) { out[i][c] = static_cast<ai_real>(v); });
+            }
+        }
+    };
+    const auto hasAny = [&](unsigned int first, unsigned int num) {
+        return std::any_of(aiProperties + first, aiProperties + first + num,
+                [](unsigned int prop) { return NotSet != prop; });
+    };
+
+    // Position
+    decodeVectors(mGeneratedMesh->mVertices + pos, PLY::EST_XCoord, 3);
+
+    // Normals
+    if (hasAny(PLY::EST_XNormal, 3)) {
+        if (nullptr == mGeneratedMesh->mNormals) {
+            mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
+        }
+        decodeVectors(mGeneratedMesh->mNormals + pos, PLY::EST_XNormal, 3);
+    }
+
+    // Colors
+    if (hasAny(PLY::EST_Red, 4)) {
+        if (nullptr == mGeneratedMesh->mColors[0]) {
+            mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
+        }
+        aiColor4D *out = mGeneratedMesh->mColors[0] + pos;
+        for (unsigned int c = 0; c < 4; ++c) {
+            const unsigned int prop = aiProperties[PLY::EST_Red + c];
+            if (NotSet == prop) {
+                // assume 1.0 for the alpha channel if it is not set
+                const ai_real value = (3 == c) ? 1.0f : 0.0f;
+                for (unsigned int i = 0; i < count; ++i) {
+                    out[i][c] = value;
+                }
+                continue;
+            }
+            const PLY::EDataType eType = pcElement->alProperties[prop].eType;
+            DecodeColumn(data + layout.aiOffsets[prop], eType, layout.uiStride, count,
+                    [out, c, eType](unsigned int i, auto v) { out[i][c] = NormalizeColorValue(ToValueUnion(v), eType); });
+        }
+    }
+
+    // Texture coordinates
+    if (hasAny(PLY::EST_UTextureCoord, 2)) {
+        if (nullptr == mGeneratedMesh->mTextureCoords[0]) {
+            mGeneratedMesh->mNumUVComponents[0] = 2;
+            mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
+        }
+        decodeVectors(mGeneratedMesh->mTextureCoords[0] + pos, PLY::EST_UTextureCoord, 2);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
 ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
@@ -672,6 +837,28 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Store a face decoded from a binary vertex index list
+void PLYImporter::LoadFace(const PLY::Element *pcElement, unsigned int pos, unsigned int *indices, unsigned int numIndices) {
+    ai_assert(nullptr != pcElement);
+
+    std::unique_ptr<unsigned int[]> indexArray(indices);
+    if (mGeneratedMesh == nullptr) {
+        throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
+    }
+
+    if (mGeneratedMesh->mFaces == nullptr) {
+        mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+        mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    } else if (mGeneratedMesh->mNumFaces < pcElement->NumOccur) {
+        throw DeadlyImportError("Invalid .ply file: Too many faces");
+    }
+
+    aiFace &face = mGeneratedMesh->mFaces[pos];
+    face.mNumIndices = numIndices;
+    face.mIndices = indexArray.release();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get a RGBA color in [0...1] range
 void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avList,
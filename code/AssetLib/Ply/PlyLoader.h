@@ -84,6 +84,19 @@ public:
     */
     void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Extract a block of vertices from fixed-size binary records in
+     *  native byte order
+    */
+    void LoadVertices(const PLY::Element *pcElement, const PLY::BinaryLayout &layout,
+            const char *data, unsigned int pos, unsigned int count);
+
+    // -------------------------------------------------------------------
+    /** Store a face read from a binary vertex index list. The mesh takes
+     *  ownership of the index array
+    */
+    void LoadFace(const PLY::Element *pcElement, unsigned int pos, unsigned int *indices, unsigned int numIndices);
+
 protected:
     // -------------------------------------------------------------------
     /** Return importer meta information.
@@ -47,11 +47,179 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/fast_atof.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
 #include <unordered_set>
 #include <utility>
 
+// SSE2 is used to swap the byte order of big endian files
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define AI_PLY_SSE2
+#   include <emmintrin.h>
+#endif
+
 namespace Assimp {
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Make sure that at least size bytes are available at pCur, reads the next file blocks if needed
+void EnsureBinaryData(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, size_t size) {
+    while (bufferSize < size) {
+        std::vector<char> nbuffer;
+        if (!streamBuffer.getNextBlock(nbuffer)) {
+            throw DeadlyImportError("Invalid .ply file: File corrupted");
+        }
+
+        // concat buffer contents
+        buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
+        buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = (char *)&buffer[0];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// The unread part of the buffer, pCur points to it as well
+inline char *GetBinaryData(std::vector<char> &buffer, unsigned int bufferSize) {
+    return &buffer[buffer.size() - bufferSize];
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void SwapValue(char *data, unsigned int size) {
+    switch (size) {
+    case 2:
+        ByteSwap::Swap2(data);
+        break;
+    case 4:
+        ByteSwap::Swap4(data);
+        break;
+    case 8:
+        ByteSwap::Swap8(data);
+        break;
+    default:
+        break;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Swap the byte order of count consecutive values of the given size
+void SwapValues(char *data, size_t count, unsigned int size) {
+    size_t i = 0;
+#ifdef AI_PLY_SSE2
+    if (size == 2 || size == 4 || size == 8) {
+        const size_t perVector = 16 / size;
+        for (; i + perVector <= count; i += perVector) {
+            __m128i *p = reinterpret_cast<__m128i *>(data + i * size);
+            // swap the bytes of all 16 bit words, then the words of larger values
+            __m128i v = _mm_loadu_si128(p);
+            v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            if (size == 4) {
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+            } else if (size == 8) {
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+            }
+            _mm_storeu_si128(p, v);
+        }
+    }
+#endif // AI_PLY_SSE2
+    for (; i < count; ++i) {
+        SwapValue(data + i * size, size);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void DecodeIndices(const char *data, unsigned int count, unsigned int *out) {
+    for (unsigned int i = 0; i < count; ++i, data += sizeof(T)) {
+        T t;
+        ::memcpy(&t, data, sizeof(T));
+        out[i] = static_cast<unsigned int>(t);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Whether the element is a face list with nothing but an integer vertex index list
+bool IsPlainFaceList(const PLY::Element *pcElement) {
+    if (pcElement->eSemantic != EEST_Face || pcElement->alProperties.size() != 1) {
+        return false;
+    }
+    const PLY::Property &prop = pcElement->alProperties.front();
+    return prop.bIsList && prop.Semantic == EST_VertexIndex &&
+            prop.eType != EDT_Float && prop.eType != EDT_Double && prop.eType != EDT_INVALID &&
+            prop.eFirstType != EDT_Float && prop.eFirstType != EDT_Double && prop.eFirstType != EDT_INVALID;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decode all vertices of an element without list properties in blocks, straight into the mesh
+void ParseVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement,
+        const PLY::BinaryLayout &layout, PLYImporter *loader, bool p_bBE) {
+    for (unsigned int i = 0; i < pcElement->NumOccur;) {
+        EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, layout.uiStride);
+
+        const unsigned int count = std::min(pcElement->NumOccur - i, bufferSize / layout.uiStride);
+        char *data = GetBinaryData(buffer, bufferSize);
+        if (p_bBE) {
+            layout.SwapRecords(pcElement, data, count);
+        }
+        loader->LoadVertices(pcElement, layout, data, i, count);
+
+        pCur += count * layout.uiStride;
+        bufferSize -= count * layout.uiStride;
+        i += count;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decode all faces of a plain face list straight into the mesh
+void ParseFacesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement,
+        PLYImporter *loader, bool p_bBE) {
+    const PLY::Property &prop = pcElement->alProperties.front();
+    const unsigned int indexSize = PLY::PropertyInstance::GetTypeSize(prop.eType);
+    for (unsigned int i = 0; i < pcElement->NumOccur; ++i) {
+        PLY::PropertyInstance::ValueUnion v;
+        PLY::PropertyInstance::ParseValueBinary(streamBuffer, buffer, pCur, bufferSize, prop.eFirstType, &v, p_bBE);
+        const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop.eFirstType);
+
+        const size_t size = static_cast<size_t>(iNum) * indexSize;
+        EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, size);
+        char *data = GetBinaryData(buffer, bufferSize);
+        if (p_bBE) {
+            SwapValues(data, iNum, indexSize);
+        }
+
+        unsigned int *indices = new unsigned int[iNum];
+        switch (prop.eType) {
+        case EDT_Char:
+            DecodeIndices<int8_t>(data, iNum, indices);
+            break;
+        case EDT_UChar:
+            DecodeIndices<uint8_t>(data, iNum, indices);
+            break;
+        case EDT_Short:
+            DecodeIndices<int16_t>(data, iNum, indices);
+            break;
+        case EDT_UShort:
+            DecodeIndices<uint16_t>(data, iNum, indices);
+            break;
+        case EDT_Int:
+            DecodeIndices<int32_t>(data, iNum, indices);
+            break;
+        default:
+            DecodeIndices<uint32_t>(data, iNum, indices);
+            break;
+        }
+
+        pCur += size;
+        bufferSize -= static_cast<unsigned int>(size);
+        loader->LoadFace(pcElement, i, indices, iNum);
+    }
+}
+
+} // namespace
+
 std::string to_string(EElementSemantic e) {
 
     switch (e) {
@@ -570,6 +738,52 @@ bool PLY::DOM::ParseInstance(IOStreamBuffer<char> &streamBuffer, DOM *p_pcOut, P
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool PLY::BinaryLayout::Compute(const PLY::Element *pcElement, PLY::BinaryLayout *pOut) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != pOut);
+
+    pOut->uiStride = 0;
+    pOut->uiUniformSize = 0;
+    pOut->aiOffsets.clear();
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        const unsigned int size = PLY::PropertyInstance::GetTypeSize(prop.eType);
+        if (prop.bIsList || 0 == size) {
+            return false;
+        }
+
+        if (pOut->aiOffsets.empty()) {
+            pOut->uiUniformSize = size;
+        } else if (pOut->uiUniformSize != size) {
+            pOut->uiUniformSize = 0;
+        }
+        pOut->aiOffsets.push_back(pOut->uiStride);
+        pOut->uiStride += size;
+    }
+    return 0 != pOut->uiStride;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PLY::BinaryLayout::SwapRecords(const PLY::Element *pcElement, char *data, unsigned int count) const {
+    ai_assert(nullptr != pcElement);
+
+    if (1 == uiUniformSize) {
+        return;
+    }
+
+    // records made of values of a single size are swapped as one array
+    if (0 != uiUniformSize) {
+        SwapValues(data, static_cast<size_t>(count) * (uiStride / uiUniformSize), uiUniformSize);
+        return;
+    }
+
+    for (unsigned int i = 0; i < count; ++i, data += uiStride) {
+        for (size_t a = 0; a < aiOffsets.size(); ++a) {
+            SwapValue(data + aiOffsets[a], PLY::PropertyInstance::GetTypeSize(pcElement->alProperties[a].eType));
+        }
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::ElementInstanceList::ParseInstanceList(
         IOStreamBuffer<char> &streamBuffer,
@@ -631,6 +845,21 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // fast paths for the common layouts: vertices without list properties have
+    // a fixed size and are decoded in blocks, plain index lists are decoded
+    // without going through PropertyInstance
+    if (nullptr != loader) {
+        PLY::BinaryLayout layout;
+        if (pcElement->eSemantic == EEST_Vertex && PLY::BinaryLayout::Compute(pcElement, &layout)) {
+            ParseVerticesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, layout, loader, p_bBE);
+            return true;
+        }
+        if (IsPlainFaceList(pcElement)) {
+            ParseFacesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, loader, p_bBE);
+            return true;
+        }
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -781,6 +1010,32 @@ bool PLY::PropertyInstance::ParseInstanceBinary(IOStreamBuffer<char> &streamBuff
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int PLY::PropertyInstance::GetTypeSize(PLY::EDataType eType) {
+    switch (eType) {
+    case EDT_Char:
+    case EDT_UChar:
+        return 1;
+
+    case EDT_UShort:
+    case EDT_Short:
+        return 2;
+
+    case EDT_UInt:
+    case EDT_Int:
+    case EDT_Float:
+        return 4;
+
+    case EDT_Double:
+        return 8;
+
+    case EDT_INVALID:
+    default:
+        break;
+    }
+    return 0;
+}
+
 // ------------------------------------------------------------------------------------------------
 PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DefaultValue(PLY::EDataType eType) {
     PLY::PropertyInstance::ValueUnion out;
@@ -858,47 +1113,10 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     ai_assert(nullptr != out);
 
     // calc element size
-    unsigned int lsize = 0;
-    switch (eType) {
-    case EDT_Char:
-    case EDT_UChar:
-        lsize = 1;
-        break;
-
-    case EDT_UShort:
-    case EDT_Short:
-        lsize = 2;
-        break;
-
-    case EDT_UInt:
-    case EDT_Int:
-    case EDT_Float:
-        lsize = 4;
-        break;
-
-    case EDT_Double:
-        lsize = 8;
-        break;
-
-    case EDT_INVALID:
-    default:
-        break;
-    }
+    const unsigned int lsize = GetTypeSize(eType);
 
     // read the next file block if needed
-    if (bufferSize < lsize) {
-        std::vector<char> nbuffer;
-        if (streamBuffer.getNextBlock(nbuffer)) {
-            // concat buffer contents
-            buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
-            buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
-            nbuffer.clear();
-            bufferSize = static_cast<unsigned int>(buffer.size());
-            pCur = (char *)&buffer[0];
-        } else {
-            throw DeadlyImportError("Invalid .ply file: File corrupted");
-        }
-    }
+    EnsureBinaryData(streamBuffer, buffer, pCur, bufferSize, lsize);
 
     bool ret = true;
     switch (eType) {
@@ -288,6 +288,41 @@ public:
     static EElementSemantic ParseSemantic(std::vector<char> &buffer);
 };
 
+// ---------------------------------------------------------------------------------
+/** \brief Layout of the binary records of an element without list properties
+ *
+ * All records of such an element have the same size, so the offsets of the
+ * properties are computed once and whole blocks of records can be decoded
+ * straight from the file buffer.
+ */
+class BinaryLayout {
+public:
+    //! Default constructor
+    BinaryLayout() AI_NO_EXCEPT
+    : uiStride(0)
+    , uiUniformSize(0) {
+        // empty
+    }
+
+    //! Size of a single record in bytes
+    unsigned int uiStride;
+
+    //! Size of every property if all of them have the same size, 0 otherwise
+    unsigned int uiUniformSize;
+
+    //! Offset of each property inside of a record
+    std::vector<unsigned int> aiOffsets;
+
+    // -------------------------------------------------------------------
+    //! Compute the layout of an element. Return value is false if the
+    //! element contains a list property
+    static bool Compute(const Element* pcElement, BinaryLayout* pOut);
+
+    // -------------------------------------------------------------------
+    //! Swap the byte order of all properties of a block of records in place
+    void SwapRecords(const Element* pcElement, char* data, unsigned int count) const;
+};
+
 // ---------------------------------------------------------------------------------
 /** \brief Instance of a property in a PLY file
  */
@@ -332,6 +367,10 @@ public:
     static bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, const Property* prop, PropertyInstance* p_pcOut, bool p_bBE);
 
+    // -------------------------------------------------------------------
+    //! Get the size of a given data type in binary files
+    static unsigned int GetTypeSize(EDataType eType);
+
     // -------------------------------------------------------------------
     //! Get the default value for a given data type
     static ValueUnion DefaultValue(EDataType eType);
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "STEPFileReader.h"
 #include "STEPFileEncoding.h"
+#include "Common/ThreadPool.h"
 #include <assimp/TinyFormatter.h>
 #include <assimp/fast_atof.h>
 #include <functional>
@@ -141,12 +142,12 @@ namespace {
 
 // ------------------------------------------------------------------------------------------------
 // check whether the given line contains an entity definition (i.e. starts with "#<number>=")
-bool IsEntityDef(const std::string& snext)
+bool IsEntityDef(const char *begin, const char *end)
 {
-    if (snext[0] == '#') {
+    if (begin != end && *begin == '#') {
         // it is only a new entity if it has a '=' after the
         // entity ID.
-        for(std::string::const_iterator it = snext.begin()+1; it != snext.end(); ++it) {
+        for(const char *it = begin+1; it != end; ++it) {
             if (*it == '=') {
                 return true;
             }
@@ -158,26 +159,25 @@ bool IsEntityDef(const std::string& snext)
     return false;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool IsEntityDef(const std::string& snext)
+{
+    return IsEntityDef(snext.c_str(), snext.c_str() + snext.length());
 }
 
-
 // ------------------------------------------------------------------------------------------------
-void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
-    const char* const* types_to_track, size_t len,
-    const char* const* inverse_indices_to_track, size_t len2)
+// read the entity records of the DATA section up to "ENDSEC;" from a sequence of lines,
+// Lines is either the LineSplitter of the DB or a ChunkLines. Returns whether the end
+// of the section was found.
+template <typename Lines, typename Insert, typename Warn>
+bool ReadRecords(Lines& splitter, const EXPRESS::ConversionSchema& scheme, Insert insert, Warn warn)
 {
-    db.SetSchema(scheme);
-    db.SetTypesToTrack(types_to_track,len);
-    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
-
-    const DB::ObjectMap& map = db.GetObjects();
-    LineSplitter& splitter = db.GetSplitter();
-
+    std::string type;
     while (splitter) {
         bool has_next = false;
         std::string s = *splitter;
         if (s == "ENDSEC;") {
-            break;
+            return true;
         }
         s.erase(std::remove(s.begin(), s.end(), ' '), s.end());
 
@@ -186,7 +186,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // LineSplitter already ignores empty lines
         ai_assert(s.length());
         if (s[0] != '#') {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'#\'",line));
+            warn(line, "expected token \'#\'");
             ++splitter;
             continue;
         }
@@ -196,14 +196,14 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         // ---
         const std::string::size_type n0 = s.find_first_of('=');
         if (n0 == std::string::npos) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected token \'=\'",line));
+            warn(line, "expected token \'=\'");
             ++splitter;
             continue;
         }
 
-        const uint64_t id = strtoul10_64(s.substr(1,n0-1).c_str());
+        const uint64_t id = strtoul10_64(s.c_str() + 1);
         if (!id) {
-            ASSIMP_LOG_WARN(AddLineNumber("expected positive, numeric entity id",line));
+            warn(line, "expected positive, numeric entity id");
             ++splitter;
             continue;
         }
@@ -230,7 +230,7 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
             }
 
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \'(\'",line));
+                warn(line, "expected token \'(\'");
                 continue;
             }
         }
@@ -256,15 +256,11 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
                 }
             }
             if(!ok) {
-                ASSIMP_LOG_WARN(AddLineNumber("expected token \')\'",line));
+                warn(line, "expected token \')\'");
                 continue;
             }
         }
 
-        if (map.find(id) != map.end()) {
-            ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
-        }
-
         std::string::size_type ns = n0;
         do {
             ++ns;
@@ -273,27 +269,242 @@ void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
         do {
             --ne;
         } while (IsSpace(s.at(ne)));
-        std::string type = s.substr(ns, ne - ns + 1);
-        type = ai_tolower(type);
+        type.assign(s, ns, ne - ns + 1);
+        std::transform(type.begin(), type.end(), type.begin(), &ai_tolower<char>);
         const char* sz = scheme.GetStaticStringForToken(type);
         if(sz) {
-            const std::string::size_type szLen = n2-n1+1;
-            char* const copysz = new char[szLen+1];
-            std::copy(s.c_str()+n1,s.c_str()+n2+1,copysz);
-            copysz[szLen] = '\0';
-            db.InternInsert(new LazyObject(db,id,line,sz,copysz));
+            insert(id, line, sz, s.c_str() + n1, n2 - n1 + 1);
         }
         if(!has_next) {
             ++splitter;
         }
     }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Minimum number of bytes of the DATA section tokenized by one chunk.
+constexpr size_t MinChunkSize = 256 * 1024;
+
+// ------------------------------------------------------------------------------------------------
+// Iterates the lines of a chunk of the DATA section exactly like the LineSplitter of the
+// DB does, so records and line numbers match those of the serial path. Line indices are
+// relative to the start of the chunk.
+class ChunkLines {
+public:
+    ChunkLines(const char* begin, const char* end, bool eof) :
+            mIt(begin), mEnd(end), mNumLines(), mEof(eof), mValid() {
+        SkipBlanks();
+        ++*this;
+    }
+
+    ChunkLines& operator++() {
+        mValid = false;
+        if (mIt == mEnd) {
+            return *this;
+        }
+        const char* const begin = mIt;
+        while (mIt != mEnd && *mIt != '\r' && *mIt != '\n') {
+            ++mIt;
+        }
+        mCur.assign(begin, mIt);
+        SkipBlanks();
+        ++mNumLines;
+
+        // the LineSplitter never yields the last line of the file
+        mValid = mIt != mEnd || !mEof;
+        return *this;
+    }
+
+    const std::string& operator*() const {
+        return mCur;
+    }
+
+    explicit operator bool() const {
+        return mValid;
+    }
+
+    uint64_t get_index() const {
+        return mNumLines - 1;
+    }
+
+    // number of lines read so far, all of the chunk once the iteration is done
+    uint64_t get_num_lines() const {
+        return mNumLines;
+    }
+
+private:
+    // the LineSplitter skips blanks and empty lines behind a line, but no tabs
+    void SkipBlanks() {
+        while (mIt != mEnd && (*mIt == ' ' || *mIt == '\r' || *mIt == '\n')) {
+            ++mIt;
+        }
+    }
+
+private:
+    const char* mIt;
+    const char* mEnd;
+    std::string mCur;
+    uint64_t mNumLines;
+    bool mEof;
+    bool mValid;
+};
+
+// ------------------------------------------------------------------------------------------------
+// The entity records of one chunk of the DATA section. Chunks are tokenized in
+// parallel and their records are inserted into the DB in file order afterwards.
+struct Chunk {
+    struct Record {
+        uint64_t id;
+        uint64_t line;
+        const char* type;
+        const char* args;
+    };
+
+    struct Warning {
+        uint64_t line;
+        const char* message;
+    };
+
+    // range of the chunk in the file
+    const char* begin;
+    const char* end;
+    // line numbers of the records and warnings are relative to the chunk
+    std::vector<Record> records;
+    std::vector<Warning> warnings;
+    STEP::ArgumentStorage args;
+    // number of lines the LineSplitter would yield for the chunk
+    uint64_t num_lines;
+    // the chunk contains the end of the DATA section
+    bool has_end;
+};
+
+// ------------------------------------------------------------------------------------------------
+// returns the start of the first line at or behind pos which starts an entity or ends the section
+const char* FindRecordStart(const char* pos, const char* end)
+{
+    while (pos != end) {
+        const char* const lineEnd = static_cast<const char*>(::memchr(pos, '\n', end - pos));
+        if (nullptr == lineEnd) {
+            return end;
+        }
+        pos = lineEnd + 1;
+
+        const char* it = pos;
+        while (it != end && (*it == ' ' || *it == '\r')) {
+            ++it;
+        }
+        if (IsEntityDef(it, end) || (end - it >= 7 && !::strncmp(it, "ENDSEC;", 7))) {
+            return pos;
+        }
+    }
+    return end;
+}
+
+// ------------------------------------------------------------------------------------------------
+// tokenize the DATA section, which starts at the current line of the splitter, in parallel chunks
+void TokenizeChunks(LineSplitter& splitter, const EXPRESS::ConversionSchema& scheme, unsigned int threads, std::vector<Chunk>& chunks)
+{
+    // the splitter already consumed the current line and the blanks behind it
+    StreamReaderLE& stream = splitter.get_stream();
+    const char* const buffer = reinterpret_cast<const char*>(stream.GetPtr()) - stream.GetCurrentPos();
+    const char* const end = reinterpret_cast<const char*>(stream.GetPtr()) + stream.GetRemainingSize();
+    const char* data = reinterpret_cast<const char*>(stream.GetPtr());
+    while (data != buffer && (data[-1] == ' ' || data[-1] == '\r' || data[-1] == '\n')) {
+        --data;
+    }
+    while (data != buffer && data[-1] != '\r' && data[-1] != '\n') {
+        --data;
+    }
+
+    ThreadPool pool(threads);
+    const size_t size = static_cast<size_t>(end - data);
+    const size_t numChunks = std::max<size_t>(1, std::min<size_t>(pool.GetNumThreads() * 4, size / MinChunkSize));
+    chunks.resize(numChunks);
+    const char* begin = data;
+    for (size_t i = 1; i <= numChunks; ++i) {
+        chunks[i - 1].begin = begin;
+        chunks[i - 1].end = begin = i == numChunks ? end : FindRecordStart(std::max(begin, data + size / numChunks * i), end);
+        chunks[i - 1].num_lines = 0;
+        chunks[i - 1].has_end = false;
+    }
+
+    pool.ParallelFor(chunks.size(), [&](size_t i) {
+        Chunk& chunk = chunks[i];
+        ChunkLines lines(chunk.begin, chunk.end, chunk.end == end);
+        chunk.has_end = ReadRecords(lines, scheme,
+            [&](uint64_t id, uint64_t line, const char* type, const char* args, size_t len) {
+                chunk.records.push_back({ id, line, type, chunk.args.Store(args, len) });
+            },
+            [&](uint64_t line, const char* message) {
+                chunk.warnings.push_back({ line, message });
+            });
+        chunk.num_lines = lines.get_num_lines();
+    });
+}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+void STEP::ReadFile(DB& db,const EXPRESS::ConversionSchema& scheme,
+    const char* const* types_to_track, size_t len,
+    const char* const* inverse_indices_to_track, size_t len2,
+    unsigned int threads)
+{
+    db.SetSchema(scheme);
+    db.SetTypesToTrack(types_to_track,len);
+    db.SetInverseIndicesToTrack(inverse_indices_to_track,len2);
+
+    LineSplitter& splitter = db.GetSplitter();
+
+    bool has_end = false;
+    if (threads != 1 && splitter) {
+        std::vector<Chunk> chunks;
+        TokenizeChunks(splitter, scheme, threads, chunks);
+
+        // line numbers continue those of the splitter
+        uint64_t base = splitter.get_index();
+        for (Chunk& chunk : chunks) {
+            // warnings and records are both in file order, keep that order in the log
+            std::vector<Chunk::Warning>::const_iterator w = chunk.warnings.begin();
+            for (const Chunk::Record& r : chunk.records) {
+                for (; w != chunk.warnings.end() && w->line < r.line; ++w) {
+                    ASSIMP_LOG_WARN(AddLineNumber(w->message, base + w->line));
+                }
+                if (db.GetObject(r.id)) {
+                    ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",r.id," already exists"),base + r.line));
+                }
+                db.InternInsert(r.id, base + r.line, r.type, r.args);
+            }
+            for (; w != chunk.warnings.end(); ++w) {
+                ASSIMP_LOG_WARN(AddLineNumber(w->message, base + w->line));
+            }
+            db.GetArgumentStorage().Append(std::move(chunk.args));
+            if (chunk.has_end) {
+                has_end = true;
+                break;
+            }
+            base += chunk.num_lines;
+        }
+    } else {
+        has_end = ReadRecords(splitter, scheme,
+            [&](uint64_t id, uint64_t line, const char* type, const char* args, size_t len) {
+                if (db.GetObject(id)) {
+                    ASSIMP_LOG_WARN(AddLineNumber((Formatter::format(),"an object with the id #",id," already exists"),line));
+                }
+                db.InternInsert(id, line, type, db.GetArgumentStorage().Store(args, len));
+            },
+            [&](uint64_t line, const char* message) {
+                ASSIMP_LOG_WARN(AddLineNumber(message, line));
+            });
+    }
 
-    if (!splitter) {
+    if (!has_end) {
         ASSIMP_LOG_WARN("STEP: ignoring unexpected EOF");
     }
 
     if ( !DefaultLogger::isNullLogger()){
-        ASSIMP_LOG_DEBUG("STEP: got ",map.size()," object records with ",
+        ASSIMP_LOG_DEBUG("STEP: got ",db.GetObjectCount()," object records with ",
             db.GetRefs().size()," inverse index entries");
     }
 }
@@ -487,7 +698,7 @@ STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char*
 , type(type)
 , db(db)
 , args(args)
-, obj() {
+, obj(nullptr) {
     // find any external references and store them in the database.
     // this helps us emulate STEPs INVERSE fields.
     if (!db.KeepInverseIndicesForType(type)) {
@@ -513,16 +724,20 @@ STEP::LazyObject::LazyObject(DB& db, uint64_t id,uint64_t /*line*/, const char*
 
 // ------------------------------------------------------------------------------------------------
 STEP::LazyObject::~LazyObject() {
-    // make sure the right dtor/operator delete get called
-    if (obj) {
-        delete obj;
-    } else {
-        delete[] args;
-    }
+    // make sure the right dtor/operator delete get called,
+    // the argument text is owned by the DB.
+    delete obj.load();
 }
 
 // ------------------------------------------------------------------------------------------------
-void STEP::LazyObject::LazyInit() const {
+STEP::Object *STEP::LazyObject::LazyInit() const {
+    std::lock_guard<std::recursive_mutex> lock(db.evaluation_mutex);
+
+    // another thread may have converted the object while we were waiting
+    if (Object *o = obj.load(std::memory_order_relaxed)) {
+        return o;
+    }
+
     const EXPRESS::ConversionSchema& schema = db.GetSchema();
     STEP::ConvertObjectProc proc = schema.GetConverterProc(type);
 
@@ -533,20 +748,22 @@ void STEP::LazyObject::LazyInit() const {
     const char* acopy = args;
     const char *end = acopy + std::strlen(args);
     std::shared_ptr<const EXPRESS::LIST> conv_args = EXPRESS::LIST::Parse(acopy, end, (uint64_t)STEP::SyntaxError::LINE_NOT_SPECIFIED,&db.GetSchema());
-    delete[] args;
     args = nullptr;
 
     // if the converter fails, it should throw an exception, but it should never return nullptr
+    Object *o = nullptr;
     try {
-        obj = proc(db,*conv_args);
+        o = proc(db,*conv_args);
     }
     catch(const TypeError& t) {
         // augment line and entity information
         throw TypeError(t.what(),id);
     }
     ++db.evaluated_count;
-    ai_assert(obj);
+    ai_assert(o);
 
     // store the original id in the object instance
-    obj->SetID(id);
+    o->SetID(id);
+    obj.store(o, std::memory_order_release);
+    return o;
 }
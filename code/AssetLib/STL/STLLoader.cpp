@@ -50,6 +50,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 namespace Assimp {
@@ -121,6 +124,149 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
     }
     return isASCII;
 }
+
+// Checks the header of a stream for a binary STL, the stream is rewound afterwards
+static bool IsBinarySTL(IOStream *stream, size_t fileSize) {
+    char header[84];
+    if (fileSize < sizeof(header)) {
+        return false;
+    }
+    const bool isBinary = stream->Read(header, 1, sizeof(header)) == sizeof(header) && IsBinarySTL(header, fileSize);
+    stream->Seek(0, aiOrigin_SET);
+    return isBinary;
+}
+
+// Searches the header for "COLOR=" followed by the default color of Materialise files
+static bool ReadMaterialiseColor(const unsigned char *header, aiColor4D &color) {
+    const unsigned char *sz2 = header;
+    const unsigned char *const szEnd = sz2 + 80;
+    while (sz2 < szEnd) {
+
+        if ('C' == *sz2++ && 'O' == *sz2++ && 'L' == *sz2++ &&
+                'O' == *sz2++ && 'R' == *sz2++ && '=' == *sz2++) {
+
+            // read the default vertex color for facets
+            ASSIMP_LOG_INFO("STL: Taking code path for Materialise files");
+            const ai_real invByte = (ai_real)1.0 / (ai_real)255.0;
+            color.r = (*sz2++) * invByte;
+            color.g = (*sz2++) * invByte;
+            color.b = (*sz2++) * invByte;
+            color.a = (*sz2++) * invByte;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Converts the 15 bit color of a facet
+static void DecodeFacetColor(uint16_t color, bool bIsMaterialise, aiColor4D &clr) {
+    clr.a = 1.0;
+    const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
+    if (bIsMaterialise) // this is reversed
+    {
+        clr.r = (color & 0x1fu) * invVal;
+        clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+        clr.b = ((color & (0x1fu << 10)) >> 10u) * invVal;
+    } else {
+        clr.b = (color & 0x1fu) * invVal;
+        clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+        clr.r = ((color & (0x1fu << 10)) >> 10u) * invVal;
+    }
+}
+
+static constexpr unsigned int FacetSize = 50;
+static constexpr unsigned int FacetsPerBlock = 4096;
+
+// Merges vertices with exactly the same position and color, using an open addressing
+// hash table of vertex indices
+class VertexWelder {
+public:
+    explicit VertexWelder(size_t expectedVertices) :
+            mMask(0) {
+        size_t capacity = 16;
+        while (capacity < expectedVertices * 2) {
+            capacity *= 2;
+        }
+        mTable.assign(capacity, Empty);
+        mMask = capacity - 1;
+        mPositions.reserve(expectedVertices);
+        mColors.reserve(expectedVertices);
+    }
+
+    // Returns the index of the vertex, adds it if it is new
+    unsigned int Insert(const float *position, uint16_t color) {
+        const aiVector3f pos(position[0], position[1], position[2]);
+        for (size_t slot = Hash(pos, color) & mMask;; slot = (slot + 1) & mMask) {
+            const unsigned int index = mTable[slot];
+            if (Empty == index) {
+                break;
+            }
+            if (mPositions[index] == pos && mColors[index] == color) {
+                return index;
+            }
+        }
+
+        if (mPositions.size() >= std::numeric_limits<unsigned int>::max() - 1) {
+            throw DeadlyImportError("STL: too many vertices");
+        }
+        const unsigned int index = static_cast<unsigned int>(mPositions.size());
+        mPositions.push_back(pos);
+        mColors.push_back(color);
+
+        // keep the load factor below one half
+        if (mPositions.size() * 2 > mTable.size()) {
+            Grow();
+        } else {
+            Place(index);
+        }
+        return index;
+    }
+
+    const std::vector<aiVector3f> &GetPositions() const {
+        return mPositions;
+    }
+
+    const std::vector<uint16_t> &GetColors() const {
+        return mColors;
+    }
+
+private:
+    static constexpr unsigned int Empty = ~0u;
+
+    static uint64_t Hash(const aiVector3f &pos, uint16_t color) {
+        uint64_t h = color;
+        for (unsigned int i = 0; i < 3; ++i) {
+            // +0 and -0 are equal, so they must hash equally
+            const float value = (pos[i] == 0.0f) ? 0.0f : pos[i];
+            uint32_t bits;
+            ::memcpy(&bits, &value, sizeof(uint32_t));
+            h = (h ^ bits) * 0x9E3779B97F4A7C15ull;
+        }
+        return h ^ (h >> 29);
+    }
+
+    void Place(unsigned int index) {
+        size_t slot = Hash(mPositions[index], mColors[index]) & mMask;
+        while (Empty != mTable[slot]) {
+            slot = (slot + 1) & mMask;
+        }
+        mTable[slot] = index;
+    }
+
+    void Grow() {
+        mTable.assign(mTable.size() * 2, Empty);
+        mMask = mTable.size() - 1;
+        for (unsigned int i = 0; i < mPositions.size(); ++i) {
+            Place(i);
+        }
+    }
+
+    std::vector<unsigned int> mTable;
+    size_t mMask;
+    std::vector<aiVector3f> mPositions;
+    std::vector<uint16_t> mColors;
+};
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -128,7 +274,8 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
 STLImporter::STLImporter() :
         mBuffer(),
         mFileSize(0),
-        mScene() {
+        mScene(),
+        mWeldVertices(false) {
     // empty
 }
 
@@ -143,6 +290,12 @@ bool STLImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool /
     return SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens));
 }
 
+// ------------------------------------------------------------------------------------------------
+// Setup configuration properties for the loader
+void STLImporter::SetupProperties(const Importer *pImp) {
+    mWeldVertices = pImp->GetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, false);
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *STLImporter::GetInfo() const {
     return &desc;
@@ -171,14 +324,7 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     }
 
     mFileSize = file->FileSize();
-
-    // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
-    std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
-
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = 0.6f;
@@ -188,12 +334,22 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     bool bMatClr = false;
 
-    if (IsBinarySTL(mBuffer, mFileSize)) {
-        bMatClr = LoadBinaryFile();
-    } else if (IsAsciiSTL(mBuffer, mFileSize)) {
-        LoadASCIIFile(mScene->mRootNode);
+    // allocate storage and copy the contents of the file to a memory buffer
+    // (terminate it with zero), unless a binary file is streamed and welded
+    std::vector<char> buffer2;
+    if (mWeldVertices && IsBinarySTL(file.get(), mFileSize)) {
+        bMatClr = LoadBinaryFileWelded(file.get());
     } else {
-        throw DeadlyImportError("Failed to determine STL storage representation for ", pFile, ".");
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+
+        if (IsBinarySTL(mBuffer, mFileSize)) {
+            bMatClr = LoadBinaryFile();
+        } else if (IsAsciiSTL(mBuffer, mFileSize)) {
+            LoadASCIIFile(mScene->mRootNode);
+        } else {
+            throw DeadlyImportError("Failed to determine STL storage representation for ", pFile, ".");
+        }
     }
 
     // create a single default material, using a white diffuse color for consistency with
@@ -408,27 +564,7 @@ bool STLImporter::LoadBinaryFile() {
     if (mFileSize < 84) {
         throw DeadlyImportError("STL: file is too small for the header");
     }
-    bool bIsMaterialise = false;
-
-    // search for an occurrence of "COLOR=" in the header
-    const unsigned char *sz2 = (const unsigned char *)mBuffer;
-    const unsigned char *const szEnd = sz2 + 80;
-    while (sz2 < szEnd) {
-
-        if ('C' == *sz2++ && 'O' == *sz2++ && 'L' == *sz2++ &&
-                'O' == *sz2++ && 'R' == *sz2++ && '=' == *sz2++) {
-
-            // read the default vertex color for facets
-            bIsMaterialise = true;
-            ASSIMP_LOG_INFO("STL: Taking code path for Materialise files");
-            const ai_real invByte = (ai_real)1.0 / (ai_real)255.0;
-            mClrColorDefault.r = (*sz2++) * invByte;
-            mClrColorDefault.g = (*sz2++) * invByte;
-            mClrColorDefault.b = (*sz2++) * invByte;
-            mClrColorDefault.a = (*sz2++) * invByte;
-            break;
-        }
-    }
+    const bool bIsMaterialise = ReadMaterialiseColor((const unsigned char *)mBuffer, mClrColorDefault);
     const unsigned char *sz = (const unsigned char *)mBuffer + 80;
 
     // now read the number of facets
@@ -510,18 +646,7 @@ bool STLImporter::LoadBinaryFile() {
                 ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
             }
             aiColor4D *clr = &pMesh->mColors[0][i * 3];
-            clr->a = 1.0;
-            const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
-            if (bIsMaterialise) // this is reversed
-            {
-                clr->r = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->b = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            } else {
-                clr->b = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->r = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            }
+            DecodeFacetColor(color, bIsMaterialise, *clr);
             // assign the color to all vertices of the face
             *(clr + 1) = *clr;
             *(clr + 2) = *clr;
@@ -531,6 +656,108 @@ bool STLImporter::LoadBinaryFile() {
     // now copy faces
     addFacesToMesh(pMesh);
 
+    AddBinaryMeshNode();
+
+    if (bIsMaterialise && !pMesh->mColors[0]) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Read a binary STL file from a stream and weld identical vertices
+bool STLImporter::LoadBinaryFileWelded(IOStream *stream) {
+    // allocate one mesh
+    mScene->mNumMeshes = 1;
+    mScene->mMeshes = new aiMesh *[1];
+    aiMesh *pMesh = mScene->mMeshes[0] = new aiMesh();
+    pMesh->mMaterialIndex = 0;
+
+    unsigned char header[84];
+    if (stream->Read(header, 1, sizeof(header)) != sizeof(header)) {
+        throw DeadlyImportError("STL: file is too small for the header");
+    }
+    const bool bIsMaterialise = ReadMaterialiseColor(header, mClrColorDefault);
+
+    // now read the number of facets
+    mScene->mRootNode->mName.Set("<STL_BINARY>");
+
+    uint32_t numFaces = 0;
+    ::memcpy(&numFaces, header + 80, sizeof(uint32_t));
+    if (!numFaces) {
+        throw DeadlyImportError("STL: file is empty. There are no facets defined");
+    }
+    pMesh->mNumFaces = numFaces;
+    pMesh->mFaces = new aiFace[numFaces];
+
+    // a closed triangle mesh has about half as many vertices as facets
+    VertexWelder welder(numFaces / 2 + 3);
+    bool hasColors = false;
+
+    std::vector<unsigned char> block(FacetsPerBlock * FacetSize);
+    for (unsigned int first = 0; first < numFaces;) {
+        const unsigned int count = std::min(FacetsPerBlock, numFaces - first);
+        if (stream->Read(block.data(), FacetSize, count) != count) {
+            throw DeadlyImportError("STL: file is too small to hold all facets");
+        }
+
+        const unsigned char *sz = block.data();
+        for (unsigned int i = 0; i < count; ++i, sz += FacetSize) {
+            // skip the facet normal, the vertices are followed by the color
+            float positions[9];
+            ::memcpy(positions, sz + 12, sizeof(positions));
+            uint16_t color;
+            ::memcpy(&color, sz + 48, sizeof(uint16_t));
+
+            // only the colors take part in the welding, not the unused attribute bits
+            if (color & (1 << 15)) {
+                hasColors = true;
+            } else {
+                color = 0;
+            }
+
+            aiFace &face = pMesh->mFaces[first + i];
+            face.mIndices = new unsigned int[face.mNumIndices = 3];
+            for (unsigned int o = 0; o < 3; ++o) {
+                face.mIndices[o] = welder.Insert(positions + 3 * o, color);
+            }
+        }
+        first += count;
+    }
+
+    const std::vector<aiVector3f> &positions = welder.GetPositions();
+    pMesh->mNumVertices = static_cast<unsigned int>(positions.size());
+    pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
+    for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        pMesh->mVertices[i] = aiVector3D(positions[i].x, positions[i].y, positions[i].z);
+    }
+
+    if (hasColors) {
+        ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
+        const std::vector<uint16_t> &colors = welder.GetColors();
+        pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+        for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+            if (colors[i] & (1 << 15)) {
+                DecodeFacetColor(colors[i], bIsMaterialise, pMesh->mColors[0][i]);
+            } else {
+                pMesh->mColors[0][i] = mClrColorDefault;
+            }
+        }
+    }
+    ASSIMP_LOG_DEBUG("STL: Welded ", numFaces * 3, " vertices to ", pMesh->mNumVertices);
+
+    AddBinaryMeshNode();
+
+    if (bIsMaterialise && !pMesh->mColors[0]) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void STLImporter::AddBinaryMeshNode() {
     aiNode *root = mScene->mRootNode;
 
     // allocate one node
@@ -547,12 +774,6 @@ bool STLImporter::LoadBinaryFile() {
     for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
         node->mMeshes[i] = i;
     }
-
-    if (bIsMaterialise && !pMesh->mColors[0]) {
-        // use the color as diffuse material color
-        return true;
-    }
-    return false;
 }
 
 void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNode *node) {
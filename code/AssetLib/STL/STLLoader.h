@@ -75,6 +75,11 @@ public:
      */
     bool CanRead( const std::string& pFile, IOSystem* pIOHandler, bool checkSig) const override;
 
+    /**
+     * @brief   Reads the import configuration.
+     */
+    void SetupProperties(const Importer* pImp) override;
+
 protected:
 
     /**
@@ -96,6 +101,18 @@ protected:
      */
     bool LoadBinaryFile();
 
+    /**
+     * @brief   Loads a binary .stl file block by block from a stream and
+     *  welds identical vertices while reading
+     * @return true if the default vertex color must be used as material color
+     */
+    bool LoadBinaryFileWelded(IOStream *stream);
+
+    /**
+     * @brief   Adds a node for the single mesh of a binary file
+     */
+    void AddBinaryMeshNode();
+
     /**
      * @brief   Loads a ASCII text .stl file
      */
@@ -116,6 +133,9 @@ protected:
 
     /** Default vertex color */
     aiColor4D mClrColorDefault;
+
+    /** Configuration option: weld the vertices of binary files */
+    bool mWeldVertices;
 };
 
 } // end of namespace Assimp
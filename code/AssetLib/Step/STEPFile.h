@@ -42,9 +42,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef INCLUDED_AI_STEPFILE_H
 #define INCLUDED_AI_STEPFILE_H
 
+#include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <typeinfo>
 #include <vector>
@@ -111,6 +115,13 @@ class LazyObject;
 class DB;
 
 typedef Object *(*ConvertObjectProc)(const DB &db, const EXPRESS::LIST &params);
+
+// see STEPFileReader.h
+ASSIMP_API DB *ReadFileHeader(std::shared_ptr<IOStream> stream);
+ASSIMP_API void ReadFile(DB &db, const EXPRESS::ConversionSchema &scheme,
+        const char *const *types_to_track, size_t len,
+        const char *const *inverse_indices_to_track, size_t len2,
+        unsigned int threads);
 } // namespace STEP
 
 // ********************************************************************************
@@ -504,7 +515,7 @@ private:
  *  the text line that contains the object definition.
  */
 // -------------------------------------------------------------------------------
-class LazyObject {
+class ASSIMP_API LazyObject {
     friend class DB;
 
 public:
@@ -512,19 +523,21 @@ public:
     ~LazyObject();
 
     Object &operator*() {
-        if (!obj) {
-            LazyInit();
-            ai_assert(obj);
+        Object *o = obj.load(std::memory_order_acquire);
+        if (!o) {
+            o = LazyInit();
+            ai_assert(o);
         }
-        return *obj;
+        return *o;
     }
 
     const Object &operator*() const {
-        if (!obj) {
-            LazyInit();
-            ai_assert(obj);
+        Object *o = obj.load(std::memory_order_acquire);
+        if (!o) {
+            o = LazyInit();
+            ai_assert(o);
         }
-        return *obj;
+        return *o;
     }
 
     template <typename T>
@@ -568,14 +581,16 @@ public:
     }
 
 private:
-    void LazyInit() const;
+    Object *LazyInit() const;
 
 private:
     mutable uint64_t id;
     const char *const type;
     DB &db;
+    // points into the argument storage of the DB, reset once evaluated
     mutable const char *args;
-    mutable Object *obj;
+    // published once the object is complete, objects may be evaluated from several threads
+    mutable std::atomic<Object *> obj;
 };
 
 template <typename T>
@@ -737,6 +752,50 @@ inline void GenericConvert(ListOf<T1, N1, N2> &a, const std::shared_ptr<const EX
     return InternGenericConvertList<T1, N1, N2>()(a, b, db);
 }
 
+// ------------------------------------------------------------------------------
+/** Block storage for the argument tuples of the object records. The tuples
+ *  are stored zero-terminated and don't move until the storage is destroyed,
+ *  so reading a file costs about the size of its DATA section.
+ */
+// -------------------------------------------------------------------------------
+class ArgumentStorage {
+public:
+    ArgumentStorage() : cursor(), left() {}
+
+    // copy a tuple into the storage and return a pointer to the copy
+    const char *Store(const char *begin, size_t len) {
+        if (len + 1 > left) {
+            const size_t size = std::max(len + 1, BlockSize);
+            blocks.emplace_back(new char[size]);
+            cursor = blocks.back().get();
+            left = size;
+        }
+        char *const out = cursor;
+        std::copy(begin, begin + len, out);
+        out[len] = '\0';
+        cursor += len + 1;
+        left -= len + 1;
+        return out;
+    }
+
+    // take over the blocks of another storage, pointers into them stay valid
+    void Append(ArgumentStorage &&other) {
+        for (std::unique_ptr<char[]> &block : other.blocks) {
+            blocks.push_back(std::move(block));
+        }
+        other.blocks.clear();
+        other.cursor = nullptr;
+        other.left = 0;
+    }
+
+private:
+    static constexpr size_t BlockSize = 1024 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char *cursor;
+    size_t left;
+};
+
 // ------------------------------------------------------------------------------
 /** Lightweight manager class that holds the map of all objects in a
  *  STEP file. DB's are exclusively maintained by the functions in
@@ -747,19 +806,28 @@ class DB {
     friend DB *ReadFileHeader(std::shared_ptr<IOStream> stream);
     friend void ReadFile(DB &db, const EXPRESS::ConversionSchema &scheme,
             const char *const *types_to_track, size_t len,
-            const char *const *inverse_indices_to_track, size_t len2);
+            const char *const *inverse_indices_to_track, size_t len2,
+            unsigned int threads);
 
     friend class LazyObject;
 
 public:
-    // objects indexed by ID - this can grow pretty large (i.e some hundred million
-    // entries), so use raw pointers to avoid *any* overhead.
-    typedef std::map<uint64_t, const LazyObject *> ObjectMap;
+    // all object records in file order. this can grow pretty large (i.e some hundred
+    // million entries), so the records are allocated in blocks and never move.
+    typedef std::deque<LazyObject> ObjectList;
+
+    // objects indexed by ID. STEP ids are mostly contiguous, so most of them
+    // live in a dense table and only outliers go to the sparse map.
+    typedef std::vector<const LazyObject *> ObjectTable;
+    typedef std::step_unordered_map<uint64_t, const LazyObject *> SparseObjectMap;
 
     // objects indexed by their declarative type, but only for those that we truly want
     typedef std::set<const LazyObject *> ObjectSet;
     typedef std::map<std::string, ObjectSet> ObjectMapByType;
 
+    // same as above, but keyed by the interned type names from the schema
+    typedef std::step_unordered_map<const char *, ObjectSet *> ObjectSetByInternedType;
+
     // list of types for which to keep inverse indices for all references
     // that the respective objects keep.
     // the list keeps pointers to strings in static storage
@@ -775,11 +843,7 @@ private:
             reader(reader), splitter(*reader, true, true), evaluated_count(), schema(nullptr) {}
 
 public:
-    ~DB() {
-        for (ObjectMap::value_type &o : objects) {
-            delete o.second;
-        }
-    }
+    ~DB() = default;
 
     uint64_t GetObjectCount() const {
         return objects.size();
@@ -797,7 +861,7 @@ public:
         return *schema;
     }
 
-    const ObjectMap &GetObjects() const {
+    const ObjectList &GetObjects() const {
         return objects;
     }
 
@@ -815,8 +879,12 @@ public:
 
     // get the yet unevaluated object record with a given id
     const LazyObject *GetObject(uint64_t id) const {
-        const ObjectMap::const_iterator it = objects.find(id);
-        if (it != objects.end()) {
+        if (id < objects_byid.size() && objects_byid[static_cast<size_t>(id)]) {
+            return objects_byid[static_cast<size_t>(id)];
+        }
+        // outliers stay in the sparse map when the dense table grows past them later on
+        const SparseObjectMap::const_iterator it = objects_sparse.find(id);
+        if (it != objects_sparse.end()) {
             return (*it).second;
         }
         return nullptr;
@@ -852,8 +920,8 @@ public:
 
     // evaluate *all* entities in the file. this is a power test for the loader
     void EvaluateAll() {
-        for (ObjectMap::value_type &e : objects) {
-            **e.second;
+        for (const LazyObject &e : objects) {
+            *e;
         }
         ai_assert(evaluated_count == objects.size());
     }
@@ -868,13 +936,32 @@ private:
         return splitter;
     }
 
-    void InternInsert(const LazyObject *lz) {
-        objects[lz->GetID()] = lz;
+    // create a new object record, type must be interned by the schema
+    // and args must live in the argument storage of the DB.
+    const LazyObject &InternInsert(uint64_t id, uint64_t line, const char *type, const char *args) {
+        objects.emplace_back(*this, id, line, type, args);
+        const LazyObject *lz = &objects.back();
 
-        const ObjectMapByType::iterator it = objects_bytype.find(lz->type);
-        if (it != objects_bytype.end()) {
-            (*it).second.insert(lz);
+        // grow the dense table as long as it stays reasonably populated
+        if (id < objects_byid.size() || id <= 2 * objects.size() + DenseTableSlack) {
+            if (id >= objects_byid.size()) {
+                objects_byid.resize(static_cast<size_t>(id) + 1, nullptr);
+            }
+            objects_byid[static_cast<size_t>(id)] = lz;
+        } else {
+            objects_sparse[id] = lz;
         }
+
+        const ObjectSetByInternedType::iterator it = objects_bytype_interned.find(type);
+        if (it != objects_bytype_interned.end()) {
+            (*it).second->insert(lz);
+        }
+        return *lz;
+    }
+
+    // storage for the argument tuples of all object records
+    ArgumentStorage &GetArgumentStorage() {
+        return args_storage;
     }
 
     void SetSchema(const EXPRESS::ConversionSchema &_schema) {
@@ -883,7 +970,10 @@ private:
 
     void SetTypesToTrack(const char *const *types, size_t N) {
         for (size_t i = 0; i < N; ++i) {
-            objects_bytype[types[i]] = ObjectSet();
+            ObjectSet &set = objects_bytype[types[i]];
+            if (const char *const sz = schema->GetStaticStringForToken(types[i])) {
+                objects_bytype_interned[sz] = &set;
+            }
         }
     }
 
@@ -904,15 +994,26 @@ private:
     }
 
 private:
+    // ids above 2 * object count + this go to the sparse map
+    static constexpr uint64_t DenseTableSlack = 1024;
+
     HeaderInfo header;
-    ObjectMap objects;
+    ObjectList objects;
+    ObjectTable objects_byid;
+    SparseObjectMap objects_sparse;
     ObjectMapByType objects_bytype;
+    ObjectSetByInternedType objects_bytype_interned;
     RefMap refs;
     InverseWhitelist inv_whitelist;
     std::shared_ptr<StreamReaderLE> reader;
     LineSplitter splitter;
     uint64_t evaluated_count;
     const EXPRESS::ConversionSchema *schema;
+
+    ArgumentStorage args_storage;
+
+    // serializes LazyObject::LazyInit(), converters evaluate referenced objects recursively
+    std::recursive_mutex evaluation_mutex;
 };
 
 #ifdef _MSC_VER
@@ -100,17 +100,16 @@ void ExportSceneStep(const char* pFile,IOSystem* pIOSystem, const aiScene* pScen
     // create/copy Properties
     ExportProperties props(*pProperties);
 
-    // invoke the exporter
-    StepExporter iDoTheExportThing( pScene, pIOSystem, path, file, &props);
-
-    // we're still here - export successfully completed. Write result to the given IOSYstem
-    std::unique_ptr<IOStream> outfile (pIOSystem->Open(pFile,"wt"));
-    if (outfile == nullptr) {
+    // the output is written while it is generated
+    ExportOutputFile outfile (pIOSystem, pFile, "wt");
+    if (outfile.Get() == nullptr) {
         throw DeadlyExportError("could not open output .stp file: " + std::string(pFile));
     }
 
-    // XXX maybe use a small wrapper around IOStream that behaves like std::stringstream in order to avoid the extra copy.
-    outfile->Write( iDoTheExportThing.mOutput.str().c_str(), static_cast<size_t>(iDoTheExportThing.mOutput.tellp()),1);
+    // invoke the exporter
+    StepExporter iDoTheExportThing( pScene, pIOSystem, path, file, &props, outfile.Get());
+    iDoTheExportThing.mOutput.Flush();
+    outfile.Commit();
 }
 
 } // end of namespace Assimp
@@ -140,15 +139,13 @@ namespace {
 // ------------------------------------------------------------------------------------------------
 // Constructor for a specific scene to export
 StepExporter::StepExporter(const aiScene* pScene, IOSystem* pIOSystem, const std::string& path,
-    const std::string& file, const ExportProperties* pProperties) :
-    mProperties(pProperties), mIOSystem(pIOSystem), mFile(file), mPath(path),
+    const std::string& file, const ExportProperties* pProperties, IOStream* pStream) :
+    mOutput(pStream), mProperties(pProperties), mIOSystem(pIOSystem), mFile(file), mPath(path),
     mScene(pScene), endstr(";\n") {
     CollectTrafos(pScene->mRootNode, trafos);
     CollectMeshes(pScene->mRootNode, meshes);
 
-    // make sure that all formatting happens using the standard, C locale and not the user's current locale
-    mOutput.imbue(std::locale("C"));
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
+    mOutput.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
 
     // start writing
     WriteFile();
@@ -160,10 +157,10 @@ void StepExporter::WriteFile()
 {
     // see http://shodhganga.inflibnet.ac.in:8080/jspui/bitstream/10603/14116/11/11_chapter%203.pdf
     // note, that all realnumber values must be comma separated in x files
-    mOutput.setf(std::ios::fixed);
+    mOutput.SetFixed(true);
     // precision for double
     // see http://stackoverflow.com/questions/554063/how-do-i-print-a-double-value-with-full-precision-using-cout
-    mOutput.precision(ASSIMP_AI_REAL_TEXT_PRECISION);
+    mOutput.SetPrecision(ASSIMP_AI_REAL_TEXT_PRECISION);
 
     // standard color
     aiColor4D fColor;
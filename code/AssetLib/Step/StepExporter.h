@@ -50,7 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ai_assert.h>
 #include <assimp/matrix4x4.h>
 #include <assimp/Exporter.hpp>
-#include <sstream>
+#include "Common/TextStreamWriter.h"
 
 
 struct aiScene;
@@ -65,7 +65,7 @@ class StepExporter
 {
 public:
     /// Constructor for a specific scene to export
-    StepExporter(const aiScene* pScene, IOSystem* pIOSystem, const std::string& path, const std::string& file, const ExportProperties* pProperties);
+    StepExporter(const aiScene* pScene, IOSystem* pIOSystem, const std::string& path, const std::string& file, const ExportProperties* pProperties, IOStream* pStream);
 
 protected:
     /// Starts writing the contents
@@ -73,8 +73,8 @@ protected:
 
 public:
 
-    /// Stringstream to write all output into
-    std::stringstream mOutput;
+    /// Buffered writer the output goes to while it is generated
+    TextStreamWriter mOutput;
 
 protected:
 
@@ -54,6 +54,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *   KHR_materials_ior full
  *   KHR_materials_emissive_strength full
  *   KHR_materials_anisotropy full
+ *   KHR_mesh_quantization full
+ *   EXT_meshopt_compression full
  */
 #ifndef GLTF2ASSET_H_INC
 #define GLTF2ASSET_H_INC
@@ -120,6 +122,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/GltfMaterial.h>
 
 #include "AssetLib/glTFCommon/glTFCommon.h"
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
 
 namespace glTF2 {
 
@@ -460,6 +463,9 @@ public:
 
     Type type;
 
+    //! Buffer without data of its own, only the EXT_meshopt_compression buffer views refer to it
+    bool meshoptFallback = false;
+
     /// \var EncodedRegion_Current
     /// Pointer to currently active encoded region.
     /// Why not decoding all regions at once and not to set one buffer with decoded data?
@@ -485,6 +491,7 @@ public:
 private:
     shared_ptr<uint8_t> mData; //!< Pointer to the data
     bool mIsSpecial; //!< Set to true for special cases (e.g. the body buffer)
+    size_t mFlushedLength = 0; //!< Leading bytes already handed out by Flush(), mData starts behind them
 
     /// \var EncodedRegion_List
     /// List of encoded regions.
@@ -500,6 +507,11 @@ public:
 
     bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
 
+    /// Like above, but references the data of streams which support
+    /// IOStream::GetMappedData() instead of copying it. The buffer then
+    /// keeps the stream alive.
+    bool LoadFromStream(const std::shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
+
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
     /// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
@@ -527,8 +539,16 @@ public:
     size_t AppendData(uint8_t *data, size_t length);
     void Grow(size_t amount);
 
+    /// Writes the data held in memory to \p stream and releases it, or just releases it
+    /// when \p stream is nullptr. byteLength keeps counting the flushed bytes, so offsets
+    /// of data appended afterwards stay absolute. Used by the streaming GLB export.
+    void Flush(IOStream *stream);
+
     uint8_t *GetPointer() { return mData.get(); }
 
+    /// Pointer to the byte at \p offset, which must not have been flushed yet
+    uint8_t *GetPointerAt(size_t offset) { return mData.get() + (offset - mFlushedLength); }
+
     void MarkAsSpecial() { mIsSpecial = true; }
 
     bool IsSpecial() const override { return mIsSpecial; }
@@ -538,6 +558,33 @@ public:
     static const char *TranslateId(Asset &r, const char *id);
 };
 
+//! The compressed data of a buffer view (EXT_meshopt_compression)
+struct MeshoptCompression {
+    enum Mode {
+        Mode_ATTRIBUTES,
+        Mode_TRIANGLES,
+        Mode_INDICES
+    };
+
+    enum Filter {
+        Filter_NONE,
+        Filter_OCTAHEDRAL,
+        Filter_QUATERNION,
+        Filter_EXPONENTIAL
+    };
+
+    Ref<Buffer> buffer; //!< The buffer with the compressed data. (required)
+    size_t byteOffset = 0; //!< The offset into the buffer in bytes. (default: 0)
+    size_t byteLength = 0; //!< The length of the compressed data in bytes. (required)
+    unsigned int byteStride = 0; //!< The stride of the decoded elements in bytes. (required)
+    size_t count = 0; //!< The number of decoded elements. (required)
+    Mode mode = Mode_ATTRIBUTES; //!< The compression mode. (required)
+    Filter filter = Filter_NONE; //!< The filter applied after decoding. (default: NONE)
+
+    static const char *ToString(Mode mode);
+    static const char *ToString(Filter filter);
+};
+
 //! A view into a buffer generally representing a subset of the buffer.
 struct BufferView : public Object {
     Ref<Buffer> buffer; //! The ID of the buffer. (required)
@@ -547,8 +594,13 @@ struct BufferView : public Object {
 
     BufferViewTarget target; //! The target that the WebGL buffer should be bound to.
 
+    Nullable<MeshoptCompression> meshopt; //!< Compressed data, decoded into buffer on import
+
     void Read(Value &obj, Asset &r);
     uint8_t *GetPointerAndTailSize(size_t accOffset, size_t& outTailSize);
+
+private:
+    void ReadMeshopt(Value &obj, Asset &r);
 };
 
 //! A typed view into a BufferView. A BufferView contains raw binary data.
@@ -562,6 +614,7 @@ struct Accessor : public Object {
     ComponentType componentType; //!< The datatype of components in the attribute. (required)
     size_t count; //!< The number of attributes referenced by this accessor. (required)
     AttribType::Value type; //!< Specifies if the attribute is a scalar, vector, or matrix. (required)
+    bool normalized = false; //!< Whether integer values are mapped to [0, 1] or [-1, 1]. (default: false)
     std::vector<double> max; //!< Maximum value of each component in this attribute.
     std::vector<double> min; //!< Minimum value of each component in this attribute.
     std::unique_ptr<Sparse> sparse;
@@ -616,6 +669,52 @@ struct Accessor : public Object {
         return Indexer(*this);
     }
 
+    //! Typed, read-only view of the elements, the data is not copied
+    template <class T>
+    class View {
+        friend struct Accessor;
+
+        const uint8_t *data;
+        size_t elemSize, stride, count;
+
+        View(const uint8_t *data, size_t elemSize, size_t stride, size_t count) :
+                data(data), elemSize(elemSize), stride(stride), count(count) {}
+
+    public:
+        //! Returns the i-th element, elements smaller than T are zero-padded
+        inline T operator[](size_t i) const {
+            T value = T();
+            if (elemSize == sizeof(T)) {
+                memcpy(&value, data + i * stride, sizeof(T));
+            } else {
+                memcpy(&value, data + i * stride, elemSize);
+            }
+            return value;
+        }
+
+        //! Number of elements
+        inline size_t size() const {
+            return count;
+        }
+
+        //! Whether the elements are stored as a tightly packed array of T
+        inline bool IsPacked() const {
+            return elemSize == sizeof(T) && stride == sizeof(T);
+        }
+
+        //! Pointer to the first element
+        inline const uint8_t *GetData() const {
+            return data;
+        }
+    };
+
+    //! Returns a view of the elements as T, the range of all elements is validated once
+    template <class T>
+    View<T> GetView();
+
+    //! Converts integer components to float (KHR_mesh_quantization), normalized values are mapped to [0, 1] or [-1, 1]
+    void Dequantize();
+
     Accessor() = default;
     void Read(Value &obj, Asset &r);
 
@@ -1150,6 +1249,8 @@ public:
         bool KHR_draco_mesh_compression;
         bool FB_ngon_encoding;
         bool KHR_texture_basisu;
+        bool KHR_mesh_quantization;
+        bool EXT_meshopt_compression;
 
         Extensions() :
                 KHR_materials_pbrSpecularGlossiness(false),
@@ -1166,7 +1267,9 @@ public:
                 KHR_materials_anisotropy(false),
                 KHR_draco_mesh_compression(false),
                 FB_ngon_encoding(false),
-                KHR_texture_basisu(false) {
+                KHR_texture_basisu(false),
+                KHR_mesh_quantization(false),
+                EXT_meshopt_compression(false) {
             // empty
         }
     } extensionsUsed;
@@ -1175,8 +1278,14 @@ public:
     struct RequiredExtensions {
         bool KHR_draco_mesh_compression;
         bool KHR_texture_basisu;
+        bool KHR_mesh_quantization;
+        bool EXT_meshopt_compression;
 
-        RequiredExtensions() : KHR_draco_mesh_compression(false), KHR_texture_basisu(false) {
+        RequiredExtensions() :
+                KHR_draco_mesh_compression(false),
+                KHR_texture_basisu(false),
+                KHR_mesh_quantization(false),
+                EXT_meshopt_compression(false) {
             // empty
         }
     } extensionsRequired;
@@ -582,7 +582,11 @@ inline void Buffer::Read(Value &obj, Asset &r) {
 
     Value *it = FindString(obj, "uri");
     if (!it) {
-        if (statedLength > 0) {
+        if (Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression")) {
+            // the data is decoded from the compressed buffer views which refer to this buffer
+            meshoptFallback = MemberOrDefault(*meshoptExt, "fallback", false);
+        }
+        if (statedLength > 0 && !meshoptFallback) {
             throw DeadlyImportError("GLTF: buffer with non-zero length missing the \"uri\" attribute");
         }
         return;
@@ -614,10 +618,9 @@ inline void Buffer::Read(Value &obj, Asset &r) {
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            std::shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
+                bool ok = LoadFromStream(file, byteLength);
 
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
@@ -647,6 +650,24 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromStream(const std::shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const uint8_t *mapped = stream->GetMappedData();
+    if (nullptr == mapped) {
+        return LoadFromStream(*stream, length, baseOffset);
+    }
+
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
+    if (baseOffset > fileSize || byteLength > fileSize - baseOffset) {
+        throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
+    }
+
+    // The mapped data is never written to during import, the deleter
+    // just holds on to the stream which owns it.
+    mData.reset(const_cast<uint8_t *>(mapped + baseOffset), [stream](uint8_t *) {});
+    return true;
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t *pDecodedData, const size_t pDecodedData_Length, const std::string &pID) {
     // Check pointer to data
     if (pDecodedData == nullptr) throw DeadlyImportError("GLTF: for marking encoded region pointer to decoded data must be provided.");
@@ -709,6 +730,7 @@ inline bool Buffer::ReplaceData(const size_t pBufferData_Offset, const size_t pB
     // Apply new data
     mData.reset(new_data, std::default_delete<uint8_t[]>());
     byteLength = new_data_size;
+    capacity = new_data_size;
 
     return true;
 }
@@ -718,17 +740,20 @@ inline bool Buffer::ReplaceData_joint(const size_t pBufferData_Offset, const siz
         return false;
     }
 
+    // Offsets are absolute, the flushed part of the buffer is not held anymore
+    const size_t offset = pBufferData_Offset - mFlushedLength;
     const size_t new_data_size = byteLength + pReplace_Count - pBufferData_Count;
-    uint8_t *new_data = new uint8_t[new_data_size];
+    uint8_t *new_data = new uint8_t[new_data_size - mFlushedLength];
     // Copy data which place before replacing part.
-    memcpy(new_data, mData.get(), pBufferData_Offset);
+    memcpy(new_data, mData.get(), offset);
     // Copy new data.
-    memcpy(&new_data[pBufferData_Offset], pReplace_Data, pReplace_Count);
+    memcpy(&new_data[offset], pReplace_Data, pReplace_Count);
     // Copy data which place after replacing part.
-    memcpy(&new_data[pBufferData_Offset + pReplace_Count], &mData.get()[pBufferData_Offset + pBufferData_Count], new_data_size - (pBufferData_Offset + pReplace_Count));
+    memcpy(&new_data[offset + pReplace_Count], &mData.get()[offset + pBufferData_Count], new_data_size - (pBufferData_Offset + pReplace_Count));
     // Apply new data
     mData.reset(new_data, std::default_delete<uint8_t[]>());
     byteLength = new_data_size;
+    capacity = new_data_size;
 
     return true;
 }
@@ -739,8 +764,8 @@ inline size_t Buffer::AppendData(uint8_t *data, size_t length) {
     // Force alignment to 4 bits
     const size_t paddedLength = (length + 3) & ~3;
     Grow(paddedLength);
-    memcpy(mData.get() + offset, data, length);
-    memset(mData.get() + offset + length, 0, paddedLength - length);
+    memcpy(GetPointerAt(offset), data, length);
+    memset(GetPointerAt(offset + length), 0, paddedLength - length);
     return offset;
 }
 
@@ -758,14 +783,25 @@ inline void Buffer::Grow(size_t amount) {
     // Just allocate data which we need
     capacity = byteLength + amount;
 
-    uint8_t *b = new uint8_t[capacity];
+    uint8_t *b = new uint8_t[capacity - mFlushedLength];
     if (nullptr != mData) {
-        memcpy(b, mData.get(), byteLength);
+        memcpy(b, mData.get(), byteLength - mFlushedLength);
     }
     mData.reset(b, std::default_delete<uint8_t[]>());
     byteLength += amount;
 }
 
+inline void Buffer::Flush(IOStream *stream) {
+    const size_t length = byteLength - mFlushedLength;
+    if (stream != nullptr && length > 0 && stream->Write(mData.get(), 1, length) != length) {
+        throw DeadlyExportError("GLTF: Failed to write the data of buffer \"", id, "\"");
+    }
+
+    mData.reset();
+    mFlushedLength = byteLength;
+    capacity = byteLength;
+}
+
 //
 // struct BufferView
 //
@@ -786,6 +822,132 @@ inline void BufferView::Read(Value &obj, Asset &r) {
     if ((byteOffset + byteLength) > buffer->byteLength) {
         throw DeadlyImportError("GLTF: Buffer view with offset/length (", byteOffset, "/", byteLength, ") is out of range.");
     }
+
+    if (Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression")) {
+        ReadMeshopt(*meshoptExt, r);
+    }
+}
+
+inline void BufferView::ReadMeshopt(Value &obj, Asset &r) {
+    MeshoptCompression compression;
+    if (Value *bufferVal = FindUInt(obj, "buffer")) {
+        compression.buffer = r.buffers.Retrieve(bufferVal->GetUint());
+    }
+    if (!compression.buffer) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of buffer view ", id, " without valid buffer.");
+    }
+
+    compression.byteOffset = MemberOrDefault(obj, "byteOffset", size_t(0));
+    compression.byteLength = MemberOrDefault(obj, "byteLength", size_t(0));
+    compression.byteStride = MemberOrDefault(obj, "byteStride", 0u);
+    compression.count = MemberOrDefault(obj, "count", size_t(0));
+
+    const char *mode = MemberOrDefault<const char *>(obj, "mode", "");
+    if (strcmp(mode, "ATTRIBUTES") == 0) {
+        compression.mode = MeshoptCompression::Mode_ATTRIBUTES;
+    } else if (strcmp(mode, "TRIANGLES") == 0) {
+        compression.mode = MeshoptCompression::Mode_TRIANGLES;
+    } else if (strcmp(mode, "INDICES") == 0) {
+        compression.mode = MeshoptCompression::Mode_INDICES;
+    } else {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of buffer view ", id, " has unknown mode \"", mode, "\".");
+    }
+
+    const char *filter = MemberOrDefault<const char *>(obj, "filter", "NONE");
+    if (strcmp(filter, "NONE") == 0) {
+        compression.filter = MeshoptCompression::Filter_NONE;
+    } else if (strcmp(filter, "OCTAHEDRAL") == 0 && (compression.byteStride == 4 || compression.byteStride == 8)) {
+        compression.filter = MeshoptCompression::Filter_OCTAHEDRAL;
+    } else if (strcmp(filter, "QUATERNION") == 0 && compression.byteStride == 8) {
+        compression.filter = MeshoptCompression::Filter_QUATERNION;
+    } else if (strcmp(filter, "EXPONENTIAL") == 0 && compression.byteStride % 4 == 0) {
+        compression.filter = MeshoptCompression::Filter_EXPONENTIAL;
+    } else {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of buffer view ", id, " has invalid filter \"", filter, "\".");
+    }
+
+    meshopt = Nullable<MeshoptCompression>(compression);
+
+    // Data in a regular buffer is uncompressed already
+    if (!buffer->meshoptFallback) {
+        return;
+    }
+
+    const uint8_t *src = compression.buffer->GetPointer();
+    if (nullptr == src || compression.byteOffset + compression.byteLength > compression.buffer->byteLength) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of buffer view ", id, " with offset/length (",
+                compression.byteOffset, "/", compression.byteLength, ") is out of range.");
+    }
+    if (compression.count * compression.byteStride > byteLength) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression of buffer view ", id, " decodes to more than ", byteLength, " bytes.");
+    }
+
+    if (nullptr == buffer->GetPointer()) {
+        // The fallback buffer has the uncompressed layout, every view is decoded to its own range
+        const size_t length = buffer->byteLength;
+        buffer->byteLength = 0;
+        buffer->Grow(length);
+        memset(buffer->GetPointer(), 0, length);
+    }
+
+    uint8_t *dst = buffer->GetPointer() + byteOffset;
+    src += compression.byteOffset;
+
+    bool ok = false;
+    switch (compression.mode) {
+    case MeshoptCompression::Mode_ATTRIBUTES:
+        ok = glTFCommon::Meshopt::DecodeVertexBuffer(dst, compression.count, compression.byteStride, src, compression.byteLength);
+        break;
+    case MeshoptCompression::Mode_TRIANGLES:
+        ok = glTFCommon::Meshopt::DecodeIndexBuffer(dst, compression.count, compression.byteStride, src, compression.byteLength);
+        break;
+    case MeshoptCompression::Mode_INDICES:
+        ok = glTFCommon::Meshopt::DecodeIndexSequence(dst, compression.count, compression.byteStride, src, compression.byteLength);
+        break;
+    }
+    if (!ok) {
+        throw DeadlyImportError("GLTF: Invalid EXT_meshopt_compression data in buffer view ", id);
+    }
+
+    switch (compression.filter) {
+    case MeshoptCompression::Filter_NONE:
+        break;
+    case MeshoptCompression::Filter_OCTAHEDRAL:
+        glTFCommon::Meshopt::DecodeFilterOct(dst, compression.count, compression.byteStride);
+        break;
+    case MeshoptCompression::Filter_QUATERNION:
+        glTFCommon::Meshopt::DecodeFilterQuat(dst, compression.count);
+        break;
+    case MeshoptCompression::Filter_EXPONENTIAL:
+        glTFCommon::Meshopt::DecodeFilterExp(dst, compression.count, compression.byteStride);
+        break;
+    }
+}
+
+inline const char *MeshoptCompression::ToString(Mode mode) {
+    switch (mode) {
+    case Mode_ATTRIBUTES:
+        return "ATTRIBUTES";
+    case Mode_TRIANGLES:
+        return "TRIANGLES";
+    case Mode_INDICES:
+        return "INDICES";
+    }
+    return "";
+}
+
+inline const char *MeshoptCompression::ToString(Filter filter) {
+    switch (filter) {
+    case Filter_NONE:
+        return "NONE";
+    case Filter_OCTAHEDRAL:
+        return "OCTAHEDRAL";
+    case Filter_QUATERNION:
+        return "QUATERNION";
+    case Filter_EXPONENTIAL:
+        return "EXPONENTIAL";
+    }
+    return "";
 }
 
 inline uint8_t *BufferView::GetPointerAndTailSize(size_t accOffset, size_t& outTailSize) {
@@ -883,6 +1045,7 @@ inline void Accessor::Read(Value &obj, Asset &r) {
 
     byteOffset = MemberOrDefault(obj, "byteOffset", size_t(0));
     componentType = MemberOrDefault(obj, "componentType", ComponentType_BYTE);
+    normalized = MemberOrDefault(obj, "normalized", false);
     {
         const Value *countValue = FindUInt(obj, "count");
         if (!countValue) {
@@ -1045,7 +1208,12 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
             if (srcIdx >= maxIndexCount) {
                 throw DeadlyImportError("GLTF: index*stride ", (srcIdx * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
             }
-            memcpy(outData + i, data + srcIdx * stride, elemSize);
+            if (elemSize == targetElemSize) {
+                // a copy of constant size is a plain load and store
+                memcpy(outData + i, data + srcIdx * stride, targetElemSize);
+            } else {
+                memcpy(outData + i, data + srcIdx * stride, elemSize);
+            }
         }
     } else { // non-indexed cases
         if (usedCount * stride > maxSize) {
@@ -1062,16 +1230,99 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
     return usedCount;
 }
 
+template <class T>
+Accessor::View<T> Accessor::GetView() {
+    const uint8_t *data = GetPointer();
+    if (!data) {
+        throw DeadlyImportError("GLTF2: data is null when reading data from ", getContextForErrorMessages(id, name));
+    }
+
+    const size_t elemSize = GetElementSize();
+    if (elemSize > sizeof(T)) {
+        throw DeadlyImportError("GLTF: elemSize ", elemSize, " > targetElemSize ", sizeof(T), " in ", getContextForErrorMessages(id, name));
+    }
+
+    const size_t stride = GetStride();
+    const size_t maxSize = GetMaxByteSize();
+    if (count * stride > maxSize) {
+        throw DeadlyImportError("GLTF: count*stride ", (count * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
+    }
+
+    return View<T>(data, elemSize, stride, count);
+}
+
+template <class T>
+inline float DequantizeComponent(const uint8_t *data, bool normalized) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    if (!normalized) {
+        return static_cast<float>(value);
+    }
+    // signed types use the symmetric range, the minimum maps to -1 as well
+    return std::max(static_cast<float>(value) / static_cast<float>(std::numeric_limits<T>::max()), -1.f);
+}
+
+inline void Accessor::Dequantize() {
+    if (componentType == ComponentType_FLOAT || count == 0) {
+        return;
+    }
+
+    const uint8_t *data = GetPointer();
+    if (!data) {
+        return;
+    }
+
+    const size_t stride = GetStride();
+    const size_t maxSize = GetMaxByteSize();
+    if (count * stride > maxSize) {
+        throw DeadlyImportError("GLTF: count*stride ", (count * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
+    }
+
+    const unsigned int numComponents = GetNumComponents();
+    const unsigned int bytesPerComponent = GetBytesPerComponent();
+
+    std::unique_ptr<Buffer> decoded(new Buffer());
+    decoded->Grow(count * numComponents * sizeof(float));
+    float *out = reinterpret_cast<float *>(decoded->GetPointer());
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t *element = data + i * stride;
+        for (unsigned int c = 0; c < numComponents; ++c) {
+            const uint8_t *component = element + c * bytesPerComponent;
+            switch (componentType) {
+            case ComponentType_BYTE:
+                *out++ = DequantizeComponent<int8_t>(component, normalized);
+                break;
+            case ComponentType_UNSIGNED_BYTE:
+                *out++ = DequantizeComponent<uint8_t>(component, normalized);
+                break;
+            case ComponentType_SHORT:
+                *out++ = DequantizeComponent<int16_t>(component, normalized);
+                break;
+            case ComponentType_UNSIGNED_SHORT:
+                *out++ = DequantizeComponent<uint16_t>(component, normalized);
+                break;
+            default:
+                *out++ = DequantizeComponent<uint32_t>(component, normalized);
+                break;
+            }
+        }
+    }
+
+    componentType = ComponentType_FLOAT;
+    normalized = false;
+    decodedBuffer.swap(decoded);
+}
+
 inline void Accessor::WriteData(size_t _count, const void *src_buffer, size_t src_stride) {
-    uint8_t *buffer_ptr = bufferView->buffer->GetPointer();
     size_t offset = byteOffset + bufferView->byteOffset;
 
     size_t dst_stride = GetNumComponents() * GetBytesPerComponent();
 
     const uint8_t *src = reinterpret_cast<const uint8_t *>(src_buffer);
-    uint8_t *dst = reinterpret_cast<uint8_t *>(buffer_ptr + offset);
+    uint8_t *dst = bufferView->buffer->GetPointerAt(offset);
 
-    ai_assert(dst + _count * dst_stride <= buffer_ptr + bufferView->buffer->byteLength);
+    ai_assert(offset + _count * dst_stride <= bufferView->buffer->byteLength);
     CopyData(_count, src, src_stride, dst, dst_stride);
 }
 
@@ -1080,12 +1331,11 @@ inline void Accessor::WriteSparseValues(size_t _count, const void *src_data, siz
         return;
 
     // values
-    uint8_t *value_buffer_ptr = sparse->values->buffer->GetPointer();
     size_t value_offset = sparse->valuesByteOffset + sparse->values->byteOffset;
     size_t value_dst_stride = GetNumComponents() * GetBytesPerComponent();
     const uint8_t *value_src = reinterpret_cast<const uint8_t *>(src_data);
-    uint8_t *value_dst = reinterpret_cast<uint8_t *>(value_buffer_ptr + value_offset);
-    ai_assert(value_dst + _count * value_dst_stride <= value_buffer_ptr + sparse->values->buffer->byteLength);
+    uint8_t *value_dst = sparse->values->buffer->GetPointerAt(value_offset);
+    ai_assert(value_offset + _count * value_dst_stride <= sparse->values->buffer->byteLength);
     CopyData(_count, value_src, src_dataStride, value_dst, value_dst_stride);
 }
 
@@ -1094,12 +1344,11 @@ inline void Accessor::WriteSparseIndices(size_t _count, const void *src_idx, siz
         return;
 
     // indices
-    uint8_t *indices_buffer_ptr = sparse->indices->buffer->GetPointer();
     size_t indices_offset = sparse->indicesByteOffset + sparse->indices->byteOffset;
     size_t indices_dst_stride = 1 * sizeof(unsigned short);
     const uint8_t *indices_src = reinterpret_cast<const uint8_t *>(src_idx);
-    uint8_t *indices_dst = reinterpret_cast<uint8_t *>(indices_buffer_ptr + indices_offset);
-    ai_assert(indices_dst + _count * indices_dst_stride <= indices_buffer_ptr + sparse->indices->buffer->byteLength);
+    uint8_t *indices_dst = sparse->indices->buffer->GetPointerAt(indices_offset);
+    ai_assert(indices_offset + _count * indices_dst_stride <= sparse->indices->buffer->byteLength);
     CopyData(_count, indices_src, src_idxStride, indices_dst, indices_dst_stride);
 }
 
@@ -1486,6 +1735,14 @@ inline void MaterialAnisotropy::SetDefaults() {
     anisotropyRotation = 0.f;
 }
 
+inline void DequantizeAccessors(Mesh::AccessorList &accessors) {
+    for (Ref<Accessor> &accessor : accessors) {
+        if (accessor) {
+            accessor->Dequantize();
+        }
+    }
+}
+
 inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
     Value *curName = FindMember(pJSON_Object, "name");
     if (nullptr != curName && curName->IsString()) {
@@ -1621,6 +1878,19 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                 }
             }
 
+            // Attributes in integer formats (KHR_mesh_quantization, normalized weights) are converted
+            // once, so the consumers only have to deal with float data
+            DequantizeAccessors(prim.attributes.position);
+            DequantizeAccessors(prim.attributes.normal);
+            DequantizeAccessors(prim.attributes.tangent);
+            DequantizeAccessors(prim.attributes.texcoord);
+            DequantizeAccessors(prim.attributes.weight);
+            for (Primitive::Target &target : prim.targets) {
+                DequantizeAccessors(target.position);
+                DequantizeAccessors(target.normal);
+                DequantizeAccessors(target.tangent);
+            }
+
             if(this->targetNames.empty())
             {
                 Value *curExtras = FindObject(primitive, "extras");
@@ -1835,6 +2105,10 @@ inline void Animation::Read(Value &obj, Asset &r) {
             }
             if (Value *output = FindUInt(sampler, "output")) {
                 s.output = r.accessors.Retrieve(output->GetUint());
+                // rotations and weights may be stored as normalized integers
+                if (s.output) {
+                    s.output->Dequantize();
+                }
             }
             s.interpolation = Interpolation_LINEAR;
             if (Value *interpolation = FindString(sampler, "interpolation")) {
@@ -2053,7 +2327,7 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2157,6 +2431,8 @@ inline void Asset::ReadExtensionsRequired(Document &doc) {
 
     CHECK_REQUIRED_EXT(KHR_draco_mesh_compression);
     CHECK_REQUIRED_EXT(KHR_texture_basisu);
+    CHECK_REQUIRED_EXT(KHR_mesh_quantization);
+    CHECK_REQUIRED_EXT(EXT_meshopt_compression);
 
 #undef CHECK_REQUIRED_EXT
 }
@@ -2187,6 +2463,8 @@ inline void Asset::ReadExtensionsUsed(Document &doc) {
     CHECK_EXT(KHR_materials_anisotropy);
     CHECK_EXT(KHR_draco_mesh_compression);
     CHECK_EXT(KHR_texture_basisu);
+    CHECK_EXT(KHR_mesh_quantization);
+    CHECK_EXT(EXT_meshopt_compression);
 
 #undef CHECK_EXT
 }
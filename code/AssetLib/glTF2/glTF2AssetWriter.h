@@ -91,6 +91,13 @@ public:
 
     void WriteFile(const char* path);
     void WriteGLBFile(const char* path);
+
+    /// Writes the GLB header, the JSON chunk and the header of the binary chunk.
+    /// The data of the body buffer and WriteGLBPadding() have to follow.
+    void WriteGLBHeader(IOStream& outfile);
+
+    /// Pads a chunk of \p length bytes to a multiple of 4
+    static void WriteGLBPadding(IOStream& outfile, size_t length);
 };
 
 }
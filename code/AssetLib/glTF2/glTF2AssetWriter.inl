@@ -113,6 +113,9 @@ namespace glTF2 {
             obj.AddMember("byteOffset", (unsigned int)a.byteOffset, w.mAl);
         }
         obj.AddMember("componentType", int(a.componentType), w.mAl);
+        if (a.normalized) {
+            obj.AddMember("normalized", true, w.mAl);
+        }
         obj.AddMember("count", (unsigned int)a.count, w.mAl);
         obj.AddMember("type", StringRef(AttribType::ToString(a.type)), w.mAl);
         Value vTmpMax, vTmpMin;
@@ -221,6 +224,19 @@ namespace glTF2 {
     {
         obj.AddMember("byteLength", static_cast<uint64_t>(b.byteLength), w.mAl);
 
+        if (b.meshoptFallback) {
+            // no data of its own, the compressed buffer views are decoded into it
+            Value meshoptExt;
+            meshoptExt.SetObject();
+            meshoptExt.AddMember("fallback", true, w.mAl);
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", meshoptExt, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+            return;
+        }
+
         const auto uri = b.GetURI();
         const auto relativeUri = uri.substr(uri.find_last_of("/\\") + 1u);
         obj.AddMember("uri", Value(relativeUri, w.mAl).Move(), w.mAl);
@@ -237,6 +253,27 @@ namespace glTF2 {
         if (bv.target != BufferViewTarget_NONE) {
             obj.AddMember("target", int(bv.target), w.mAl);
         }
+
+        if (bv.meshopt.isPresent) {
+            MeshoptCompression &compression = bv.meshopt.value;
+
+            Value meshoptExt;
+            meshoptExt.SetObject();
+            meshoptExt.AddMember("buffer", compression.buffer->index, w.mAl);
+            meshoptExt.AddMember("byteOffset", static_cast<uint64_t>(compression.byteOffset), w.mAl);
+            meshoptExt.AddMember("byteLength", static_cast<uint64_t>(compression.byteLength), w.mAl);
+            meshoptExt.AddMember("byteStride", compression.byteStride, w.mAl);
+            meshoptExt.AddMember("count", static_cast<uint64_t>(compression.count), w.mAl);
+            meshoptExt.AddMember("mode", StringRef(MeshoptCompression::ToString(compression.mode)), w.mAl);
+            if (compression.filter != MeshoptCompression::Filter_NONE) {
+                meshoptExt.AddMember("filter", StringRef(MeshoptCompression::ToString(compression.filter)), w.mAl);
+            }
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", meshoptExt, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+        }
     }
 
     inline void Write(Value& /*obj*/, Camera& /*c*/, AssetWriter& /*w*/)
@@ -871,6 +908,9 @@ namespace glTF2 {
         // Write buffer data to separate .bin files
         for (unsigned int i = 0; i < mAsset.buffers.Size(); ++i) {
             Ref<Buffer> b = mAsset.buffers.Get(i);
+            if (b->meshoptFallback) {
+                continue;
+            }
 
             std::string binPath = b->GetURI();
 
@@ -896,20 +936,36 @@ namespace glTF2 {
             throw DeadlyExportError("Could not open output file: " + std::string(path));
         }
 
+        WriteGLBHeader(*outfile);
+
+        //
+        // Binary chunk data
+        //
+
+        Ref<Buffer> bodyBuffer = mAsset.GetBodyBuffer();
+        if (bodyBuffer->byteLength > 0) {
+            if (outfile->Write(bodyBuffer->GetPointer(), 1, bodyBuffer->byteLength) != bodyBuffer->byteLength) {
+                throw DeadlyExportError("Failed to write body data!");
+            }
+            WriteGLBPadding(*outfile, bodyBuffer->byteLength);
+        }
+    }
+
+    inline void AssetWriter::WriteGLBHeader(IOStream& outfile)
+    {
         Ref<Buffer> bodyBuffer = mAsset.GetBodyBuffer();
         if (bodyBuffer->byteLength > 0) {
             rapidjson::Value glbBodyBuffer;
             glbBodyBuffer.SetObject();
             glbBodyBuffer.AddMember("byteLength", static_cast<uint64_t>(bodyBuffer->byteLength), mAl);
-            mDoc["buffers"].PushBack(glbBodyBuffer, mAl);
-        }
+            Value &buffers = mDoc["buffers"];
+            buffers.PushBack(glbBodyBuffer, mAl);
 
-        // Padding with spaces as required by the spec
-        uint32_t padding = 0x20202020;
-
-        //
-        // JSON chunk
-        //
+            // Move the body buffer to its index, other buffers may have been written before it
+            for (rapidjson::SizeType i = buffers.Size() - 1; i > static_cast<rapidjson::SizeType>(bodyBuffer->index); --i) {
+                buffers[i].Swap(buffers[i - 1]);
+            }
+        }
 
         StringBuffer docBuffer;
         Writer<StringBuffer> writer(docBuffer);
@@ -917,71 +973,73 @@ namespace glTF2 {
             throw DeadlyExportError("Failed to write scene data!");
         }
 
-        uint32_t jsonChunkLength = static_cast<uint32_t>((docBuffer.GetSize() + 3) & ~3); // Round up to next multiple of 4
-        auto paddingLength = jsonChunkLength - docBuffer.GetSize();
+        // All chunk lengths are known up front, so the file is written front to back
+        const uint64_t jsonChunkLength = (docBuffer.GetSize() + 3) & ~3; // Round up to next multiple of 4
+        const uint64_t binaryChunkLength = (bodyBuffer->byteLength + 3) & ~3;
+        const int GLB_Chunk_count = bodyBuffer->byteLength > 0 ? 2 : 1;
+        const uint64_t length = sizeof(GLB_Header) + GLB_Chunk_count * sizeof(GLB_Chunk) + jsonChunkLength + binaryChunkLength;
+        if (length > std::numeric_limits<uint32_t>::max()) {
+            throw DeadlyExportError("GLB files are limited to 4GB, the scene needs ", length, " bytes");
+        }
+
+        //
+        // Header
+        //
+
+        GLB_Header header;
+        memcpy(header.magic, AI_GLB_MAGIC_NUMBER, sizeof(header.magic));
+
+        header.version = 2;
+        AI_SWAP4(header.version);
+
+        header.length = static_cast<uint32_t>(length);
+        AI_SWAP4(header.length);
+
+        if (outfile.Write(&header, 1, sizeof(GLB_Header)) != sizeof(GLB_Header)) {
+            throw DeadlyExportError("Failed to write the header!");
+        }
+
+        //
+        // JSON chunk
+        //
 
         GLB_Chunk jsonChunk;
-        jsonChunk.chunkLength = jsonChunkLength;
+        jsonChunk.chunkLength = static_cast<uint32_t>(jsonChunkLength);
         jsonChunk.chunkType = ChunkType_JSON;
         AI_SWAP4(jsonChunk.chunkLength);
 
-        outfile->Seek(sizeof(GLB_Header), aiOrigin_SET);
-        if (outfile->Write(&jsonChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
+        if (outfile.Write(&jsonChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
             throw DeadlyExportError("Failed to write scene data header!");
         }
-        if (outfile->Write(docBuffer.GetString(), 1, docBuffer.GetSize()) != docBuffer.GetSize()) {
+        if (outfile.Write(docBuffer.GetString(), 1, docBuffer.GetSize()) != docBuffer.GetSize()) {
             throw DeadlyExportError("Failed to write scene data!");
         }
-        if (paddingLength && outfile->Write(&padding, 1, paddingLength) != paddingLength) {
-            throw DeadlyExportError("Failed to write scene data padding!");
-        }
+        WriteGLBPadding(outfile, docBuffer.GetSize());
 
         //
-        // Binary chunk
+        // Binary chunk header, the data follows
         //
 
-        int GLB_Chunk_count = 1;
-        uint32_t binaryChunkLength = 0;
         if (bodyBuffer->byteLength > 0) {
-            binaryChunkLength = static_cast<uint32_t>((bodyBuffer->byteLength + 3) & ~3); // Round up to next multiple of 4
-
-            auto curPaddingLength = binaryChunkLength - bodyBuffer->byteLength;
-            ++GLB_Chunk_count;
-
             GLB_Chunk binaryChunk;
-            binaryChunk.chunkLength = binaryChunkLength;
+            binaryChunk.chunkLength = static_cast<uint32_t>(binaryChunkLength);
             binaryChunk.chunkType = ChunkType_BIN;
             AI_SWAP4(binaryChunk.chunkLength);
 
-            size_t bodyOffset = sizeof(GLB_Header) + sizeof(GLB_Chunk) + jsonChunk.chunkLength;
-            outfile->Seek(bodyOffset, aiOrigin_SET);
-            if (outfile->Write(&binaryChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
+            if (outfile.Write(&binaryChunk, 1, sizeof(GLB_Chunk)) != sizeof(GLB_Chunk)) {
                 throw DeadlyExportError("Failed to write body data header!");
             }
-            if (outfile->Write(bodyBuffer->GetPointer(), 1, bodyBuffer->byteLength) != bodyBuffer->byteLength) {
-                throw DeadlyExportError("Failed to write body data!");
-            }
-            if (curPaddingLength && outfile->Write(&padding, 1, curPaddingLength) != curPaddingLength) {
-                throw DeadlyExportError("Failed to write body data padding!");
-            }
         }
+    }
 
-        //
-        // Header
-        //
-
-        GLB_Header header;
-        memcpy(header.magic, AI_GLB_MAGIC_NUMBER, sizeof(header.magic));
-
-        header.version = 2;
-        AI_SWAP4(header.version);
-
-        header.length = uint32_t(sizeof(GLB_Header) + GLB_Chunk_count * sizeof(GLB_Chunk) + jsonChunkLength + binaryChunkLength);
-        AI_SWAP4(header.length);
+    inline void AssetWriter::WriteGLBPadding(IOStream& outfile, size_t length)
+    {
+        // Padding with spaces as required by the spec
+        const uint32_t padding = 0x20202020;
 
-        outfile->Seek(0, aiOrigin_SET);
-        if (outfile->Write(&header, 1, sizeof(GLB_Header)) != sizeof(GLB_Header)) {
-            throw DeadlyExportError("Failed to write the header!");
+        const size_t paddingLength = (4 - length % 4) % 4;
+        if (paddingLength && outfile.Write(&padding, 1, paddingLength) != paddingLength) {
+            throw DeadlyExportError("Failed to write chunk padding!");
         }
     }
 
@@ -1049,18 +1107,36 @@ namespace glTF2 {
             if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
                 exts.PushBack(StringRef("KHR_texture_basisu"), mAl);
             }
+
+            if (this->mAsset.extensionsUsed.KHR_mesh_quantization) {
+                exts.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+            }
+
+            if (this->mAsset.extensionsUsed.EXT_meshopt_compression) {
+                exts.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+            }
         }
 
         if (!exts.Empty())
             mDoc.AddMember("extensionsUsed", exts, mAl);
 
-        //basisu extensionRequired
         Value extsReq;
         extsReq.SetArray();
         if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
             extsReq.PushBack(StringRef("KHR_texture_basisu"), mAl);
-            mDoc.AddMember("extensionsRequired", extsReq, mAl);
         }
+
+        // Quantized attributes and compressed buffers can't be read without the extension
+        if (this->mAsset.extensionsRequired.KHR_mesh_quantization) {
+            extsReq.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+        }
+
+        if (this->mAsset.extensionsRequired.EXT_meshopt_compression) {
+            extsReq.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+        }
+
+        if (!extsReq.Empty())
+            mDoc.AddMember("extensionsRequired", extsReq, mAl);
     }
 
     template<class T>
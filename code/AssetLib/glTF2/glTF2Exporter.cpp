@@ -100,9 +100,39 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
         mAsset->SetAsBinary();
     }
 
+    const bool compress = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION);
+    if (isBinary && mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_STREAM_BINARY)) {
+        if (!compress) {
+            ExportStreamedGLB(filename);
+            return;
+        }
+        ASSIMP_LOG_WARN("glTF2: EXPORT_GLTF_STREAM_BINARY is ignored together with EXPORT_GLTF_MESHOPT_COMPRESSION");
+    }
+
+    ExportAsset();
+
+    if (compress) {
+        CompressBuffers();
+    }
+
+    ExportExtras();
+
+    AssetWriter writer(*mAsset);
+
+    if (isBinary) {
+        writer.WriteGLBFile(filename);
+    } else {
+        writer.WriteFile(filename);
+    }
+}
+
+glTF2Exporter::~glTF2Exporter() = default;
+
+void glTF2Exporter::ExportAsset() {
     ExportMetadata();
 
     ExportMaterials();
+    FlushBody();
 
     if (mScene->mRootNode) {
         ExportNodeHierarchy(mScene->mRootNode);
@@ -114,23 +144,58 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
     ExportScene();
 
     ExportAnimations();
+    FlushBody();
+}
 
-    // export extras
+void glTF2Exporter::ExportExtras() {
     if (mProperties->HasPropertyCallback("extras")) {
         std::function<void *(void *)> ExportExtras = mProperties->GetPropertyCallback("extras");
         mAsset->extras = (rapidjson::Value *)ExportExtras(0);
     }
+}
 
-    AssetWriter writer(*mAsset);
+/*
+ * GLB needs the JSON chunk in front of the binary chunk, but the offsets in the JSON are
+ * only known once all data is converted. The scene is thus converted twice: the first pass
+ * drops the body data after every mesh and writes the header and the JSON, the second pass
+ * writes the body data straight behind it. Only the data of one mesh is held in memory.
+ */
+void glTF2Exporter::ExportStreamedGLB(const char *filename) {
+    mStreamBody = true;
+    ExportAsset();
+    ExportExtras();
+
+    std::unique_ptr<IOStream> outfile(mIOSystem->Open(filename, "wb"));
+    if (outfile == nullptr) {
+        throw DeadlyExportError("Could not open output file: " + std::string(filename));
+    }
 
-    if (isBinary) {
-        writer.WriteGLBFile(filename);
-    } else {
-        writer.WriteFile(filename);
+    {
+        AssetWriter writer(*mAsset);
+        writer.WriteGLBHeader(*outfile);
+    }
+    const size_t bodyLength = mAsset->GetBodyBuffer()->byteLength;
+
+    mAsset.reset(new Asset(mIOSystem));
+    mAsset->extensionsUsed.FB_ngon_encoding = true;
+    mAsset->SetAsBinary();
+    mTexturesByPath.clear();
+
+    mBodyStream = outfile.get();
+    ExportAsset();
+    mBodyStream = nullptr;
+
+    if (mAsset->GetBodyBuffer()->byteLength != bodyLength) {
+        throw DeadlyExportError("glTF2: The streamed body data does not match the layout of the first pass");
     }
+    AssetWriter::WriteGLBPadding(*outfile, bodyLength);
 }
 
-glTF2Exporter::~glTF2Exporter() = default;
+void glTF2Exporter::FlushBody() {
+    if (mStreamBody) {
+        mAsset->GetBodyBuffer()->Flush(mBodyStream);
+    }
+}
 
 /*
  * Copy a 4x4 matrix from struct aiMatrix to typedef mat4.
@@ -433,6 +498,97 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     return acc;
 }
 
+inline int16_t QuantizeSnorm16(ai_real v) {
+    return static_cast<int16_t>(std::lround(std::max(std::min(v, ai_real(1.0)), ai_real(-1.0)) * 32767));
+}
+
+inline uint16_t QuantizeUnorm16(ai_real v) {
+    return static_cast<uint16_t>(std::lround(std::max(std::min(v, ai_real(1.0)), ai_real(0.0)) * 65535));
+}
+
+// Writes normalized integer data (KHR_mesh_quantization), every element is padded to numCompsStride
+// components so the attribute stays 4 byte aligned
+template <typename T>
+inline Ref<Accessor> ExportNormalizedData(Asset &a, std::string &meshName, Ref<Buffer> &buffer, std::vector<T> &data,
+        unsigned int numCompsStride, AttribType::Value type, ComponentType compType) {
+    const size_t count = data.size() / numCompsStride;
+    if (!count) {
+        return Ref<Accessor>();
+    }
+
+    size_t padding = (4 - buffer->byteLength % 4) % 4;
+    if (padding) {
+        buffer->Grow(padding);
+        memset(buffer->GetPointerAt(buffer->byteLength - padding), 0, padding);
+    }
+
+    const size_t length = data.size() * sizeof(T);
+
+    Ref<BufferView> bv = a.bufferViews.Create(a.FindUniqueID(meshName, "view"));
+    bv->buffer = buffer;
+    bv->byteOffset = buffer->AppendData(reinterpret_cast<uint8_t *>(data.data()), length);
+    bv->byteLength = length;
+    bv->byteStride = numCompsStride * sizeof(T);
+    bv->target = BufferViewTarget_ARRAY_BUFFER;
+
+    Ref<Accessor> acc = a.accessors.Create(a.FindUniqueID(meshName, "accessor"));
+    acc->bufferView = bv;
+    acc->byteOffset = 0;
+    acc->componentType = compType;
+    acc->normalized = true;
+    acc->count = count;
+    acc->type = type;
+
+    SetAccessorRange(compType, acc, data.data(), count, numCompsStride, AttribType::GetNumComponents(type));
+
+    return acc;
+}
+
+inline Ref<Accessor> ExportQuantizedNormals(Asset &a, std::string &meshName, Ref<Buffer> &buffer, const std::vector<aiVector3D> &normals) {
+    std::vector<int16_t> data(normals.size() * 4, 0);
+    for (size_t i = 0; i < normals.size(); ++i) {
+        const aiVector3D &n = normals[i];
+        data[i * 4 + 0] = QuantizeSnorm16(n.x);
+        data[i * 4 + 1] = QuantizeSnorm16(n.y);
+        data[i * 4 + 2] = QuantizeSnorm16(n.z);
+    }
+    return ExportNormalizedData(a, meshName, buffer, data, 4, AttribType::VEC3, ComponentType_SHORT);
+}
+
+inline Ref<Accessor> ExportQuantizedTangents(Asset &a, std::string &meshName, Ref<Buffer> &buffer, const aiMesh *aim,
+        const std::vector<aiVector3D> &tangents) {
+    std::vector<int16_t> data(aim->mNumVertices * 4);
+    for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+        const aiVector3D &t = tangents[i];
+        // the handedness is stored in w, the importer derives the bitangents from it
+        ai_real w = 1;
+        if (aim->mNormals && aim->mBitangents && ((aim->mNormals[i] ^ t) * aim->mBitangents[i]) < 0) {
+            w = -1;
+        }
+        data[i * 4 + 0] = QuantizeSnorm16(t.x);
+        data[i * 4 + 1] = QuantizeSnorm16(t.y);
+        data[i * 4 + 2] = QuantizeSnorm16(t.z);
+        data[i * 4 + 3] = QuantizeSnorm16(w);
+    }
+    return ExportNormalizedData(a, meshName, buffer, data, 4, AttribType::VEC4, ComponentType_SHORT);
+}
+
+inline Ref<Accessor> ExportQuantizedTexCoords(Asset &a, std::string &meshName, Ref<Buffer> &buffer, const std::vector<aiVector3D> &uv) {
+    // only coordinates in the unit range can be stored without an offset and scale in the texture transform
+    for (const aiVector3D &coord : uv) {
+        if (coord.x < 0 || coord.x > 1 || coord.y < 0 || coord.y > 1) {
+            return Ref<Accessor>();
+        }
+    }
+
+    std::vector<uint16_t> data(uv.size() * 2);
+    for (size_t i = 0; i < uv.size(); ++i) {
+        data[i * 2 + 0] = QuantizeUnorm16(uv[i].x);
+        data[i * 2 + 1] = QuantizeUnorm16(uv[i].y);
+    }
+    return ExportNormalizedData(a, meshName, buffer, data, 2, AttribType::VEC2, ComponentType_UNSIGNED_SHORT);
+}
+
 inline void ExportNodeExtras(const aiMetadataEntry &metadataEntry, aiString name, CustomExtension &value) {
 
     value.name = name.C_Str();
@@ -1137,11 +1293,12 @@ void ExportSkin(Asset &mAsset, const aiMesh *aimesh, Ref<Mesh> &meshRef, Ref<Buf
                 ComponentTypeSize(vertexJointAccessor->componentType);
             size_t s_bytesLen = bytesLen * s_bytesPerComp / bytesPerComp;
             Ref<Buffer> buf = vertexJointAccessor->bufferView->buffer;
-            uint8_t *arrys = new uint8_t[bytesLen];
+            // zeroed, the unsigned shorts fill only part of it and the rest stays in the buffer
+            uint8_t *arrys = new uint8_t[bytesLen]();
             unsigned int i = 0;
             for (unsigned int j = 0; j < bytesLen; j += bytesPerComp) {
                 size_t len_p = offset + j;
-                float f_value = *(float *)&buf->GetPointer()[len_p];
+                float f_value = *(float *)buf->GetPointerAt(len_p);
                 unsigned short c = static_cast<unsigned short>(f_value);
                 memcpy(&arrys[i * s_bytesPerComp], &c, s_bytesPerComp);
                 ++i;
@@ -1189,6 +1346,8 @@ void glTF2Exporter::ExportMeshes() {
         }
     }
 
+    const bool quantize = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_ATTRIBUTES);
+
     Ref<Skin> skinRef;
     std::string skinName = mAsset->FindUniqueID("skin", "skin");
     std::vector<aiMatrix4x4> inverseBindMatricesData;
@@ -1199,6 +1358,9 @@ void glTF2Exporter::ExportMeshes() {
     //----------------------------------------
 
     for (unsigned int idx_mesh = 0; idx_mesh < mScene->mNumMeshes; ++idx_mesh) {
+        // The data of the previous mesh is complete
+        FlushBody();
+
         const aiMesh *aim = mScene->mMeshes[idx_mesh];
         if (aim->mNumFaces == 0) {
             continue;
@@ -1224,28 +1386,42 @@ void glTF2Exporter::ExportMeshes() {
         }
 
         /******************** Normals ********************/
-        // Normalize all normals as the validator can emit a warning otherwise
+        // Normalize all normals as the validator can emit a warning otherwise. This happens on
+        // a copy, the streaming GLB export converts the scene twice.
+        std::vector<aiVector3D> normals;
         if (nullptr != aim->mNormals) {
-            for (auto i = 0u; i < aim->mNumVertices; ++i) {
-                aim->mNormals[i].NormalizeSafe();
+            normals.assign(aim->mNormals, aim->mNormals + aim->mNumVertices);
+            for (aiVector3D &normal : normals) {
+                normal.NormalizeSafe();
             }
         }
 
-        Ref<Accessor> n = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> n;
+        if (quantize && !normals.empty()) {
+            n = ExportQuantizedNormals(*mAsset, meshId, b, normals);
+        } else if (!normals.empty()) {
+            n = ExportData(*mAsset, meshId, b, aim->mNumVertices, normals.data(), AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        }
         if (n) {
             p.attributes.normal.push_back(n);
         }
 
         /******************** Tangents ********************/
         if (nullptr != aim->mTangents) {
-            for (uint32_t i = 0; i < aim->mNumVertices; ++i) {
-                aim->mTangents[i].NormalizeSafe();
+            std::vector<aiVector3D> tangents(aim->mTangents, aim->mTangents + aim->mNumVertices);
+            for (aiVector3D &tangent : tangents) {
+                tangent.NormalizeSafe();
+            }
+            Ref<Accessor> t;
+            if (quantize) {
+                t = ExportQuantizedTangents(*mAsset, meshId, b, aim, tangents);
+            } else {
+                t = ExportData(
+                    *mAsset, meshId, b, aim->mNumVertices, tangents.data(), AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
+                );
             }
-            Ref<Accessor> t = ExportData(
-                *mAsset, meshId, b, aim->mNumVertices, aim->mTangents, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
-            );
             if (t) {
                 p.attributes.tangent.push_back(t);
             }
@@ -1258,17 +1434,24 @@ void glTF2Exporter::ExportMeshes() {
             }
 
             // Flip UV y coords
+            std::vector<aiVector3D> uv(aim->mTextureCoords[i], aim->mTextureCoords[i] + aim->mNumVertices);
             if (aim->mNumUVComponents[i] > 1) {
-                for (unsigned int j = 0; j < aim->mNumVertices; ++j) {
-                    aim->mTextureCoords[i][j].y = 1 - aim->mTextureCoords[i][j].y;
+                for (aiVector3D &coord : uv) {
+                    coord.y = 1 - coord.y;
                 }
             }
 
             if (aim->mNumUVComponents[i] > 0) {
                 AttribType::Value type = (aim->mNumUVComponents[i] == 2) ? AttribType::VEC2 : AttribType::VEC3;
 
-                Ref<Accessor> tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mTextureCoords[i],
-                        AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                Ref<Accessor> tc;
+                if (quantize && type == AttribType::VEC2) {
+                    tc = ExportQuantizedTexCoords(*mAsset, meshId, b, uv);
+                }
+                if (!tc) {
+                    tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, uv.data(),
+                            AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                }
                 if (tc) {
                     p.attributes.texcoord.push_back(tc);
                 }
@@ -1368,10 +1551,10 @@ void glTF2Exporter::ExportMeshes() {
                 }
 
                 // normal
-                if (pAnimMesh->HasNormals() && bIncludeNormal) {
+                if (pAnimMesh->HasNormals() && bIncludeNormal && !normals.empty()) {
                     aiVector3D *pNormalDiff = new aiVector3D[pAnimMesh->mNumVertices];
                     for (unsigned int vt = 0; vt < pAnimMesh->mNumVertices; ++vt) {
-                        pNormalDiff[vt] = pAnimMesh->mNormals[vt] - aim->mNormals[vt];
+                        pNormalDiff[vt] = pAnimMesh->mNormals[vt] - normals[vt];
                     }
                     Ref<Accessor> vec;
                     if (bUseSparse) {
@@ -1440,6 +1623,16 @@ void glTF2Exporter::ExportMeshes() {
         }
         delete[] invBindMatrixData;
     }
+
+    if (quantize) {
+        for (unsigned int i = 0; i < mAsset->accessors.Size(); ++i) {
+            if (mAsset->accessors.Get(i)->normalized) {
+                mAsset->extensionsUsed.KHR_mesh_quantization = true;
+                mAsset->extensionsRequired.KHR_mesh_quantization = true;
+                break;
+            }
+        }
+    }
 }
 
 // Merges a node's multiple meshes (with one primitive each) into one mesh with multiple primitives
@@ -1491,6 +1684,141 @@ void glTF2Exporter::MergeMeshes() {
     }
 }
 
+/*
+ * Compress the vertex and index data with EXT_meshopt_compression.
+ * The compressed buffer views are moved to a fallback buffer without data of its own,
+ * the original buffer is replaced by the compressed streams and the remaining views.
+ */
+void glTF2Exporter::CompressBuffers() {
+    struct ViewLayout {
+        size_t byteStride = 0;
+        MeshoptCompression::Mode mode = MeshoptCompression::Mode_ATTRIBUTES;
+        bool compressible = false;
+        bool onlyTriangles = true;
+    };
+    std::vector<ViewLayout> layouts(mAsset->bufferViews.Size());
+
+    // the element size of a view is only known from the accessors which use it
+    for (unsigned int i = 0; i < mAsset->accessors.Size(); ++i) {
+        Ref<Accessor> acc = mAsset->accessors.Get(i);
+        if (acc->sparse) {
+            layouts[acc->sparse->indices.GetIndex()].byteStride = ~size_t(0);
+            layouts[acc->sparse->values.GetIndex()].byteStride = ~size_t(0);
+        }
+        if (!acc->bufferView) {
+            continue;
+        }
+
+        BufferView &bv = *acc->bufferView;
+        ViewLayout &layout = layouts[acc->bufferView.GetIndex()];
+        const size_t stride = bv.byteStride ? bv.byteStride : acc->GetElementSize();
+        if (layout.byteStride != 0 && layout.byteStride != stride) {
+            layout.compressible = false;
+            continue;
+        }
+
+        layout.byteStride = stride;
+        if (bv.target == BufferViewTarget_ARRAY_BUFFER) {
+            layout.mode = MeshoptCompression::Mode_ATTRIBUTES;
+            layout.compressible = stride % 4 == 0 && stride <= 256 && bv.byteLength % stride == 0;
+        } else if (bv.target == BufferViewTarget_ELEMENT_ARRAY_BUFFER) {
+            layout.mode = MeshoptCompression::Mode_INDICES;
+            layout.compressible = (stride == 2 || stride == 4) && bv.byteLength % stride == 0;
+        }
+    }
+
+    // index views which are only used by triangle lists can use the triangle codec
+    for (unsigned int i = 0; i < mAsset->meshes.Size(); ++i) {
+        for (Mesh::Primitive &p : mAsset->meshes.Get(i)->primitives) {
+            if (p.indices && p.indices->bufferView && p.mode != PrimitiveMode_TRIANGLES) {
+                layouts[p.indices->bufferView.GetIndex()].onlyTriangles = false;
+            }
+        }
+    }
+
+    bool compressed = false;
+    const unsigned int numBuffers = mAsset->buffers.Size();
+    for (unsigned int i = 0; i < numBuffers; ++i) {
+        Ref<Buffer> buffer = mAsset->buffers.Get(i);
+        if (buffer->meshoptFallback || nullptr == buffer->GetPointer()) {
+            continue;
+        }
+
+        std::vector<Ref<BufferView>> views;
+        bool hasCompressibleViews = false;
+        for (unsigned int j = 0; j < mAsset->bufferViews.Size(); ++j) {
+            Ref<BufferView> bv = mAsset->bufferViews.Get(j);
+            if (bv->buffer && bv->buffer.GetIndex() == i) {
+                views.push_back(bv);
+                hasCompressibleViews |= layouts[j].compressible;
+            }
+        }
+        if (!hasCompressibleViews) {
+            continue;
+        }
+
+        Ref<Buffer> fallback = mAsset->buffers.Create(mAsset->FindUniqueID(buffer->id, "fallback"));
+        fallback->meshoptFallback = true;
+        fallback->byteLength = buffer->byteLength;
+
+        std::vector<uint8_t> data;
+        data.reserve(buffer->byteLength);
+        for (Ref<BufferView> &bv : views) {
+            data.resize((data.size() + 3) & ~size_t(3), 0);
+            const uint8_t *src = buffer->GetPointer() + bv->byteOffset;
+
+            const ViewLayout &layout = layouts[bv.GetIndex()];
+            if (!layout.compressible) {
+                bv->byteOffset = data.size();
+                data.insert(data.end(), src, src + bv->byteLength);
+                continue;
+            }
+
+            MeshoptCompression compression;
+            compression.buffer = buffer;
+            compression.byteOffset = data.size();
+            compression.byteStride = static_cast<unsigned int>(layout.byteStride);
+            compression.count = bv->byteLength / layout.byteStride;
+            compression.mode = layout.mode;
+
+            if (layout.mode == MeshoptCompression::Mode_ATTRIBUTES) {
+                glTFCommon::Meshopt::EncodeVertexBuffer(data, src, compression.count, layout.byteStride);
+            } else {
+                std::vector<uint32_t> indices(compression.count);
+                for (size_t k = 0; k < compression.count; ++k) {
+                    if (layout.byteStride == 2) {
+                        uint16_t index;
+                        memcpy(&index, src + k * 2, sizeof(index));
+                        indices[k] = index;
+                    } else {
+                        memcpy(&indices[k], src + k * 4, sizeof(uint32_t));
+                    }
+                }
+
+                if (layout.onlyTriangles && compression.count % 3 == 0) {
+                    compression.mode = MeshoptCompression::Mode_TRIANGLES;
+                    glTFCommon::Meshopt::EncodeIndexBuffer(data, indices.data(), indices.size());
+                } else {
+                    glTFCommon::Meshopt::EncodeIndexSequence(data, indices.data(), indices.size());
+                }
+            }
+            compression.byteLength = data.size() - compression.byteOffset;
+
+            // the view keeps its place in the uncompressed layout of the fallback buffer
+            bv->buffer = fallback;
+            bv->meshopt = Nullable<MeshoptCompression>(compression);
+        }
+
+        buffer->ReplaceData(0, buffer->byteLength, data.data(), data.size());
+        compressed = true;
+    }
+
+    if (compressed) {
+        mAsset->extensionsUsed.EXT_meshopt_compression = true;
+        mAsset->extensionsRequired.EXT_meshopt_compression = true;
+    }
+}
+
 /*
  * Export the root node of the node hierarchy.
  * Calls ExportNode for all children.
@@ -1718,6 +2046,8 @@ void glTF2Exporter::ExportAnimations() {
                 AddSampler(animRef, animNode, scaleSampler, AnimationPath_SCALE);
             }
         }
+
+        FlushBody();
     } // End: for-loop mNumAnimations
 }
 
@@ -136,6 +136,11 @@ protected:
     unsigned int ExportNode(const aiNode *node, glTFCommon::Ref<glTF2::Node> &parent);
     void ExportScene();
     void ExportAnimations();
+    void CompressBuffers();
+    void ExportAsset();
+    void ExportExtras();
+    void ExportStreamedGLB(const char *filename);
+    void FlushBody();
 
 private:
     const char *mFilename;
@@ -146,6 +151,8 @@ private:
     std::shared_ptr<glTF2::Asset> mAsset;
     std::vector<unsigned char> mBodyData;
     ai_real configEpsilon;
+    bool mStreamBody = false; //!< Release the body data after every mesh, see ExportStreamedGLB()
+    IOStream *mBodyStream = nullptr; //!< Receives the released body data, nullptr drops it
 };
 
 } // namespace Assimp
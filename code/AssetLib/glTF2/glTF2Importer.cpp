@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
 
 #include <memory>
 #include <unordered_map>
@@ -457,18 +458,23 @@ static inline bool CheckValidFacesIndices(aiFace *faces, unsigned nFaces, unsign
 }
 #endif // ASSIMP_BUILD_DEBUG
 
+// Returns the index of the i-th used vertex in the accessors of a primitive
+static inline size_t GetSourceIndex(const std::vector<unsigned int> *vertexRemappingTable, size_t i) {
+    return vertexRemappingTable != nullptr ? (*vertexRemappingTable)[i] : i;
+}
+
 template <typename T>
 aiColor4D *GetVertexColorsForType(Ref<Accessor> input, std::vector<unsigned int> *vertexRemappingTable) {
     constexpr float max = std::numeric_limits<T>::max();
-    aiColor4t<T> *colors;
-    input->ExtractData(colors, vertexRemappingTable);
-    auto output = new aiColor4D[input->count];
-    for (size_t i = 0; i < input->count; i++) {
+    const Accessor::View<aiColor4t<T>> colors = input->GetView<aiColor4t<T>>();
+    const size_t numVertices = vertexRemappingTable != nullptr ? vertexRemappingTable->size() : colors.size();
+    auto output = new aiColor4D[numVertices];
+    for (size_t i = 0; i < numVertices; i++) {
+        const aiColor4t<T> color = colors[GetSourceIndex(vertexRemappingTable, i)];
         output[i] = aiColor4D(
-                colors[i].r / max, colors[i].g / max,
-                colors[i].b / max, colors[i].a / max);
+                color.r / max, color.g / max,
+                color.b / max, color.a / max);
     }
-    delete[] colors;
     return output;
 }
 
@@ -541,6 +547,16 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     }
                     indexBuffer[i] = reverseMappingIndices[index];
                 }
+
+                // All vertices are used in their original order, so the accessors can be copied as a whole
+                bool isIdentity = vertexRemappingTable->size() == numAllVertices;
+                for (size_t i = 0; isIdentity && i < vertexRemappingTable->size(); ++i) {
+                    isIdentity = (*vertexRemappingTable)[i] == i;
+                }
+                if (isIdentity) {
+                    vertexRemappingTable->clear();
+                    vertexRemappingTable = nullptr;
+                }
             }
 
             aiMesh *aim = new aiMesh();
@@ -588,19 +604,16 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                             DefaultLogger::get()->warn("Tangent count in mesh \"", mesh.name, "\" does not match the vertex count, tangents ignored.");
                         } else {
                             // generate bitangents from normals and tangents according to spec
-                            Tangent *tangents = nullptr;
-
-                            attr.tangent[0]->ExtractData(tangents, vertexRemappingTable);
+                            const Accessor::View<Tangent> tangents = attr.tangent[0]->GetView<Tangent>();
 
                             aim->mTangents = new aiVector3D[aim->mNumVertices];
                             aim->mBitangents = new aiVector3D[aim->mNumVertices];
 
                             for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                                aim->mTangents[i] = tangents[i].xyz;
-                                aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
+                                const Tangent tangent = tangents[GetSourceIndex(vertexRemappingTable, i)];
+                                aim->mTangents[i] = tangent.xyz;
+                                aim->mBitangents[i] = (aim->mNormals[i] ^ tangent.xyz) * tangent.w;
                             }
-
-                            delete[] tangents;
                         }
                     }
                 }
@@ -664,24 +677,20 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         if (target.position[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Positions of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            aiVector3D *positionDiff = nullptr;
-                            target.position[0]->ExtractData(positionDiff, vertexRemappingTable);
+                            const Accessor::View<aiVector3D> positionDiff = target.position[0]->GetView<aiVector3D>();
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
+                                aiAnimMesh.mVertices[vertexId] += positionDiff[GetSourceIndex(vertexRemappingTable, vertexId)];
                             }
-                            delete[] positionDiff;
                         }
                     }
                     if (needNormals) {
                         if (target.normal[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Normals of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            aiVector3D *normalDiff = nullptr;
-                            target.normal[0]->ExtractData(normalDiff, vertexRemappingTable);
+                            const Accessor::View<aiVector3D> normalDiff = target.normal[0]->GetView<aiVector3D>();
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
+                                aiAnimMesh.mNormals[vertexId] += normalDiff[GetSourceIndex(vertexRemappingTable, vertexId)];
                             }
-                            delete[] normalDiff;
                         }
                     }
                     if (needTangents) {
@@ -691,19 +700,16 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         } else if (target.tangent[0]->count != numAllVertices) {
                             ASSIMP_LOG_WARN("Tangents of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
                         } else {
-                            Tangent *tangent = nullptr;
-                            attr.tangent[0]->ExtractData(tangent, vertexRemappingTable);
-
-                            aiVector3D *tangentDiff = nullptr;
-                            target.tangent[0]->ExtractData(tangentDiff, vertexRemappingTable);
+                            const Accessor::View<Tangent> tangents = attr.tangent[0]->GetView<Tangent>();
+                            const Accessor::View<aiVector3D> tangentDiff = target.tangent[0]->GetView<aiVector3D>();
 
                             for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
-                                tangent[vertexId].xyz += tangentDiff[vertexId];
-                                aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
-                                aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
+                                const size_t srcIdx = GetSourceIndex(vertexRemappingTable, vertexId);
+                                Tangent tangent = tangents[srcIdx];
+                                tangent.xyz += tangentDiff[srcIdx];
+                                aiAnimMesh.mTangents[vertexId] = tangent.xyz;
+                                aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent.xyz) * tangent.w;
                             }
-                            delete[] tangent;
-                            delete[] tangentDiff;
                         }
                     }
                     if (mesh.weights.size() > i) {
@@ -1028,6 +1034,31 @@ static void GetNodeTransform(aiMatrix4x4 &matrix, const glTF2::Node &node) {
     }
 }
 
+struct Weights {
+    float values[4];
+};
+
+template <typename TIndices>
+static void AddVertexWeights(const Accessor::View<Weights> &weights, const Accessor::View<TIndices> &indices,
+        std::vector<std::vector<aiVertexWeight>> &map, const std::vector<unsigned int> *vertexRemappingTablePtr) {
+    const size_t numVertices = vertexRemappingTablePtr != nullptr ? vertexRemappingTablePtr->size() : weights.size();
+    for (size_t i = 0; i < numVertices; ++i) {
+        const size_t srcIdx = GetSourceIndex(vertexRemappingTablePtr, i);
+        if (srcIdx >= weights.size() || srcIdx >= indices.size()) {
+            throw DeadlyImportError("GLTF: vertex index ", srcIdx, " is out of range of the skin weights");
+        }
+        const Weights weight = weights[srcIdx];
+        const TIndices bones = indices[srcIdx];
+        for (int j = 0; j < 4; ++j) {
+            const unsigned int bone = bones.values[j];
+            if (weight.values[j] > 0 && bone < map.size()) {
+                map[bone].reserve(8);
+                map[bone].emplace_back(static_cast<unsigned int>(i), weight.values[j]);
+            }
+        }
+    }
+}
+
 static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std::vector<aiVertexWeight>> &map, std::vector<unsigned int>* vertexRemappingTablePtr) {
 
     Mesh::Primitive::Attributes &attr = primitive.attributes;
@@ -1038,66 +1069,23 @@ static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std
         return;
     }
 
-    size_t num_vertices = 0;
-
-    struct Weights {
-        float values[4];
-    };
-    Weights **weights = new Weights*[attr.weight.size()];
-    for (size_t w = 0; w < attr.weight.size(); ++w) {
-        num_vertices = attr.weight[w]->ExtractData(weights[w], vertexRemappingTablePtr);
-    }
-
     struct Indices8 {
         uint8_t values[4];
     };
     struct Indices16 {
         uint16_t values[4];
     };
-    Indices8 **indices8 = nullptr;
-    Indices16 **indices16 = nullptr;
-    if (attr.joint[0]->GetElementSize() == 4) {
-        indices8 = new Indices8*[attr.joint.size()];
-        for (size_t j = 0; j < attr.joint.size(); ++j) {
-            attr.joint[j]->ExtractData(indices8[j], vertexRemappingTablePtr);
-        }
-    } else {
-        indices16 = new Indices16 *[attr.joint.size()];
-        for (size_t j = 0; j < attr.joint.size(); ++j) {
-            attr.joint[j]->ExtractData(indices16[j], vertexRemappingTablePtr);
-        }
-    }
-
-    // No indices are an invalid usecase
-    if (nullptr == indices8 && nullptr == indices16) {
-        // Something went completely wrong!
-        ai_assert(false);
-        return;
-    }
 
-    for (size_t w = 0; w < attr.weight.size(); ++w) {
-        for (size_t i = 0; i < num_vertices; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                const unsigned int bone = (indices8 != nullptr) ? indices8[w][i].values[j] : indices16[w][i].values[j];
-                const float weight = weights[w][i].values[j];
-                if (weight > 0 && bone < map.size()) {
-                    map[bone].reserve(8);
-                    map[bone].emplace_back(static_cast<unsigned int>(i), weight);
-                }
-            }
+    // the accessors are read in place, only the used vertices are visited
+    const size_t numSets = std::min(attr.weight.size(), attr.joint.size());
+    for (size_t w = 0; w < numSets; ++w) {
+        const Accessor::View<Weights> weights = attr.weight[w]->GetView<Weights>();
+        if (attr.joint[0]->GetElementSize() == 4) {
+            AddVertexWeights(weights, attr.joint[w]->GetView<Indices8>(), map, vertexRemappingTablePtr);
+        } else {
+            AddVertexWeights(weights, attr.joint[w]->GetView<Indices16>(), map, vertexRemappingTablePtr);
         }
     }
-
-    for (size_t w = 0; w < attr.weight.size(); ++w) {
-        delete[] weights[w];
-        if(indices8)
-            delete[] indices8[w];
-        if (indices16)
-            delete[] indices16[w];
-    }
-    delete[] weights;
-    delete[] indices8;
-    delete[] indices16;
 }
 
 static std::string GetNodeName(const Node &node) {
@@ -1708,6 +1696,9 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     this->mScene = pScene;
 
     // read the asset file
+    if (m_profiler) {
+        m_profiler->BeginRegion("parse");
+    }
     glTF2::Asset asset(pIOHandler, static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(mSchemaDocumentProvider));
     asset.Load(pFile,
                CheckMagicToken(
@@ -1716,6 +1707,10 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     if (asset.scene) {
         pScene->mName = asset.scene->name;
     }
+    if (m_profiler) {
+        m_profiler->EndRegion("parse");
+        m_profiler->BeginRegion("convert");
+    }
 
     // Copy the data out
     ImportEmbeddedTextures(asset);
@@ -1732,6 +1727,10 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
 
     ImportCommonMetadata(asset);
 
+    if (m_profiler) {
+        m_profiler->EndRegion("convert");
+    }
+
     if (pScene->mNumMeshes == 0) {
         pScene->mFlags |= AI_SCENE_FLAGS_INCOMPLETE;
     }
@@ -0,0 +1,707 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+#ifndef ASSIMP_BUILD_NO_GLTF_IMPORTER
+
+#include "AssetLib/glTFCommon/glTFMeshopt.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace glTFCommon {
+namespace Meshopt {
+
+namespace {
+
+constexpr uint8_t VertexHeader = 0xa0;
+constexpr uint8_t IndexHeader = 0xe0;
+constexpr uint8_t SequenceHeader = 0xd0;
+
+constexpr size_t ByteGroupSize = 16;
+constexpr size_t ByteGroupDecodeLimit = 24;
+constexpr size_t VertexBlockSizeBytes = 8192;
+constexpr size_t VertexBlockMaxSize = 256;
+constexpr size_t VertexTailMinSize = 32;
+constexpr size_t SequenceTailSize = 4;
+constexpr size_t CodeAuxTableSize = 16;
+
+// Frequent fifo offsets of the second and third vertex of a triangle with a new first vertex
+const uint8_t CodeAuxTable[CodeAuxTableSize] = {
+    0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+};
+
+// Only the first 14 entries of the table can be referenced by a triangle code
+constexpr size_t CodeAuxTableUsable = 14;
+
+// Fifo offsets 13 and 14 of the third vertex encode the last free index -1 and +1
+constexpr int VertexFifoMax = 13;
+
+inline uint8_t ZigZag8(uint8_t v) {
+    return uint8_t((int8_t(v) >> 7) ^ (v << 1));
+}
+
+inline uint8_t UnZigZag8(uint8_t v) {
+    return uint8_t(-(v & 1) ^ (v >> 1));
+}
+
+size_t GetVertexBlockSize(size_t byteStride) {
+    // a block of all bytes has to fit into 8 KB, the vertex count is a multiple of the byte group size
+    const size_t result = (VertexBlockSizeBytes / byteStride) & ~(ByteGroupSize - 1);
+    return std::min(result, VertexBlockMaxSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Byte groups: 16 deltas stored with 0, 2, 4 or 8 bits, values which don't fit follow the group
+const uint8_t *DecodeBytesGroup(const uint8_t *data, uint8_t *buffer, int bitsLog2) {
+    switch (bitsLog2) {
+    case 0:
+        memset(buffer, 0, ByteGroupSize);
+        return data;
+    case 3:
+        memcpy(buffer, data, ByteGroupSize);
+        return data + ByteGroupSize;
+    default:
+        break;
+    }
+
+    const int bits = bitsLog2 == 1 ? 2 : 4;
+    const size_t valuesPerByte = 8 / bits;
+    const uint8_t sentinel = uint8_t((1 << bits) - 1);
+    const uint8_t *extra = data + ByteGroupSize / valuesPerByte;
+    for (size_t i = 0; i < ByteGroupSize; ++i) {
+        const int shift = 8 - bits * int(i % valuesPerByte + 1);
+        const uint8_t enc = uint8_t((data[i / valuesPerByte] >> shift) & sentinel);
+        buffer[i] = enc == sentinel ? *extra++ : enc;
+    }
+    return extra;
+}
+
+const uint8_t *DecodeBytes(const uint8_t *data, const uint8_t *end, uint8_t *buffer, size_t size) {
+    const size_t headerSize = (size / ByteGroupSize + 3) / 4;
+    if (size_t(end - data) < headerSize) {
+        return nullptr;
+    }
+
+    const uint8_t *header = data;
+    data += headerSize;
+    for (size_t i = 0; i < size; i += ByteGroupSize) {
+        // valid streams end with the tail, so a complete group can always be read
+        if (size_t(end - data) < ByteGroupDecodeLimit) {
+            return nullptr;
+        }
+        const size_t group = i / ByteGroupSize;
+        const int bitsLog2 = (header[group / 4] >> ((group % 4) * 2)) & 3;
+        data = DecodeBytesGroup(data, buffer + i, bitsLog2);
+    }
+    return data;
+}
+
+void EncodeBytesGroup(std::vector<uint8_t> &out, const uint8_t *buffer, int bitsLog2) {
+    switch (bitsLog2) {
+    case 0:
+        return;
+    case 3:
+        out.insert(out.end(), buffer, buffer + ByteGroupSize);
+        return;
+    default:
+        break;
+    }
+
+    const int bits = bitsLog2 == 1 ? 2 : 4;
+    const size_t valuesPerByte = 8 / bits;
+    const uint8_t sentinel = uint8_t((1 << bits) - 1);
+    for (size_t i = 0; i < ByteGroupSize; i += valuesPerByte) {
+        uint8_t byte = 0;
+        for (size_t k = 0; k < valuesPerByte; ++k) {
+            byte = uint8_t((byte << bits) | std::min(buffer[i + k], sentinel));
+        }
+        out.push_back(byte);
+    }
+    for (size_t i = 0; i < ByteGroupSize; ++i) {
+        if (buffer[i] >= sentinel) {
+            out.push_back(buffer[i]);
+        }
+    }
+}
+
+void EncodeBytes(std::vector<uint8_t> &out, const uint8_t *buffer, size_t size) {
+    const size_t headerSize = (size / ByteGroupSize + 3) / 4;
+    const size_t headerOffset = out.size();
+    out.resize(out.size() + headerSize, 0);
+
+    for (size_t i = 0; i < size; i += ByteGroupSize) {
+        const uint8_t *group = buffer + i;
+        size_t count2 = 0, count4 = 0;
+        bool isZero = true;
+        for (size_t k = 0; k < ByteGroupSize; ++k) {
+            count2 += group[k] >= 3;
+            count4 += group[k] >= 15;
+            isZero = isZero && group[k] == 0;
+        }
+
+        int bitsLog2 = 3;
+        size_t best = ByteGroupSize;
+        if (isZero) {
+            bitsLog2 = 0;
+        } else {
+            if (4 + count2 < best) {
+                bitsLog2 = 1;
+                best = 4 + count2;
+            }
+            if (8 + count4 < best) {
+                bitsLog2 = 2;
+            }
+        }
+
+        const size_t index = i / ByteGroupSize;
+        out[headerOffset + index / 4] |= uint8_t(bitsLog2 << ((index % 4) * 2));
+        EncodeBytesGroup(out, group, bitsLog2);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Variable length integers, 7 bits per byte with the lowest group first
+inline uint32_t DecodeVByte(const uint8_t *&data) {
+    uint8_t lead = *data++;
+    if (lead < 128) {
+        return lead;
+    }
+
+    uint32_t result = lead & 127;
+    uint32_t shift = 7;
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t group = *data++;
+        result |= uint32_t(group & 127) << shift;
+        shift += 7;
+        if (group < 128) {
+            break;
+        }
+    }
+    return result;
+}
+
+inline void EncodeVByte(std::vector<uint8_t> &out, uint32_t v) {
+    while (v >= 128) {
+        out.push_back(uint8_t((v & 127) | 128));
+        v >>= 7;
+    }
+    out.push_back(uint8_t(v));
+}
+
+inline uint32_t DecodeIndex(const uint8_t *&data, uint32_t last) {
+    const uint32_t v = DecodeVByte(data);
+    const uint32_t d = (v >> 1) ^ -int32_t(v & 1);
+    return last + d;
+}
+
+inline void EncodeIndex(std::vector<uint8_t> &out, uint32_t index, uint32_t last) {
+    const uint32_t d = index - last;
+    EncodeVByte(out, (d << 1) ^ uint32_t(int32_t(d) >> 31));
+}
+
+inline void WriteIndex(uint8_t *out, size_t i, size_t indexSize, uint32_t index) {
+    if (indexSize == 2) {
+        const uint16_t value = uint16_t(index);
+        memcpy(out + i * 2, &value, 2);
+    } else {
+        memcpy(out + i * 4, &index, 4);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// State of the triangle codec, encoder and decoder have to update it in the same way
+struct IndexState {
+    uint32_t edgeFifo[16][2];
+    uint32_t vertexFifo[16];
+    size_t edgeOffset = 0;
+    size_t vertexOffset = 0;
+    uint32_t next = 0;
+    uint32_t last = 0;
+
+    IndexState() {
+        memset(edgeFifo, -1, sizeof(edgeFifo));
+        memset(vertexFifo, -1, sizeof(vertexFifo));
+    }
+
+    void PushEdge(uint32_t a, uint32_t b) {
+        edgeFifo[edgeOffset][0] = a;
+        edgeFifo[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) & 15;
+    }
+
+    void PushVertex(uint32_t v, bool advance = true) {
+        vertexFifo[vertexOffset] = v;
+        vertexOffset = (vertexOffset + (advance ? 1 : 0)) & 15;
+    }
+
+    //! Returns fe such that the edge (a, b) was pushed fe edges ago, -1 if it is not in the fifo
+    int FindEdge(uint32_t a, uint32_t b) const {
+        for (int fe = 0; fe < 15; ++fe) {
+            const size_t index = (edgeOffset - 1 - fe) & 15;
+            if (edgeFifo[index][0] == a && edgeFifo[index][1] == b) {
+                return fe;
+            }
+        }
+        return -1;
+    }
+
+    //! Returns fe in [first, last] with vertexFifo[(vertexOffset - bias - fe) & 15] == v, -1 if there is none
+    int FindVertex(uint32_t v, size_t bias, int first, int lastFe) const {
+        for (int fe = first; fe <= lastFe; ++fe) {
+            if (vertexFifo[(vertexOffset - bias - fe) & 15] == v) {
+                return fe;
+            }
+        }
+        return -1;
+    }
+};
+
+template <typename T>
+void DecodeFilterOct(T *data, size_t count) {
+    const float max = float((1 << (sizeof(T) * 8 - 1)) - 1);
+    for (size_t i = 0; i < count; ++i) {
+        // x and y are stored, z is reconstructed from the octahedral projection
+        float x = float(data[i * 4 + 0]);
+        float y = float(data[i * 4 + 1]);
+        const float z = float(data[i * 4 + 2]) - std::fabs(x) - std::fabs(y);
+
+        const float t = z >= 0.f ? 0.f : z;
+        x += x >= 0.f ? t : -t;
+        y += y >= 0.f ? t : -t;
+
+        const float l = std::sqrt(x * x + y * y + z * z);
+        const float s = l > 0.f ? max / l : 0.f;
+        data[i * 4 + 0] = T(int(x * s + (x >= 0.f ? 0.5f : -0.5f)));
+        data[i * 4 + 1] = T(int(y * s + (y >= 0.f ? 0.5f : -0.5f)));
+        data[i * 4 + 2] = T(int(z * s + (z >= 0.f ? 0.5f : -0.5f)));
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeVertexBuffer(uint8_t *out, size_t count, size_t byteStride, const uint8_t *in, size_t inLength) {
+    if (byteStride == 0 || byteStride > VertexBlockMaxSize || byteStride % 4 != 0) {
+        return false;
+    }
+    if (inLength < 1 + byteStride || (in[0] & 0xf0) != VertexHeader || (in[0] & 0x0f) > 0) {
+        return false;
+    }
+
+    const uint8_t *end = in + inLength;
+    const uint8_t *data = in + 1;
+
+    // the tail holds the first vertex, the deltas of the first block are relative to it
+    uint8_t lastVertex[VertexBlockMaxSize];
+    memcpy(lastVertex, end - byteStride, byteStride);
+
+    uint8_t buffer[VertexBlockMaxSize];
+    const size_t blockSize = GetVertexBlockSize(byteStride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t blockCount = std::min(blockSize, count - offset);
+        const size_t alignedCount = (blockCount + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+        uint8_t *block = out + offset * byteStride;
+
+        for (size_t k = 0; k < byteStride; ++k) {
+            data = DecodeBytes(data, end, buffer, alignedCount);
+            if (nullptr == data) {
+                return false;
+            }
+
+            uint8_t p = lastVertex[k];
+            for (size_t i = 0; i < blockCount; ++i) {
+                p = uint8_t(UnZigZag8(buffer[i]) + p);
+                block[i * byteStride + k] = p;
+            }
+        }
+
+        memcpy(lastVertex, block + (blockCount - 1) * byteStride, byteStride);
+    }
+
+    return size_t(end - data) == std::max(byteStride, VertexTailMinSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeIndexBuffer(uint8_t *out, size_t count, size_t indexSize, const uint8_t *in, size_t inLength) {
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+        return false;
+    }
+    // the smallest stream has the header, a code per triangle and the code table
+    if (inLength < 1 + count / 3 + CodeAuxTableSize || (in[0] & 0xf0) != IndexHeader) {
+        return false;
+    }
+    const int version = in[0] & 0x0f;
+    if (version > 1) {
+        return false;
+    }
+
+    const int fecMax = version >= 1 ? VertexFifoMax : 15;
+    const uint8_t *code = in + 1;
+    const uint8_t *data = code + count / 3;
+    // each triangle reads at most 16 bytes, which the code table at the end keeps in bounds
+    const uint8_t *dataSafeEnd = in + inLength - CodeAuxTableSize;
+    const uint8_t *codeAuxTable = dataSafeEnd;
+
+    IndexState s;
+    for (size_t i = 0; i < count; i += 3) {
+        if (data > dataSafeEnd) {
+            return false;
+        }
+
+        const uint8_t codeTri = code[i / 3];
+        uint32_t a, b, c;
+        if (codeTri < 0xf0) {
+            // an edge from the fifo and a third vertex
+            const size_t edge = (s.edgeOffset - 1 - (codeTri >> 4)) & 15;
+            a = s.edgeFifo[edge][0];
+            b = s.edgeFifo[edge][1];
+            const int fec = codeTri & 15;
+            if (fec < fecMax) {
+                c = fec == 0 ? s.next++ : s.vertexFifo[(s.vertexOffset - 1 - fec) & 15];
+                s.PushVertex(c, fec == 0);
+            } else {
+                c = s.last = fec != 15 ? s.last + (fec - (fec ^ 3)) : DecodeIndex(data, s.last);
+                s.PushVertex(c);
+            }
+            s.PushEdge(c, b);
+            s.PushEdge(a, c);
+        } else {
+            // a new first vertex, the other two come from the fifo, are new or are stored explicitly
+            int fea = 0, feb, fec;
+            if (codeTri < 0xfe) {
+                const uint8_t codeAux = codeAuxTable[codeTri & 15];
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+            } else {
+                const uint8_t codeAux = *data++;
+                if (codeAux == 0) {
+                    s.next = 0;
+                }
+                fea = codeTri == 0xfe ? 0 : 15;
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+            }
+
+            a = fea == 0 ? s.next++ : 0;
+            b = feb == 0 ? s.next++ : s.vertexFifo[(s.vertexOffset - feb) & 15];
+            c = fec == 0 ? s.next++ : s.vertexFifo[(s.vertexOffset - fec) & 15];
+            if (fea == 15) {
+                s.last = a = DecodeIndex(data, s.last);
+            }
+            if (feb == 15) {
+                s.last = b = DecodeIndex(data, s.last);
+            }
+            if (fec == 15) {
+                s.last = c = DecodeIndex(data, s.last);
+            }
+
+            s.PushVertex(a);
+            s.PushVertex(b, feb == 0 || feb == 15);
+            s.PushVertex(c, fec == 0 || fec == 15);
+            s.PushEdge(b, a);
+            s.PushEdge(c, b);
+            s.PushEdge(a, c);
+        }
+
+        WriteIndex(out, i + 0, indexSize, a);
+        WriteIndex(out, i + 1, indexSize, b);
+        WriteIndex(out, i + 2, indexSize, c);
+    }
+
+    return data == dataSafeEnd;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeIndexSequence(uint8_t *out, size_t count, size_t indexSize, const uint8_t *in, size_t inLength) {
+    if (indexSize != 2 && indexSize != 4) {
+        return false;
+    }
+    if (inLength < 1 + count + SequenceTailSize || (in[0] & 0xf0) != SequenceHeader || (in[0] & 0x0f) > 1) {
+        return false;
+    }
+
+    const uint8_t *data = in + 1;
+    const uint8_t *dataSafeEnd = in + inLength - SequenceTailSize;
+
+    // every index is a delta to one of two baselines, the lowest bit selects it
+    uint32_t last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        if (data >= dataSafeEnd) {
+            return false;
+        }
+
+        uint32_t v = DecodeVByte(data);
+        const uint32_t current = v & 1;
+        v >>= 1;
+        const uint32_t index = last[current] + ((v >> 1) ^ -int32_t(v & 1));
+        last[current] = index;
+        WriteIndex(out, i, indexSize, index);
+    }
+
+    return data == dataSafeEnd;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DecodeFilterOct(uint8_t *data, size_t count, size_t byteStride) {
+    if (byteStride == 4) {
+        DecodeFilterOct(reinterpret_cast<int8_t *>(data), count);
+    } else {
+        std::vector<int16_t> values(count * 4);
+        memcpy(values.data(), data, values.size() * sizeof(int16_t));
+        DecodeFilterOct(values.data(), count);
+        memcpy(data, values.data(), values.size() * sizeof(int16_t));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DecodeFilterQuat(uint8_t *data, size_t count) {
+    const float scale = 1.f / std::sqrt(2.f);
+    for (size_t i = 0; i < count; ++i) {
+        int16_t q[4];
+        memcpy(q, data + i * 8, sizeof(q));
+
+        // the three smallest components are stored, the scale is in the high bits of the last one
+        const int sf = q[3] | 3;
+        const float ss = scale / float(sf);
+        const float x = float(q[0]) * ss;
+        const float y = float(q[1]) * ss;
+        const float z = float(q[2]) * ss;
+        const float ww = 1.f - x * x - y * y - z * z;
+        const float w = std::sqrt(ww >= 0.f ? ww : 0.f);
+
+        // the index of the largest component is in the low bits
+        const int qc = q[3] & 3;
+        int16_t out[4];
+        out[(qc + 1) & 3] = int16_t(int(x * 32767.f + (x >= 0.f ? 0.5f : -0.5f)));
+        out[(qc + 2) & 3] = int16_t(int(y * 32767.f + (y >= 0.f ? 0.5f : -0.5f)));
+        out[(qc + 3) & 3] = int16_t(int(z * 32767.f + (z >= 0.f ? 0.5f : -0.5f)));
+        out[(qc + 0) & 3] = int16_t(int(w * 32767.f + 0.5f));
+        memcpy(data + i * 8, out, sizeof(out));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DecodeFilterExp(uint8_t *data, size_t count, size_t byteStride) {
+    const size_t numValues = count * (byteStride / 4);
+    for (size_t i = 0; i < numValues; ++i) {
+        uint32_t v;
+        memcpy(&v, data + i * 4, 4);
+
+        // 24 bit signed mantissa and 8 bit signed exponent
+        const int32_t m = int32_t(v << 8) >> 8;
+        const int32_t e = int32_t(v) >> 24;
+        const float f = std::ldexp(float(m), e);
+        memcpy(data + i * 4, &f, 4);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *data, size_t count, size_t byteStride) {
+    out.push_back(VertexHeader);
+
+    uint8_t firstVertex[VertexBlockMaxSize] = {};
+    if (count > 0) {
+        memcpy(firstVertex, data, byteStride);
+    }
+
+    uint8_t lastVertex[VertexBlockMaxSize];
+    memcpy(lastVertex, firstVertex, byteStride);
+
+    uint8_t buffer[VertexBlockMaxSize];
+    const size_t blockSize = GetVertexBlockSize(byteStride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t blockCount = std::min(blockSize, count - offset);
+        const size_t alignedCount = (blockCount + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+        const uint8_t *block = data + offset * byteStride;
+
+        for (size_t k = 0; k < byteStride; ++k) {
+            memset(buffer, 0, alignedCount);
+            uint8_t p = lastVertex[k];
+            for (size_t i = 0; i < blockCount; ++i) {
+                const uint8_t v = block[i * byteStride + k];
+                buffer[i] = ZigZag8(uint8_t(v - p));
+                p = v;
+            }
+            EncodeBytes(out, buffer, alignedCount);
+        }
+
+        memcpy(lastVertex, block + (blockCount - 1) * byteStride, byteStride);
+    }
+
+    // the tail is padded at the front, so the first vertex ends the stream
+    if (byteStride < VertexTailMinSize) {
+        out.insert(out.end(), VertexTailMinSize - byteStride, uint8_t(0));
+    }
+    out.insert(out.end(), firstVertex, firstVertex + byteStride);
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeIndexBuffer(std::vector<uint8_t> &out, const uint32_t *indices, size_t count) {
+    out.push_back(IndexHeader | 1);
+    const size_t codeOffset = out.size();
+    out.resize(out.size() + count / 3, 0);
+
+    std::vector<uint8_t> data;
+    IndexState s;
+    for (size_t i = 0; i + 2 < count; i += 3) {
+        const uint32_t tri[3] = { indices[i], indices[i + 1], indices[i + 2] };
+
+        // an edge shared with a recent triangle, in any rotation of the triangle
+        int rotation = -1, fe = -1;
+        for (int r = 0; r < 3 && fe < 0; ++r) {
+            fe = s.FindEdge(tri[r], tri[(r + 1) % 3]);
+            rotation = r;
+        }
+
+        if (fe >= 0) {
+            const uint32_t a = tri[rotation], b = tri[(rotation + 1) % 3], c = tri[(rotation + 2) % 3];
+            int fec;
+            if (c == s.next) {
+                fec = 0;
+                ++s.next;
+                s.PushVertex(c);
+            } else if ((fec = s.FindVertex(c, 1, 1, VertexFifoMax - 1)) >= 0) {
+                s.PushVertex(c, false);
+            } else {
+                fec = c == s.last - 1 ? 13 : (c == s.last + 1 ? 14 : 15);
+                if (fec == 15) {
+                    EncodeIndex(data, c, s.last);
+                }
+                s.last = c;
+                s.PushVertex(c);
+            }
+            s.PushEdge(c, b);
+            s.PushEdge(a, c);
+            out[codeOffset + i / 3] = uint8_t((fe << 4) | fec);
+            continue;
+        }
+
+        // no shared edge, prefer the rotation which starts with the next new vertex
+        rotation = 0;
+        for (int r = 0; r < 3; ++r) {
+            if (tri[r] == s.next) {
+                rotation = r;
+                break;
+            }
+        }
+        const uint32_t a = tri[rotation], b = tri[(rotation + 1) % 3], c = tri[(rotation + 2) % 3];
+        const int fea = a == s.next ? 0 : 15;
+
+        // the fifo offsets are relative to the state before this triangle
+        auto lookup = [&s](uint32_t v, uint32_t &next, bool allowNew) {
+            if (allowNew && v == next) {
+                ++next;
+                return 0;
+            }
+            const int fe = s.FindVertex(v, 0, 1, 14);
+            return fe >= 0 ? fe : 15;
+        };
+        uint32_t next = s.next + (fea == 0 ? 1 : 0);
+        int feb = lookup(b, next, true);
+        int fec = lookup(c, next, true);
+        if (fea == 15 && feb == 0 && fec == 0) {
+            // a zero code byte resets the decoder, store the second vertex explicitly instead
+            next = s.next;
+            feb = 15;
+            fec = lookup(c, next, true);
+        }
+
+        const uint8_t codeAux = uint8_t((feb << 4) | fec);
+        const uint8_t *entry = fea == 0 ? std::find(CodeAuxTable, CodeAuxTable + CodeAuxTableUsable, codeAux) : CodeAuxTable + CodeAuxTableUsable;
+        if (entry != CodeAuxTable + CodeAuxTableUsable) {
+            out[codeOffset + i / 3] = uint8_t(0xf0 | (entry - CodeAuxTable));
+        } else {
+            out[codeOffset + i / 3] = fea == 0 ? 0xfe : 0xff;
+            data.push_back(codeAux);
+        }
+
+        if (fea == 15) {
+            EncodeIndex(data, a, s.last);
+            s.last = a;
+        }
+        if (feb == 15) {
+            EncodeIndex(data, b, s.last);
+            s.last = b;
+        }
+        if (fec == 15) {
+            EncodeIndex(data, c, s.last);
+            s.last = c;
+        }
+
+        s.next = next;
+        s.PushVertex(a);
+        s.PushVertex(b, feb == 0 || feb == 15);
+        s.PushVertex(c, fec == 0 || fec == 15);
+        s.PushEdge(b, a);
+        s.PushEdge(c, b);
+        s.PushEdge(a, c);
+    }
+
+    out.insert(out.end(), data.begin(), data.end());
+    out.insert(out.end(), CodeAuxTable, CodeAuxTable + CodeAuxTableSize);
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeIndexSequence(std::vector<uint8_t> &out, const uint32_t *indices, size_t count) {
+    out.push_back(SequenceHeader | 1);
+
+    uint32_t last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        // use the baseline with the smaller delta
+        const uint32_t index = indices[i];
+        const int64_t d0 = int64_t(index) - int64_t(last[0]);
+        const int64_t d1 = int64_t(index) - int64_t(last[1]);
+        const uint32_t current = std::abs(d1) < std::abs(d0) ? 1 : 0;
+
+        const uint32_t d = index - last[current];
+        const uint32_t v = (d << 1) ^ uint32_t(int32_t(d) >> 31);
+        EncodeVByte(out, (v << 1) | current);
+        last[current] = index;
+    }
+
+    out.insert(out.end(), SequenceTailSize, uint8_t(0));
+}
+
+} // namespace Meshopt
+} // namespace glTFCommon
+
+#endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
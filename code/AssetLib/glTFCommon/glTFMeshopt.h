@@ -0,0 +1,96 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file glTFMeshopt.h
+ *  @brief Encoder and decoder for the buffer view data of EXT_meshopt_compression.
+ *
+ *  The bitstream follows the extension specification, see
+ *  https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+ */
+#pragma once
+#ifndef AI_GLTFMESHOPT_H_INC
+#define AI_GLTFMESHOPT_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GLTF_IMPORTER
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace glTFCommon {
+namespace Meshopt {
+
+//! Decodes a vertex buffer (mode ATTRIBUTES), byteStride must be a multiple of 4 and at most 256.
+//! \return false if the data is malformed
+bool DecodeVertexBuffer(uint8_t *out, size_t count, size_t byteStride, const uint8_t *in, size_t inLength);
+
+//! Decodes an index buffer of a triangle list (mode TRIANGLES), indexSize is 2 or 4.
+//! \return false if the data is malformed
+bool DecodeIndexBuffer(uint8_t *out, size_t count, size_t indexSize, const uint8_t *in, size_t inLength);
+
+//! Decodes a sequence of indices (mode INDICES), indexSize is 2 or 4.
+//! \return false if the data is malformed
+bool DecodeIndexSequence(uint8_t *out, size_t count, size_t indexSize, const uint8_t *in, size_t inLength);
+
+//! Applies the OCTAHEDRAL filter to decoded data, byteStride is 4 or 8.
+void DecodeFilterOct(uint8_t *data, size_t count, size_t byteStride);
+
+//! Applies the QUATERNION filter to decoded data, byteStride must be 8.
+void DecodeFilterQuat(uint8_t *data, size_t count);
+
+//! Applies the EXPONENTIAL filter to decoded data, byteStride must be a multiple of 4.
+void DecodeFilterExp(uint8_t *data, size_t count, size_t byteStride);
+
+//! Encodes a vertex buffer (mode ATTRIBUTES) and appends it to out.
+void EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *data, size_t count, size_t byteStride);
+
+//! Encodes the index buffer of a triangle list (mode TRIANGLES) and appends it to out, count must be a multiple of 3.
+void EncodeIndexBuffer(std::vector<uint8_t> &out, const uint32_t *indices, size_t count);
+
+//! Encodes a sequence of indices (mode INDICES) and appends it to out.
+void EncodeIndexSequence(std::vector<uint8_t> &out, const uint32_t *indices, size_t count);
+
+} // namespace Meshopt
+} // namespace glTFCommon
+
+#endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
+
+#endif // AI_GLTFMESHOPT_H_INC
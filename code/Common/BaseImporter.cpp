@@ -89,7 +89,8 @@ using namespace Assimp;
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseImporter::BaseImporter() AI_NO_EXCEPT
-        : m_progress() {
+        : m_progress(),
+          m_profiler() {
     // empty
 }
 
@@ -119,9 +120,10 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
 
     // Gather configuration properties for this run
     SetupProperties(pImp);
+    m_profiler = pImp->Pimpl()->mProfiler;
 
     // Construct a file system filter to improve our success ratio at reading external files
-    FileSystemFilter filter(pFile, pIOHandler);
+    FileSystemFilter filter(pFile, pIOHandler, m_profiler);
 
     // create a scene object to hold the data
     std::unique_ptr<aiScene> sc(new aiScene());
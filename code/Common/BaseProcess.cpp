@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -53,6 +54,7 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
+          threadPool(),
           progress() {
     // empty
 }
@@ -101,3 +103,17 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func) {
+    if (nullptr == threadPool || count < 2) {
+        for (unsigned int i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    threadPool->ParallelFor(count, [&func](size_t i) {
+        func(static_cast<unsigned int>(i));
+    });
+}
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/GenericProperty.h>
 
+#include <functional>
 #include <map>
 
 struct aiScene;
@@ -52,6 +53,7 @@ struct aiScene;
 namespace Assimp {
 
 class Importer;
+class ThreadPool;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
@@ -242,10 +244,40 @@ public:
         return shared;
     }
 
+    // -------------------------------------------------------------------
+    /** Assign a thread pool to the step. Steps which process meshes
+     *  independently from each other use it to run in parallel.
+     * @param pool May be nullptr, all work is done serially then.
+     */
+    inline void SetThreadPool(ThreadPool *pool) {
+        threadPool = pool;
+    }
+
+    // -------------------------------------------------------------------
+    /** Get the thread pool that is assigned to the step.
+    */
+    inline ThreadPool *GetThreadPool() {
+        return threadPool;
+    }
+
+protected:
+    // -------------------------------------------------------------------
+    /** Invokes func(i) for every i in [0, count). The calls are spread
+     *  across the assigned thread pool, if there is one, so func must be
+     *  safe to call concurrently for different indices. Exceptions are
+     *  rethrown on the calling thread.
+     * @param count Number of indices, usually aiScene::mNumMeshes.
+     * @param func  The functor to invoke.
+     */
+    void ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func);
+
 protected:
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
+    /** Thread pool for per-mesh work, may be nullptr */
+    ThreadPool *threadPool;
+
     /** Currently active progress handler */
     ProgressHandler *progress;
 };
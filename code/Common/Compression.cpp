@@ -143,14 +143,7 @@ size_t Compression::decompress(const void *data, size_t in, std::vector<char> &u
     size_t total = 0l;
     const int flushMode = getFlushMode(mImpl->mFlushMode);
     if (flushMode == Z_FINISH) {
-        mImpl->mZSstream.avail_out = static_cast<uInt>(uncompressed.size());
-        mImpl->mZSstream.next_out = reinterpret_cast<Bytef *>(&*uncompressed.begin());
-        ret = inflate(&mImpl->mZSstream, Z_FINISH);
-
-        if (ret != Z_STREAM_END && ret != Z_OK) {
-            throw DeadlyImportError("Compression", "Failure decompressing this file using gzip.");
-        }
-        total = mImpl->mZSstream.avail_out;
+        total = decompress(data, in, uncompressed.data(), uncompressed.size());
     } else {
         do {
             Bytef block[MYBLOCK] = {};
@@ -172,6 +165,24 @@ size_t Compression::decompress(const void *data, size_t in, std::vector<char> &u
     return total;
 }
 
+size_t Compression::decompress(const void *data, size_t in, char *out, size_t availableOut) {
+    ai_assert(mImpl != nullptr);
+    if (data == nullptr || in == 0) {
+        return 0l;
+    }
+
+    mImpl->mZSstream.next_in = (Bytef*)(data);
+    mImpl->mZSstream.avail_in = (uInt)in;
+    mImpl->mZSstream.avail_out = static_cast<uInt>(availableOut);
+    mImpl->mZSstream.next_out = reinterpret_cast<Bytef *>(out);
+    const int ret = inflate(&mImpl->mZSstream, Z_FINISH);
+
+    if (ret != Z_STREAM_END && ret != Z_OK) {
+        throw DeadlyImportError("Compression", "Failure decompressing this file using gzip.");
+    }
+    return mImpl->mZSstream.avail_out;
+}
+
 size_t Compression::decompressBlock(const void *data, size_t in, char *out, size_t availableOut) {
     ai_assert(mImpl != nullptr);
     if (data == nullptr || in == 0 || out == nullptr || availableOut == 0) {
@@ -196,6 +207,24 @@ size_t Compression::decompressBlock(const void *data, size_t in, char *out, size
     return availableOut - (size_t)mImpl->mZSstream.avail_out;
 }
 
+bool Compression::compress(const void *data, size_t in, std::vector<char> &compressed, int level) {
+    if (data == nullptr || level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+        return false;
+    }
+
+    uLongf length = ::compressBound(static_cast<uLong>(in));
+    compressed.resize(length);
+    const int ret = ::compress2(reinterpret_cast<Bytef *>(compressed.data()), &length,
+            static_cast<const Bytef *>(data), static_cast<uLong>(in), level);
+    if (ret != Z_OK) {
+        compressed.clear();
+        return false;
+    }
+    compressed.resize(length);
+
+    return true;
+}
+
 bool Compression::isOpen() const {
     ai_assert(mImpl != nullptr);
 
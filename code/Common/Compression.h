@@ -101,6 +101,14 @@ public:
     /// @param[out uncompressed A std::vector containing the decompressed data.
     size_t decompress(const void *data, size_t in, std::vector<char> &uncompressed);
 
+    /// @brief Will decompress the data buffer in one step into a preallocated buffer.
+    /// @param[in]  data         The compressed data
+    /// @param[in]  in           The size of the data buffer
+    /// @param[out] out          The output buffer
+    /// @param[in]  availableOut The size of the output buffer.
+    /// @return The number of bytes of the output buffer which were not used.
+    size_t decompress(const void *data, size_t in, char *out, size_t availableOut);
+
     /// @brief Will decompress the data buffer block-wise.
     /// @param[in]  data         The compressed data
     /// @param[in]  in           The size of the data buffer
@@ -109,6 +117,14 @@ public:
     /// @return The size of the decompressed data buffer.
     size_t decompressBlock(const void *data, size_t in, char *out, size_t availableOut);
 
+    /// @brief Will compress the data buffer in one step into a zlib stream.
+    /// @param[in]  data        The data to compress
+    /// @param[in]  in          The size of the data buffer
+    /// @param[out] compressed  A std::vector receiving the compressed data.
+    /// @param[in]  level       The zlib compression level from 0 to 9, -1 selects the zlib default.
+    /// @return true if successful, false if not.
+    static bool compress(const void *data, size_t in, std::vector<char> &compressed, int level = -1);
+
 private:
     struct impl;
     impl *mImpl;
@@ -71,6 +71,7 @@ Here we implement only the C++ interface (Assimp::Exporter).
 #include "PostProcessing/PretransformVertices.h"
 
 #include <memory>
+#include <unordered_set>
 
 namespace Assimp {
 
@@ -281,6 +282,148 @@ public:
 
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Steps which only change meshes in place and leave the rest of the scene alone, apart from the
+// mesh indices of the nodes.
+const unsigned int MeshOnlySteps = aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices |
+        aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals |
+        aiProcess_LimitBoneWeights | aiProcess_ValidateDataStructure | aiProcess_ImproveCacheLocality |
+        aiProcess_FixInfacingNormals | aiProcess_SortByPType | aiProcess_FlipWindingOrder |
+        aiProcess_DropNormals | aiProcess_GenBoundingBoxes;
+
+// ------------------------------------------------------------------------------------------------
+// Returns false if none of the given steps will change the mesh. Steps not handled here are
+// assumed to change every mesh.
+bool MayModifyMesh(const aiMesh *mesh, unsigned int pp) {
+    const unsigned int types = mesh->mPrimitiveTypes;
+    if (types && !(types & aiPrimitiveType_POLYGON)) {
+        pp &= ~aiProcess_Triangulate;
+    }
+    if (types && !(types & (types - 1))) {
+        pp &= ~aiProcess_SortByPType;
+    }
+    if (mesh->mNormals && !(pp & aiProcess_ForceGenNormals)) {
+        pp &= ~(aiProcess_GenNormals | aiProcess_GenSmoothNormals);
+    }
+    if (!mesh->mNormals) {
+        pp &= ~aiProcess_DropNormals;
+    }
+    if (mesh->mTangents) {
+        pp &= ~aiProcess_CalcTangentSpace;
+    }
+    if (!mesh->GetNumUVChannels() && !mesh->mNumAnimMeshes) {
+        pp &= ~aiProcess_FlipUVs;
+    }
+    return 0 != (pp & ~(aiProcess_ValidateDataStructure | aiProcess_ForceGenNormals));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Copy-on-write copy of a scene for the export post-processing. Only the parts of the scene the
+// steps may change are copied, all other meshes, materials etc. are shared with the source scene
+// and detached again before the copy is deleted. Falls back to a full copy for steps which are
+// not known to work in place.
+class SceneCopyOnWrite {
+public:
+    SceneCopyOnWrite(const aiScene *src, unsigned int pp, bool copyAllMeshes) :
+            mScene(nullptr) {
+        if (pp & ~(MeshOnlySteps | aiProcess_FlipUVs | aiProcess_MakeLeftHanded)) {
+            SceneCombiner::CopyScene(&mScene, src);
+            return;
+        }
+
+        mScene = new aiScene();
+        const bool leftHanded = 0 != (pp & aiProcess_MakeLeftHanded);
+        const bool copyMaterials = leftHanded || 0 != (pp & aiProcess_FlipUVs);
+
+        mScene->mMetaData = src->mMetaData;
+        mShared.insert(src->mMetaData);
+
+        ShareArray(mScene->mAnimations, mScene->mNumAnimations, src->mAnimations, src->mNumAnimations, leftHanded);
+        ShareArray(mScene->mTextures, mScene->mNumTextures, src->mTextures, src->mNumTextures, false);
+        ShareArray(mScene->mMaterials, mScene->mNumMaterials, src->mMaterials, src->mNumMaterials, copyMaterials);
+        ShareArray(mScene->mLights, mScene->mNumLights, src->mLights, src->mNumLights, false);
+        ShareArray(mScene->mCameras, mScene->mNumCameras, src->mCameras, src->mNumCameras, leftHanded);
+
+        mScene->mNumMeshes = src->mNumMeshes;
+        if (src->mNumMeshes) {
+            mScene->mMeshes = new aiMesh *[src->mNumMeshes];
+            for (unsigned int i = 0; i < src->mNumMeshes; ++i) {
+                if (copyAllMeshes || MayModifyMesh(src->mMeshes[i], pp)) {
+                    SceneCombiner::Copy(&mScene->mMeshes[i], src->mMeshes[i]);
+                } else {
+                    mScene->mMeshes[i] = src->mMeshes[i];
+                    mShared.insert(src->mMeshes[i]);
+                }
+            }
+        }
+
+        // the node graph is always copied, the steps remap the mesh indices
+        SceneCombiner::Copy(&mScene->mRootNode, src->mRootNode);
+
+        mScene->mFlags = src->mFlags;
+        if (src->mPrivate != nullptr) {
+            ScenePriv(mScene)->mPPStepsApplied = ScenePriv(src) ? ScenePriv(src)->mPPStepsApplied : 0;
+        }
+    }
+
+    ~SceneCopyOnWrite() {
+        if (!mShared.empty()) {
+            Detach(mScene->mAnimations, mScene->mNumAnimations);
+            Detach(mScene->mTextures, mScene->mNumTextures);
+            Detach(mScene->mMaterials, mScene->mNumMaterials);
+            Detach(mScene->mLights, mScene->mNumLights);
+            Detach(mScene->mCameras, mScene->mNumCameras);
+            Detach(mScene->mMeshes, mScene->mNumMeshes);
+            if (mShared.count(mScene->mMetaData)) {
+                mScene->mMetaData = nullptr;
+            }
+        }
+        delete mScene;
+    }
+
+    aiScene *Get() const {
+        return mScene;
+    }
+
+    SceneCopyOnWrite(const SceneCopyOnWrite &) = delete;
+    SceneCopyOnWrite &operator=(const SceneCopyOnWrite &) = delete;
+
+private:
+    template <typename Type>
+    void ShareArray(Type **&dest, unsigned int &destNum, Type *const *src, unsigned int num, bool copy) {
+        destNum = num;
+        if (!num) {
+            dest = nullptr;
+            return;
+        }
+        dest = new Type *[num];
+        for (unsigned int i = 0; i < num; ++i) {
+            if (copy) {
+                SceneCombiner::Copy(&dest[i], src[i]);
+            } else {
+                dest[i] = src[i];
+                mShared.insert(src[i]);
+            }
+        }
+    }
+
+    template <typename Type>
+    void Detach(Type **items, unsigned int num) {
+        for (unsigned int i = 0; i < num; ++i) {
+            if (mShared.count(items[i])) {
+                items[i] = nullptr;
+            }
+        }
+    }
+
+    aiScene *mScene;
+    std::unordered_set<const void *> mShared;
+};
+
+} // Namespace
+
 // ------------------------------------------------------------------------------------------------
 Exporter :: Exporter()
 : pimpl(new ExporterPimpl()) {
@@ -377,14 +520,6 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
         const Exporter::ExportFormatEntry& exp = pimpl->mExporters[i];
         if (!strcmp(exp.mDescription.id,pFormatId)) {
             try {
-                // Always create a full copy of the scene. We might optimize this one day,
-                // but for now it is the most pragmatic way.
-                aiScene* scenecopy_tmp = nullptr;
-                SceneCombiner::CopyScene(&scenecopy_tmp,pScene);
-
-                pimpl->mProgressHandler->UpdateFileWrite(1, 4);
-
-                std::unique_ptr<aiScene> scenecopy(scenecopy_tmp);
                 const ScenePrivateData* const priv = ScenePriv(pScene);
 
                 // steps that are not idempotent, i.e. we might need to run them again, usually to get back to the
@@ -406,28 +541,42 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
 
                 // If the input scene is not in verbose format, but there is at least post-processing step that relies on it,
                 // we need to run the MakeVerboseFormat step first.
+                bool make_verbose = false;
                 bool must_join_again = false;
                 if (!is_verbose_format) {
-                    bool verbosify = false;
                     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++) {
                         BaseProcess* const p = pimpl->mPostProcessingSteps[a];
 
                         if (p->IsActive(pp) && p->RequireVerboseFormat()) {
-                            verbosify = true;
+                            make_verbose = true;
                             break;
                         }
                     }
 
-                    if (verbosify || (exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
-                        ASSIMP_LOG_DEBUG("export: Scene data not in verbose format, applying MakeVerboseFormat step first");
+                    if (make_verbose || (exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
+                        make_verbose = true;
+                        must_join_again = !(exp.mEnforcePP & aiProcess_JoinIdenticalVertices);
+                    }
+                }
 
-                        MakeVerboseFormatProcess proc;
-                        proc.Execute(scenecopy.get());
+                // Without any steps the scene of the caller is passed to the exporter, otherwise
+                // only the parts the steps may change are copied and the rest is shared with the
+                // caller. Exporters must therefore treat the scene as read-only and apply their
+                // own conversions to copies, as the glTF exporters do.
+                std::unique_ptr<SceneCopyOnWrite> scenecopy;
+                const aiScene* scene = pScene;
+                if (pp || make_verbose) {
+                    scenecopy.reset(new SceneCopyOnWrite(pScene, pp, make_verbose));
+                    scene = scenecopy->Get();
+                }
 
-                        if(!(exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
-                            must_join_again = true;
-                        }
-                    }
+                pimpl->mProgressHandler->UpdateFileWrite(1, 4);
+
+                if (make_verbose) {
+                    ASSIMP_LOG_DEBUG("export: Scene data not in verbose format, applying MakeVerboseFormat step first");
+
+                    MakeVerboseFormatProcess proc;
+                    proc.Execute(scenecopy->Get());
                 }
 
                 pimpl->mProgressHandler->UpdateFileWrite(2, 4);
@@ -437,21 +586,21 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                     {
                         FlipWindingOrderProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scenecopy->Get());
                         }
                     }
 
                     {
                         FlipUVsProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scenecopy->Get());
                         }
                     }
 
                     {
                         MakeLeftHandedProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scenecopy->Get());
                         }
                     }
 
@@ -471,10 +620,10 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                             if (dynamic_cast<PretransformVertices*>(p) && exportPointCloud) {
                                 continue;
                             }
-                            p->Execute(scenecopy.get());
+                            p->Execute(scenecopy->Get());
                         }
                     }
-                    ScenePrivateData* const privOut = ScenePriv(scenecopy.get());
+                    ScenePrivateData* const privOut = ScenePriv(scenecopy->Get());
                     ai_assert(nullptr != privOut);
 
                     privOut->mPPStepsApplied |= pp;
@@ -484,13 +633,13 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
 
                 if(must_join_again) {
                     JoinVerticesProcess proc;
-                    proc.Execute(scenecopy.get());
+                    proc.Execute(scenecopy->Get());
                 }
 
                 ExportProperties emptyProperties;  // Never pass nullptr ExportProperties so Exporters don't have to worry.
                 ExportProperties* pProp = pProperties ? (ExportProperties*)pProperties : &emptyProperties;
         		pProp->SetPropertyBool("bJoinIdenticalVertices", pp & aiProcess_JoinIdenticalVertices);
-                exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scenecopy.get(), pProp);
+                exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scene, pProp);
 
                 pimpl->mProgressHandler->UpdateFileWrite(4, 4);
             } catch (DeadlyExportError& err) {
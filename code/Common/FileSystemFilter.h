@@ -47,7 +47,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_FILESYSTEMFILTER_H_INC
 
 #include <assimp/IOSystem.hpp>
+#include <assimp/IOStream.hpp>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Profiler.h>
 #include <assimp/fast_atof.h>
 #include <assimp/ParsingUtils.h>
 
@@ -57,17 +59,82 @@ inline bool IsHex(char s) {
     return (s>='0' && s<='9') || (s>='a' && s<='f') || (s>='A' && s<='F');
 }
 
+// ---------------------------------------------------------------------------
+/** Stream wrapper which accounts all bytes read to a profiler. Closing
+ *  the wrapper closes the wrapped stream through its IOSystem.
+ */
+class ProfilingIOStream : public IOStream
+{
+public:
+    ProfilingIOStream(IOStream* stream, IOSystem* system, Profiling::Profiler* profiler)
+    : mStream(stream)
+    , mSystem(system)
+    , mProfiler(profiler)
+    , mMappedAccounted(false) {
+        ai_assert(nullptr != mStream);
+    }
+
+    ~ProfilingIOStream() override {
+        mSystem->Close(mStream);
+    }
+
+    size_t Read(void* pvBuffer, size_t pSize, size_t pCount) override {
+        const size_t count = mStream->Read(pvBuffer, pSize, pCount);
+        mProfiler->AddBytesRead(static_cast<uint64_t>(count) * pSize);
+        return count;
+    }
+
+    size_t Write(const void* pvBuffer, size_t pSize, size_t pCount) override {
+        return mStream->Write(pvBuffer, pSize, pCount);
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        return mStream->Seek(pOffset, pOrigin);
+    }
+
+    size_t Tell() const override {
+        return mStream->Tell();
+    }
+
+    size_t FileSize() const override {
+        return mStream->FileSize();
+    }
+
+    void Flush() override {
+        mStream->Flush();
+    }
+
+    const uint8_t* GetMappedData() const override {
+        // mapped data counts as read completely on first access
+        const uint8_t* data = mStream->GetMappedData();
+        if (nullptr != data && !mMappedAccounted) {
+            mProfiler->AddBytesRead(mStream->FileSize());
+            mMappedAccounted = true;
+        }
+        return data;
+    }
+
+private:
+    IOStream* mStream;
+    IOSystem* mSystem;
+    Profiling::Profiler* mProfiler;
+    mutable bool mMappedAccounted;
+};
+
 // ---------------------------------------------------------------------------
 /** File system filter
  */
 class FileSystemFilter : public IOSystem
 {
 public:
-    /** Constructor. */
-    FileSystemFilter(const std::string& file, IOSystem* old)
+    /** Constructor.
+     *  If a profiler is given, all streams opened through the filter
+     *  account the bytes they read to it. */
+    FileSystemFilter(const std::string& file, IOSystem* old, Profiling::Profiler* profiler = nullptr)
     : mWrapped  (old)
     , mSrc_file(file)
-    , mSep(mWrapped->getOsSeparator()) {
+    , mSep(mWrapped->getOsSeparator())
+    , mProfiler(profiler) {
         ai_assert(nullptr != mWrapped);
 
         // Determine base directory
@@ -149,6 +216,10 @@ public:
             }
         }
 
+        if (nullptr != s && nullptr != mProfiler) {
+            s = new ProfilingIOStream(s, mWrapped, mProfiler);
+        }
+
         return s;
     }
 
@@ -156,6 +227,11 @@ public:
     /** Closes the given file and releases all resources associated with it. */
     void Close( IOStream* pFile) {
         ai_assert( nullptr != mWrapped );
+        if (nullptr != mProfiler) {
+            // the wrapper closes the underlying stream
+            delete pFile;
+            return;
+        }
         return mWrapped->Close(pFile);
     }
 
@@ -337,6 +413,7 @@ private:
     IOSystem *mWrapped;
     std::string mSrc_file, mBase;
     char mSep;
+    Profiling::Profiler *mProfiler;
 };
 
 } //!ns Assimp
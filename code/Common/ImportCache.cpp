@@ -0,0 +1,861 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file ImportCache.cpp
+ *  @brief Implementation of the import cache.
+ */
+
+#include "Common/ImportCache.h"
+
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+
+#include "Common/Importer.h"
+#include "AssetLib/Assbin/AssbinFileWriter.h"
+#include "AssetLib/Assbin/AssbinLoader.h"
+
+#include <assimp/BaseImporter.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Exceptional.h>
+#include <assimp/Hash.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/MemoryIOWrapper.h>
+#include <assimp/config.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    include <windows.h>
+// the IOSystem members share their names with these macros
+#    undef CreateDirectory
+#    undef DeleteFile
+#endif
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Streaming 64 bit hash, four lanes of multiply-rotate rounds over 32 byte stripes.
+class ContentHash {
+public:
+    ContentHash() :
+            mLanes{ Seed + Prime1 + Prime2, Seed + Prime2, Seed, Seed - Prime1 },
+            mBuffered(0),
+            mLength(0) {
+        // empty
+    }
+
+    void Update(const void *data, size_t size) {
+        const uint8_t *in = static_cast<const uint8_t *>(data);
+        mLength += size;
+        if (mBuffered > 0) {
+            const size_t count = std::min(size, StripeSize - mBuffered);
+            ::memcpy(mBuffer + mBuffered, in, count);
+            mBuffered += count;
+            in += count;
+            size -= count;
+            if (mBuffered < StripeSize) {
+                return;
+            }
+            ConsumeStripe(mBuffer);
+            mBuffered = 0;
+        }
+        for (; size >= StripeSize; in += StripeSize, size -= StripeSize) {
+            ConsumeStripe(in);
+        }
+        ::memcpy(mBuffer, in, size);
+        mBuffered = size;
+    }
+
+    template <typename T>
+    void UpdateValue(const T &value) {
+        Update(&value, sizeof(T));
+    }
+
+    void UpdateString(const std::string &value) {
+        UpdateValue(static_cast<uint64_t>(value.size()));
+        Update(value.data(), value.size());
+    }
+
+    uint64_t Finish() const {
+        uint64_t hash = Rotl(mLanes[0], 1) + Rotl(mLanes[1], 7) + Rotl(mLanes[2], 12) + Rotl(mLanes[3], 18);
+        for (uint64_t lane : mLanes) {
+            hash = (hash ^ Round(0, lane)) * Prime1 + Prime4;
+        }
+        hash += mLength;
+
+        size_t i = 0;
+        for (; i + 8 <= mBuffered; i += 8) {
+            hash = Rotl(hash ^ Round(0, Read64(mBuffer + i)), 27) * Prime1 + Prime4;
+        }
+        for (; i < mBuffered; ++i) {
+            hash = Rotl(hash ^ (mBuffer[i] * Prime5), 11) * Prime1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= Prime2;
+        hash ^= hash >> 29;
+        hash *= Prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+private:
+    static constexpr uint64_t Prime1 = 11400714785074694791ULL;
+    static constexpr uint64_t Prime2 = 14029467366897019727ULL;
+    static constexpr uint64_t Prime3 = 1609587929392839161ULL;
+    static constexpr uint64_t Prime4 = 9650029242287828579ULL;
+    static constexpr uint64_t Prime5 = 2870177450012600261ULL;
+    static constexpr uint64_t Seed = 0;
+    static constexpr size_t StripeSize = 32;
+
+    static uint64_t Rotl(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    static uint64_t Round(uint64_t lane, uint64_t input) {
+        return Rotl(lane + input * Prime2, 31) * Prime1;
+    }
+
+    static uint64_t Read64(const uint8_t *in) {
+        uint64_t value;
+        ::memcpy(&value, in, sizeof(value));
+        return value;
+    }
+
+    void ConsumeStripe(const uint8_t *in) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            mLanes[lane] = Round(mLanes[lane], Read64(in + lane * 8));
+        }
+    }
+
+    uint64_t mLanes[4];
+    uint8_t mBuffer[StripeSize];
+    size_t mBuffered;
+    uint64_t mLength;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Returns whether a property is set by the import itself or does not change its result.
+bool IsIgnoredProperty(unsigned int key) {
+    static const uint32_t ignored[] = {
+        SuperFastHash("importerIndex"),
+        SuperFastHash("sourceFilePath"),
+        SuperFastHash(AI_CONFIG_APP_SCALE_KEY),
+        SuperFastHash(AI_CONFIG_GLOB_MEASURE_TIME),
+        SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIRECTORY)
+    };
+    return std::find(std::begin(ignored), std::end(ignored), key) != std::end(ignored);
+}
+
+template <typename T>
+void HashProperties(ContentHash &hash, const std::map<unsigned int, T> &properties) {
+    for (const auto &property : properties) {
+        if (!IsIgnoredProperty(property.first)) {
+            hash.UpdateValue(property.first);
+            hash.UpdateValue(property.second);
+        }
+    }
+    hash.UpdateValue(static_cast<uint64_t>(properties.size()));
+}
+
+#ifdef _WIN32
+// ------------------------------------------------------------------------------------------------
+std::wstring Utf8ToWide(const std::string &in) {
+    const int size = MultiByteToWideChar(CP_UTF8, 0, in.c_str(), -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    // size includes terminating null; std::wstring adds null automatically
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in.c_str(), -1, &out[0], size);
+    return out;
+}
+#endif
+
+// ------------------------------------------------------------------------------------------------
+// Moves a file over an existing one in a single step, paths are UTF-8
+bool MoveFileOver(const std::string &from, const std::string &to) {
+#ifdef _WIN32
+    return 0 != ::MoveFileExW(Utf8ToWide(from).c_str(), Utf8ToWide(to).c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    return 0 == ::rename(from.c_str(), to.c_str());
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RemoveFile(const std::string &file) {
+#ifdef _WIN32
+    return 0 != ::DeleteFileW(Utf8ToWide(file).c_str());
+#else
+    return 0 == ::remove(file.c_str());
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+// Hashes the whole file, returns false if it cannot be read
+bool HashFile(IOSystem *pIOHandler, const std::string &file, ContentHash &hash) {
+    auto streamCloser = [&](IOStream *pStream) {
+        pIOHandler->Close(pStream);
+    };
+    std::unique_ptr<IOStream, decltype(streamCloser)> stream(pIOHandler->Open(file, "rb"), streamCloser);
+    if (!stream) {
+        return false;
+    }
+
+    const size_t fileSize = stream->FileSize();
+    const uint8_t *mapped = stream->GetMappedData();
+    if (nullptr != mapped) {
+        hash.Update(mapped, fileSize);
+        return true;
+    }
+    std::vector<uint8_t> block(1024 * 1024);
+    size_t remaining = fileSize;
+    while (remaining > 0) {
+        const size_t count = stream->Read(block.data(), 1, std::min(remaining, block.size()));
+        if (0 == count) {
+            return false;
+        }
+        hash.Update(block.data(), count);
+        remaining -= count;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Content hash of a file the importer read, or AbsentFile if it did not exist
+const uint64_t AbsentFile = 0;
+
+uint64_t HashDependency(IOSystem *pIOHandler, const std::string &file) {
+    ContentHash hash;
+    if (!pIOHandler->Exists(file.c_str()) || !HashFile(pIOHandler, file, hash)) {
+        return AbsentFile;
+    }
+    // keep the value apart from AbsentFile
+    return hash.Finish() | 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+// The entry trailer, which follows the assbin data
+const char TrailerMagic[8] = { 'A', 'I', 'C', 'A', 'C', 'H', 'E', '1' };
+
+class TrailerWriter {
+public:
+    template <typename T>
+    void Write(const T &value) {
+        const uint8_t *in = reinterpret_cast<const uint8_t *>(&value);
+        mData.insert(mData.end(), in, in + sizeof(T));
+    }
+
+    void WriteString(const aiString &value) {
+        Write<uint32_t>(value.length);
+        mData.insert(mData.end(), value.data, value.data + value.length);
+    }
+
+    const std::vector<uint8_t> &GetData() const {
+        return mData;
+    }
+
+private:
+    std::vector<uint8_t> mData;
+};
+
+class TrailerReader {
+public:
+    TrailerReader(const uint8_t *data, size_t size) :
+            mCursor(data), mEnd(data + size) {
+        // empty
+    }
+
+    template <typename T>
+    bool Read(T &value) {
+        if (static_cast<size_t>(mEnd - mCursor) < sizeof(T)) {
+            return false;
+        }
+        ::memcpy(&value, mCursor, sizeof(T));
+        mCursor += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(aiString &value) {
+        uint32_t length = 0;
+        if (!Read(length) || length >= AI_MAXLEN || static_cast<size_t>(mEnd - mCursor) < length) {
+            return false;
+        }
+        value.Set(std::string(reinterpret_cast<const char *>(mCursor), length));
+        mCursor += length;
+        return true;
+    }
+
+private:
+    const uint8_t *mCursor;
+    const uint8_t *mEnd;
+};
+
+// ------------------------------------------------------------------------------------------------
+bool WriteMetadata(TrailerWriter &out, const aiMetadata &meta) {
+    out.Write<uint32_t>(meta.mNumProperties);
+    for (unsigned int i = 0; i < meta.mNumProperties; ++i) {
+        const aiMetadataEntry &entry = meta.mValues[i];
+        out.WriteString(meta.mKeys[i]);
+        out.Write<uint32_t>(entry.mType);
+        switch (entry.mType) {
+        case AI_BOOL:
+            out.Write<uint8_t>(*static_cast<const bool *>(entry.mData) ? 1 : 0);
+            break;
+        case AI_INT32:
+            out.Write(*static_cast<const int32_t *>(entry.mData));
+            break;
+        case AI_UINT64:
+            out.Write(*static_cast<const uint64_t *>(entry.mData));
+            break;
+        case AI_FLOAT:
+            out.Write(*static_cast<const float *>(entry.mData));
+            break;
+        case AI_DOUBLE:
+            out.Write(*static_cast<const double *>(entry.mData));
+            break;
+        case AI_AISTRING:
+            out.WriteString(*static_cast<const aiString *>(entry.mData));
+            break;
+        case AI_AIVECTOR3D:
+            out.Write(*static_cast<const aiVector3D *>(entry.mData));
+            break;
+        case AI_AIMETADATA:
+            if (!WriteMetadata(out, *static_cast<const aiMetadata *>(entry.mData))) {
+                return false;
+            }
+            break;
+        case AI_INT64:
+            out.Write(*static_cast<const int64_t *>(entry.mData));
+            break;
+        case AI_UINT32:
+            out.Write(*static_cast<const uint32_t *>(entry.mData));
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+bool ReadMetadataValue(TrailerReader &in, aiMetadata &meta, unsigned int index, const aiString &key) {
+    T value;
+    return in.Read(value) && meta.Set(index, key.C_Str(), value);
+}
+
+bool ReadMetadata(TrailerReader &in, std::unique_ptr<aiMetadata> &out, unsigned int depth = 0) {
+    uint32_t count = 0;
+    if (depth > 64 || !in.Read(count)) {
+        return false;
+    }
+    out.reset(count > 0 ? aiMetadata::Alloc(count) : new aiMetadata());
+    for (unsigned int i = 0; i < count; ++i) {
+        aiString key;
+        uint32_t type = 0;
+        if (!in.ReadString(key) || !in.Read(type)) {
+            return false;
+        }
+        bool ok = false;
+        switch (type) {
+        case AI_BOOL: {
+            uint8_t value = 0;
+            ok = in.Read(value) && out->Set(i, key.C_Str(), value != 0);
+            break;
+        }
+        case AI_INT32:
+            ok = ReadMetadataValue<int32_t>(in, *out, i, key);
+            break;
+        case AI_UINT64:
+            ok = ReadMetadataValue<uint64_t>(in, *out, i, key);
+            break;
+        case AI_FLOAT:
+            ok = ReadMetadataValue<float>(in, *out, i, key);
+            break;
+        case AI_DOUBLE:
+            ok = ReadMetadataValue<double>(in, *out, i, key);
+            break;
+        case AI_AISTRING: {
+            aiString value;
+            ok = in.ReadString(value) && out->Set(i, key.C_Str(), value);
+            break;
+        }
+        case AI_AIVECTOR3D:
+            ok = ReadMetadataValue<aiVector3D>(in, *out, i, key);
+            break;
+        case AI_AIMETADATA: {
+            std::unique_ptr<aiMetadata> child;
+            ok = ReadMetadata(in, child, depth + 1) && out->Set(i, key.C_Str(), *child);
+            break;
+        }
+        case AI_INT64:
+            ok = ReadMetadataValue<int64_t>(in, *out, i, key);
+            break;
+        case AI_UINT32:
+            ok = ReadMetadataValue<uint32_t>(in, *out, i, key);
+            break;
+        default:
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Scene data assbin does not store: names, scene metadata, texture file names, light sizes
+// and orthographic camera widths
+bool WriteSceneExtras(TrailerWriter &out, const aiScene *pScene) {
+    out.WriteString(pScene->mName);
+    out.Write<uint32_t>(pScene->mNumMeshes);
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        const aiMesh *mesh = pScene->mMeshes[i];
+        out.WriteString(mesh->mName);
+        for (unsigned int channel = 0; channel < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++channel) {
+            const bool hasName = mesh->HasTextureCoordsName(channel);
+            out.Write<uint8_t>(hasName ? 1 : 0);
+            if (hasName) {
+                out.WriteString(*mesh->mTextureCoordsNames[channel]);
+            }
+        }
+    }
+    out.Write<uint8_t>(pScene->mMetaData != nullptr ? 1 : 0);
+    if (pScene->mMetaData != nullptr && !WriteMetadata(out, *pScene->mMetaData)) {
+        return false;
+    }
+    out.Write<uint32_t>(pScene->mNumTextures);
+    for (unsigned int i = 0; i < pScene->mNumTextures; ++i) {
+        out.WriteString(pScene->mTextures[i]->mFilename);
+    }
+    out.Write<uint32_t>(pScene->mNumLights);
+    for (unsigned int i = 0; i < pScene->mNumLights; ++i) {
+        out.Write(pScene->mLights[i]->mSize);
+    }
+    out.Write<uint32_t>(pScene->mNumCameras);
+    for (unsigned int i = 0; i < pScene->mNumCameras; ++i) {
+        out.Write(pScene->mCameras[i]->mOrthographicWidth);
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ReadSceneExtras(TrailerReader &in, aiScene *pScene) {
+    uint32_t count = 0;
+    if (!in.ReadString(pScene->mName) || !in.Read(count) || count != pScene->mNumMeshes) {
+        return false;
+    }
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        aiMesh *mesh = pScene->mMeshes[i];
+        if (!in.ReadString(mesh->mName)) {
+            return false;
+        }
+        for (unsigned int channel = 0; channel < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++channel) {
+            uint8_t hasName = 0;
+            if (!in.Read(hasName)) {
+                return false;
+            }
+            aiString name;
+            if (hasName != 0) {
+                if (!in.ReadString(name)) {
+                    return false;
+                }
+                mesh->SetTextureCoordsName(channel, name);
+            }
+        }
+    }
+
+    uint8_t hasMetadata = 0;
+    if (!in.Read(hasMetadata)) {
+        return false;
+    }
+    if (hasMetadata != 0) {
+        std::unique_ptr<aiMetadata> metadata;
+        if (!ReadMetadata(in, metadata)) {
+            return false;
+        }
+        delete pScene->mMetaData;
+        pScene->mMetaData = metadata.release();
+    }
+
+    if (!in.Read(count) || count != pScene->mNumTextures) {
+        return false;
+    }
+    for (unsigned int i = 0; i < pScene->mNumTextures; ++i) {
+        if (!in.ReadString(pScene->mTextures[i]->mFilename)) {
+            return false;
+        }
+    }
+    if (!in.Read(count) || count != pScene->mNumLights) {
+        return false;
+    }
+    for (unsigned int i = 0; i < pScene->mNumLights; ++i) {
+        if (!in.Read(pScene->mLights[i]->mSize)) {
+            return false;
+        }
+    }
+    if (!in.Read(count) || count != pScene->mNumCameras) {
+        return false;
+    }
+    for (unsigned int i = 0; i < pScene->mNumCameras; ++i) {
+        if (!in.Read(pScene->mCameras[i]->mOrthographicWidth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Assbin has no chunks for these, a cache hit would silently lose them
+bool HasDataAssbinCannotStore(const aiScene *pScene) {
+    if (pScene->mNumSkeletons > 0) {
+        return true;
+    }
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        const aiMesh *mesh = pScene->mMeshes[i];
+        if (mesh->mNumAnimMeshes > 0 || mesh->mAABB.mMin != aiVector3D() || mesh->mAABB.mMax != aiVector3D()) {
+            return true;
+        }
+        for (unsigned int j = 0; j < mesh->mNumBones; ++j) {
+            if (mesh->mBones[j]->mArmature != nullptr || mesh->mBones[j]->mNode != nullptr) {
+                return true;
+            }
+        }
+    }
+    for (unsigned int i = 0; i < pScene->mNumAnimations; ++i) {
+        const aiAnimation *anim = pScene->mAnimations[i];
+        if (anim->mNumMeshChannels > 0 || anim->mNumMorphMeshChannels > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+/** Forwards to another IOSystem and records the paths of all files read through it. */
+class DependencyRecorder : public IOSystem {
+public:
+    DependencyRecorder(IOSystem *pIOHandler, const std::string &pFile) :
+            mIOHandler(pIOHandler), mFile(pFile) {
+        // empty
+    }
+
+    bool Exists(const char *pFile) const override {
+        Record(pFile);
+        return mIOHandler->Exists(pFile);
+    }
+
+    char getOsSeparator() const override {
+        return mIOHandler->getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        if (nullptr == ::strpbrk(pMode, "wa+")) {
+            Record(pFile);
+        }
+        return mIOHandler->Open(pFile, pMode);
+    }
+
+    void Close(IOStream *pFile) override {
+        mIOHandler->Close(pFile);
+    }
+
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mIOHandler->ComparePaths(one, second);
+    }
+
+    bool PushDirectory(const std::string &path) override {
+        return mIOHandler->PushDirectory(path);
+    }
+
+    const std::string &CurrentDirectory() const override {
+        return mIOHandler->CurrentDirectory();
+    }
+
+    size_t StackSize() const override {
+        return mIOHandler->StackSize();
+    }
+
+    bool PopDirectory() override {
+        return mIOHandler->PopDirectory();
+    }
+
+    bool CreateDirectory(const std::string &path) override {
+        return mIOHandler->CreateDirectory(path);
+    }
+
+    bool ChangeDirectory(const std::string &path) override {
+        return mIOHandler->ChangeDirectory(path);
+    }
+
+    bool DeleteFile(const std::string &file) override {
+        return mIOHandler->DeleteFile(file);
+    }
+
+    IOSystem *GetWrapped() const {
+        return mIOHandler;
+    }
+
+    std::set<std::string> GetDependencies() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mDependencies;
+    }
+
+private:
+    void Record(const char *pFile) const {
+        // the imported file itself is part of the key
+        if (nullptr == pFile || mFile == pFile) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mMutex);
+        mDependencies.insert(pFile);
+    }
+
+    IOSystem *mIOHandler;
+    std::string mFile;
+    mutable std::mutex mMutex;
+    mutable std::set<std::string> mDependencies;
+};
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::ImportCache(const std::string &directory) :
+        mDirectory(directory),
+        mKey(0),
+        mIOSystem() {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::~ImportCache() = default;
+
+// ------------------------------------------------------------------------------------------------
+IOSystem *ImportCache::RecordDependencies(IOSystem *pIOHandler) {
+    mRecorder.reset(new DependencyRecorder(pIOHandler, mFile));
+    return mRecorder.get();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportCache::ComputeKey(IOSystem *pIOHandler, const std::string &pFile, unsigned int pFlags, const ImporterPimpl &pimpl) {
+    ContentHash hash;
+    if (!HashFile(pIOHandler, pFile, hash)) {
+        return false;
+    }
+
+    // the importer is chosen by the extension first
+    hash.UpdateString(BaseImporter::GetExtension(pFile));
+    hash.UpdateValue(pFlags);
+    HashProperties(hash, pimpl.mIntProperties);
+    HashProperties(hash, pimpl.mFloatProperties);
+    HashProperties(hash, pimpl.mMatrixProperties);
+    for (const auto &property : pimpl.mStringProperties) {
+        if (!IsIgnoredProperty(property.first)) {
+            hash.UpdateValue(property.first);
+            hash.UpdateString(property.second);
+        }
+    }
+
+    // cached scenes from other library versions or configurations are not reused
+    hash.UpdateValue(aiGetVersionMajor());
+    hash.UpdateValue(aiGetVersionMinor());
+    hash.UpdateValue(aiGetVersionPatch());
+    hash.UpdateValue(aiGetVersionRevision());
+    hash.UpdateValue(aiGetCompileFlags());
+
+    mKey = hash.Finish();
+    mFile = pFile;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetPath() const {
+    char name[32];
+    ::snprintf(name, sizeof(name), "%016llx.assbin", static_cast<unsigned long long>(mKey));
+
+    std::string path = mDirectory;
+    if (!path.empty() && path.back() != '/' && path.back() != '\\') {
+        path += mIOSystem.getOsSeparator();
+    }
+    return path + name;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene *ImportCache::Load(Importer *pImp) {
+    const std::string path = GetPath();
+    if (!mIOSystem.Exists(path.c_str())) {
+        return nullptr;
+    }
+
+    // the entry is the assbin data followed by the trailer, its size and the magic
+    std::vector<uint8_t> entry;
+    {
+        std::unique_ptr<IOStream> stream(mIOSystem.Open(path.c_str(), "rb"));
+        if (!stream) {
+            return nullptr;
+        }
+        entry.resize(stream->FileSize());
+        if (!entry.empty() && stream->Read(entry.data(), 1, entry.size()) != entry.size()) {
+            ASSIMP_LOG_WARN("Ignoring unreadable import cache entry ", path);
+            return nullptr;
+        }
+    }
+    uint64_t trailerSize = 0;
+    const size_t footerSize = sizeof(trailerSize) + sizeof(TrailerMagic);
+    if (entry.size() < footerSize ||
+            0 != ::memcmp(entry.data() + entry.size() - sizeof(TrailerMagic), TrailerMagic, sizeof(TrailerMagic))) {
+        ASSIMP_LOG_WARN("Ignoring import cache entry ", path, " without trailer");
+        return nullptr;
+    }
+    ::memcpy(&trailerSize, entry.data() + entry.size() - footerSize, sizeof(trailerSize));
+    if (trailerSize > entry.size() - footerSize) {
+        ASSIMP_LOG_WARN("Ignoring import cache entry ", path, " with a broken trailer");
+        return nullptr;
+    }
+    const size_t assbinSize = entry.size() - footerSize - static_cast<size_t>(trailerSize);
+    TrailerReader trailer(entry.data() + assbinSize, static_cast<size_t>(trailerSize));
+
+    // the files read by the importer besides the imported one must be unchanged
+    uint32_t numDependencies = 0;
+    if (!trailer.Read(numDependencies)) {
+        ASSIMP_LOG_WARN("Ignoring import cache entry ", path, " with a broken trailer");
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < numDependencies; ++i) {
+        aiString file;
+        uint64_t hash = 0;
+        if (!trailer.ReadString(file) || !trailer.Read(hash)) {
+            ASSIMP_LOG_WARN("Ignoring import cache entry ", path, " with a broken trailer");
+            return nullptr;
+        }
+        if (HashDependency(pImp->GetIOHandler(), file.C_Str()) != hash) {
+            ASSIMP_LOG_INFO("Not using import cache entry ", path, ", ", file.C_Str(), " has changed");
+            return nullptr;
+        }
+    }
+
+    MemoryIOSystem memory(entry.data(), assbinSize, nullptr);
+    AssbinImporter loader;
+    std::unique_ptr<aiScene> scene(loader.ReadFile(pImp, AI_MEMORYIO_MAGIC_FILENAME ".assbin", &memory));
+    if (!scene) {
+        ASSIMP_LOG_WARN("Ignoring unreadable import cache entry ", path, ": ", loader.GetErrorText());
+        return nullptr;
+    }
+    if (!ReadSceneExtras(trailer, scene.get())) {
+        ASSIMP_LOG_WARN("Ignoring import cache entry ", path, " with a broken trailer");
+        return nullptr;
+    }
+
+    ASSIMP_LOG_INFO("Loaded scene from import cache entry ", path);
+    return scene.release();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Store(const aiScene *pScene) {
+    if (HasDataAssbinCannotStore(pScene)) {
+        ASSIMP_LOG_DEBUG("Not caching scene, it contains data the assbin format cannot store");
+        return;
+    }
+
+    TrailerWriter trailer;
+    const std::set<std::string> dependencies = mRecorder ? mRecorder->GetDependencies() : std::set<std::string>();
+    trailer.Write<uint32_t>(static_cast<uint32_t>(dependencies.size()));
+    for (const std::string &file : dependencies) {
+        if (file.length() >= AI_MAXLEN) {
+            ASSIMP_LOG_DEBUG("Not caching scene, the path of ", file, " is too long");
+            return;
+        }
+        trailer.WriteString(aiString(file));
+        trailer.Write(HashDependency(mRecorder->GetWrapped(), file));
+    }
+    if (!WriteSceneExtras(trailer, pScene)) {
+        ASSIMP_LOG_DEBUG("Not caching scene, its metadata has an unknown type");
+        return;
+    }
+    trailer.Write<uint64_t>(trailer.GetData().size());
+    const std::vector<uint8_t> &footer = trailer.GetData();
+    mIOSystem.CreateDirectory(mDirectory);
+
+    // write to a unique temporary file first, so concurrent imports never see partial entries
+    const std::string path = GetPath();
+    const uint64_t unique = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()) ^
+                            std::hash<std::thread::id>()(std::this_thread::get_id());
+    const std::string temp = path + "." + std::to_string(unique) + ".tmp";
+    try {
+        DumpSceneToAssbin(temp.c_str(), "import cache", &mIOSystem, pScene, false, false);
+        std::unique_ptr<IOStream> stream(mIOSystem.Open(temp.c_str(), "ab"));
+        if (!stream || stream->Write(footer.data(), 1, footer.size()) != footer.size() ||
+                stream->Write(TrailerMagic, 1, sizeof(TrailerMagic)) != sizeof(TrailerMagic)) {
+            throw DeadlyExportError("cannot append the trailer");
+        }
+    } catch (const std::exception &e) {
+        ASSIMP_LOG_WARN("Failed to write import cache entry ", path, ": ", e.what());
+        RemoveFile(temp);
+        return;
+    }
+
+    // readers see either the previous entry or the complete new one
+    if (!MoveFileOver(temp, path)) {
+        ASSIMP_LOG_WARN("Failed to write import cache entry ", path);
+        RemoveFile(temp);
+    }
+}
+
+} // namespace Assimp
+
+#endif // !ASSIMP_BUILD_NO_IMPORT_CACHE
@@ -0,0 +1,117 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file ImportCache.h
+ *  @brief Cache of post-processed scenes, keyed on the contents of the
+ *  imported file and the import settings.
+ */
+#pragma once
+#ifndef AI_IMPORTCACHE_H_INC
+#define AI_IMPORTCACHE_H_INC
+
+#include <assimp/DefaultIOSystem.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// The cache stores the scenes in the assbin format
+#if defined(ASSIMP_BUILD_NO_EXPORT) || defined(ASSIMP_BUILD_NO_ASSBIN_IMPORTER) || defined(ASSIMP_BUILD_NO_ASSBIN_EXPORTER)
+#   define ASSIMP_BUILD_NO_IMPORT_CACHE
+#endif
+
+struct aiScene;
+
+namespace Assimp {
+
+class Importer;
+class ImporterPimpl;
+class IOSystem;
+class DependencyRecorder;
+
+// ---------------------------------------------------------------------------
+/** Stores post-processed scenes as assbin files in a local directory, see
+ *  #AI_CONFIG_IMPORT_CACHE_DIRECTORY.
+ *
+ *  The key of an entry is a 64 bit hash over the bytes of the imported file,
+ *  its extension, the post-processing flags, all importer properties which
+ *  may change the result and the library version. The entry also lists the
+ *  other files the importer read, with a hash of their contents, and is only
+ *  used while all of them are unchanged.
+ */
+class ImportCache {
+public:
+    /// @brief  Creates a cache in the given directory.
+    explicit ImportCache(const std::string &directory);
+
+    /// @brief  The destructor.
+    ~ImportCache();
+
+    /// @brief  Computes the key for a file.
+    /// @return false if the file could not be read.
+    bool ComputeKey(IOSystem *pIOHandler, const std::string &pFile, unsigned int pFlags, const ImporterPimpl &pimpl);
+
+    /// @brief  Loads the scene stored for the current key.
+    /// @return nullptr if there is no valid entry.
+    aiScene *Load(Importer *pImp);
+
+    /// @brief  Returns an IOSystem which forwards to the given one and records
+    ///         the files read through it, to be used for the import.
+    IOSystem *RecordDependencies(IOSystem *pIOHandler);
+
+    /// @brief  Stores the scene for the current key. Errors are only logged.
+    void Store(const aiScene *pScene);
+
+    /// @brief  Returns the path of the entry for the current key.
+    std::string GetPath() const;
+
+private:
+    std::string mDirectory;
+    uint64_t mKey;
+    std::string mFile;
+    DefaultIOSystem mIOSystem;
+    std::unique_ptr<DependencyRecorder> mRecorder;
+};
+
+} // namespace Assimp
+
+#endif // AI_IMPORTCACHE_H_INC
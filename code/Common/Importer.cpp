@@ -64,10 +64,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // ------------------------------------------------------------------------------------------------
 #include "Common/Importer.h"
 #include "Common/BaseProcess.h"
+#include "Common/ImportCache.h"
 #include "Common/DefaultProgressHandler.h"
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/BaseImporter.h>
 #include <assimp/GenericProperty.h>
@@ -75,7 +77,6 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Profiler.h>
 #include <assimp/TinyFormatter.h>
 #include <assimp/Exceptional.h>
-#include <assimp/Profiler.h>
 #include <assimp/commonMetaData.h>
 
 #include <exception>
@@ -89,6 +90,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
 #   include "PostProcessing/ValidateDataStructure.h"
 #endif
+#ifndef ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
+#   include "PostProcessing/InterleaveVerticesProcess.h"
+#endif
 
 using namespace Assimp::Profiling;
 using namespace Assimp::Formatter;
@@ -193,6 +197,12 @@ Importer::~Importer() {
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Stop the post-processing worker threads
+    delete pimpl->mThreadPool;
+
+    // Delete the profile of the last import
+    delete pimpl->mProfiler;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -408,6 +418,73 @@ const std::exception_ptr& Importer::GetException() const {
     return pimpl->mException;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Get the profile of the last import
+const Profiler *Importer::GetProfile() const {
+    ai_assert(nullptr != pimpl);
+
+    return pimpl->mProfiler;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the profiler to record into, nullptr if time measurement is disabled
+static Profiler *GetActiveProfiler(const Importer *importer, ImporterPimpl *pimpl) {
+    if (!importer->GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0)) {
+        delete pimpl->mProfiler;
+        pimpl->mProfiler = nullptr;
+        return nullptr;
+    }
+    if (nullptr == pimpl->mProfiler) {
+        pimpl->mProfiler = new Profiler();
+    }
+    return pimpl->mProfiler;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Names a post-processing step by the first flag which activates it
+static const char *GetPostProcessStepName(const BaseProcess *process) {
+    static const char *const names[] = {
+        "aiProcess_CalcTangentSpace", "aiProcess_JoinIdenticalVertices", "aiProcess_MakeLeftHanded",
+        "aiProcess_Triangulate", "aiProcess_RemoveComponent", "aiProcess_GenNormals",
+        "aiProcess_GenSmoothNormals", "aiProcess_SplitLargeMeshes", "aiProcess_PreTransformVertices",
+        "aiProcess_LimitBoneWeights", "aiProcess_ValidateDataStructure", "aiProcess_ImproveCacheLocality",
+        "aiProcess_RemoveRedundantMaterials", "aiProcess_FixInfacingNormals", "aiProcess_PopulateArmatureData",
+        "aiProcess_SortByPType", "aiProcess_FindDegenerates", "aiProcess_FindInvalidData",
+        "aiProcess_GenUVCoords", "aiProcess_TransformUVCoords", "aiProcess_FindInstances",
+        "aiProcess_OptimizeMeshes", "aiProcess_OptimizeGraph", "aiProcess_FlipUVs",
+        "aiProcess_FlipWindingOrder", "aiProcess_SplitByBoneCount", "aiProcess_Debone",
+        "aiProcess_GlobalScale", "aiProcess_EmbedTextures", "aiProcess_ForceGenNormals",
+        "aiProcess_DropNormals", "aiProcess_GenBoundingBoxes"
+    };
+    static_assert(sizeof(names) / sizeof(names[0]) == 32, "one name per flag bit");
+
+    for (unsigned int bit = 0; bit < 32; ++bit) {
+        if (process->IsActive(1u << bit)) {
+            return names[bit];
+        }
+    }
+    return "step";
+}
+
+// ------------------------------------------------------------------------------------------------
+// The InterleaveVertices step has no flag bit, it runs last whenever a vertex format is configured
+static void InterleaveVertices(Importer *pImp, ThreadPool *pool) {
+#ifndef ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
+    if (pImp->GetScene() == nullptr) {
+        return;
+    }
+    InterleaveVerticesProcess process;
+    process.SetupProperties(pImp);
+    if (process.IsActive(0)) {
+        process.SetThreadPool(pool);
+        process.ExecuteOnScene(pImp);
+    }
+#else
+    (void)pImp;
+    (void)pool;
+#endif
+}
+
 // ------------------------------------------------------------------------------------------------
 // Enable extra-verbose mode
 void Importer::SetExtraVerbose(bool bDo) {
@@ -618,10 +695,11 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+        Profiler *profiler = GetActiveProfiler(this, pimpl);
         if (profiler) {
-            profiler->BeginRegion("total");
+            profiler->Clear();
         }
+        ScopedRegion totalRegion(profiler, "total");
 
         // Find an worker class which can handle the file extension.
         // Multiple importers may be able to handle the same extension (.xml!); gather them all.
@@ -702,6 +780,45 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         ASSIMP_LOG_INFO("Found a matching importer for this file format: ", ext, "." );
         pimpl->mProgressHandler->UpdateFileRead( 0, fileSize );
 
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+        // Look for a post-processed scene from an earlier import of the same data
+        std::unique_ptr<ImportCache> cache;
+        const std::string cacheDirectory = GetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, "");
+        if (!cacheDirectory.empty()) {
+            ScopedRegion cacheRegion(profiler, "cache");
+            cache.reset(new ImportCache(cacheDirectory));
+            if (!cache->ComputeKey(pimpl->mIOHandler, pFile, pFlags, *pimpl)) {
+                cache.reset();
+            } else if ((pimpl->mScene = cache->Load(this)) != nullptr) {
+                if (!pimpl->mScene->mMetaData) {
+                    pimpl->mScene->mMetaData = new aiMetadata;
+                }
+                if (!pimpl->mScene->mMetaData->HasKey(AI_METADATA_SOURCE_FORMAT)) {
+                    pimpl->mScene->mMetaData->Add(AI_METADATA_SOURCE_FORMAT, aiString(ext));
+                }
+                ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
+                pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
+                // the cache doesn't store the interleaved vertex buffers
+                InterleaveVertices(this, nullptr);
+                SetPropertyString("sourceFilePath", pFile);
+                return pimpl->mScene;
+            }
+        }
+
+        // the importer and the post-processing steps read through the recorder,
+        // the entry lists the other files the scene was built from
+        struct IOHandlerRestore {
+            IOSystem *&mSlot;
+            IOSystem *mSaved;
+            ~IOHandlerRestore() {
+                mSlot = mSaved;
+            }
+        } ioHandlerRestore{ pimpl->mIOHandler, pimpl->mIOHandler };
+        if (cache) {
+            pimpl->mIOHandler = cache->RecordDependencies(pimpl->mIOHandler);
+        }
+#endif // ASSIMP_BUILD_NO_IMPORT_CACHE
+
         if (profiler) {
             profiler->BeginRegion("import");
         }
@@ -749,6 +866,13 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
             // Ensure that the validation process won't be called twice
             ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+
+#ifndef ASSIMP_BUILD_NO_IMPORT_CACHE
+            if (cache && pimpl->mScene) {
+                ScopedRegion cacheRegion(profiler, "cache");
+                cache->Store(pimpl->mScene);
+            }
+#endif // ASSIMP_BUILD_NO_IMPORT_CACHE
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -758,10 +882,6 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
         // clear any data allocated by post-process steps
         pimpl->mPPShared->Clean();
-
-        if (profiler) {
-            profiler->EndRegion("total");
-        }
     }
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     catch (std::exception &e) {
@@ -798,6 +918,7 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
 
     // If no flags are given, return the current scene with no further action
     if (!pFlags) {
+        InterleaveVertices(this, nullptr);
         return pimpl->mScene;
     }
 
@@ -830,19 +951,37 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    // (Re-)create the worker threads if parallel post-processing was requested
+    int numThreads = GetPropertyInteger(AI_CONFIG_PP_THREAD_COUNT, AI_PP_THREAD_COUNT_DEFAULT);
+    if (numThreads == 0) {
+        numThreads = static_cast<int>(ThreadPool::GetHardwareConcurrency());
+    }
+    if (numThreads > 1) {
+        if (nullptr == pimpl->mThreadPool || pimpl->mThreadPool->GetNumThreads() != static_cast<unsigned int>(numThreads)) {
+            delete pimpl->mThreadPool;
+            pimpl->mThreadPool = new ThreadPool(static_cast<unsigned int>(numThreads));
+        }
+    } else {
+        delete pimpl->mThreadPool;
+        pimpl->mThreadPool = nullptr;
+    }
+
+    Profiler *profiler = GetActiveProfiler(this, pimpl);
+    ScopedRegion postProcessRegion(profiler, "postprocess");
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
         if( process->IsActive( pFlags)) {
+            process->SetThreadPool(pimpl->mThreadPool);
+            const char *stepName = profiler ? GetPostProcessStepName(process) : nullptr;
             if (profiler) {
-                profiler->BeginRegion("postprocess");
+                profiler->BeginRegion(stepName);
             }
 
             process->ExecuteOnScene ( this );
 
             if (profiler) {
-                profiler->EndRegion("postprocess");
+                profiler->EndRegion(stepName);
             }
         }
         if( !pimpl->mScene) {
@@ -864,6 +1003,8 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
 #endif  // no validation
 #endif // ! DEBUG
     }
+    InterleaveVertices(this, pimpl->mThreadPool);
+
     pimpl->mProgressHandler->UpdatePostProcess( static_cast<int>(pimpl->mPostProcessingSteps.size()),
         static_cast<int>(pimpl->mPostProcessingSteps.size()) );
 
@@ -925,7 +1066,7 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    Profiler *profiler = GetActiveProfiler(this, pimpl);
 
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
@@ -58,6 +58,11 @@ namespace Assimp {
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class ThreadPool;
+
+    namespace Profiling {
+        class Profiler;
+    }
 
 
 //! @cond never
@@ -126,6 +131,12 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Worker threads for the post-process steps, nullptr if they run serially */
+    ThreadPool* mThreadPool;
+
+    /** Profile of the last import, nullptr if #AI_CONFIG_GLOB_MEASURE_TIME is not set */
+    Profiling::Profiler* mProfiler;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -149,7 +160,9 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mThreadPool( nullptr ),
+        mProfiler( nullptr ) {
     // empty
 }
 //! @endcond
@@ -0,0 +1,249 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file  MemoryMappedIOSystem.cpp
+ *  @brief Memory mapped file I/O implementation for #Importer
+ */
+
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Only plain read access can be served from a read-only mapping
+bool IsReadOnlyMode(const char *mode) {
+    return nullptr != mode && mode[0] == 'r' && nullptr == ::strchr(mode, '+');
+}
+
+#ifdef _WIN32
+// ------------------------------------------------------------------------------------------------
+std::wstring Utf8ToWide(const char *in) {
+    const int size = MultiByteToWideChar(CP_UTF8, 0, in, -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    // size includes terminating null; std::wstring adds null automatically
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in, -1, &out[0], size);
+    return out;
+}
+#endif
+
+// ------------------------------------------------------------------------------------------------
+// Maps the whole file, returns nullptr for empty files or on failure
+const uint8_t *MapFile(const char *file, size_t &length, void *&mapping) {
+    length = 0;
+    mapping = nullptr;
+
+#ifdef _WIN32
+    const std::wstring name = Utf8ToWide(file);
+    if (name.empty()) {
+        return nullptr;
+    }
+    HANDLE handle = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(handle, &size) || size.QuadPart <= 0 ||
+            static_cast<unsigned long long>(size.QuadPart) > static_cast<unsigned long long>(SIZE_MAX)) {
+        ::CloseHandle(handle);
+        return nullptr;
+    }
+    HANDLE view = ::CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // the mapping keeps the file open
+    ::CloseHandle(handle);
+    if (nullptr == view) {
+        return nullptr;
+    }
+    void *data = ::MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+    if (nullptr == data) {
+        ::CloseHandle(view);
+        return nullptr;
+    }
+    length = static_cast<size_t>(size.QuadPart);
+    mapping = view;
+    return static_cast<const uint8_t *>(data);
+#else
+    const int fd = ::open(file, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat statbuf;
+    if (::fstat(fd, &statbuf) != 0 || !S_ISREG(statbuf.st_mode) || statbuf.st_size <= 0) {
+        ::close(fd);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(statbuf.st_size);
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file open
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+#ifdef POSIX_MADV_SEQUENTIAL
+    ::posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+#endif
+    length = size;
+    mapping = data;
+    return static_cast<const uint8_t *>(data);
+#endif
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::MemoryMappedIOStream(const uint8_t *data, size_t length, void *mapping) :
+        mData(data),
+        mLength(length),
+        mPos(0),
+        mMapping(mapping) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+MemoryMappedIOStream::~MemoryMappedIOStream() {
+    if (nullptr == mData) {
+        return;
+    }
+#ifdef _WIN32
+    ::UnmapViewOfFile(mData);
+    ::CloseHandle(static_cast<HANDLE>(mMapping));
+#else
+    ::munmap(mMapping, mLength);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    if (0 == pCount || 0 == pSize) {
+        return 0;
+    }
+    ai_assert(nullptr != pvBuffer);
+
+    const size_t cnt = std::min(pCount, (mLength - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Write(const void * /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/) {
+    ai_assert(false); // the mapping is read-only
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MemoryMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    if (aiOrigin_SET == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        mPos = pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mLength) {
+            return AI_FAILURE;
+        }
+        mPos = mLength - pOffset;
+    } else {
+        if (pOffset + mPos > mLength) {
+            return AI_FAILURE;
+        }
+        mPos += pOffset;
+    }
+    return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::Tell() const {
+    return mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MemoryMappedIOStream::FileSize() const {
+    return mLength;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MemoryMappedIOStream::Flush() {
+    // nothing to do for read-only streams
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MemoryMappedIOStream::GetMappedData() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream *MemoryMappedIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    if (IsReadOnlyMode(strMode)) {
+        size_t length = 0;
+        void *mapping = nullptr;
+        const uint8_t *data = MapFile(strFile, length, mapping);
+        if (nullptr != data) {
+            return new MemoryMappedIOStream(data, length, mapping);
+        }
+    }
+
+    // writers, empty files and anything we cannot map
+    return DefaultIOSystem::Open(strFile, strMode);
+}
@@ -0,0 +1,237 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file Profiler.cpp
+ *  @brief Implementation of the import profiler
+ */
+
+#include <assimp/Profiler.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <iomanip>
+#include <locale>
+#include <sstream>
+
+#ifdef _WIN32
+#   ifndef PSAPI_VERSION
+#       define PSAPI_VERSION 2
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+namespace Assimp {
+namespace Profiling {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+void WriteString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteRegion(std::ostream &out, const std::vector<ProfileRegion> &regions, size_t index) {
+    const ProfileRegion &region = regions[index];
+    out << "{\"name\":";
+    WriteString(out, region.name);
+    out << ",\"start\":" << region.start
+        << ",\"duration\":" << region.duration
+        << ",\"bytesRead\":" << region.bytesRead
+        << ",\"peakMemory\":" << region.peakMemory
+        << ",\"children\":[";
+    bool first = true;
+    for (size_t i = index + 1; i < regions.size(); ++i) {
+        if (regions[i].parent == index) {
+            if (!first) {
+                out << ',';
+            }
+            first = false;
+            WriteRegion(out, regions, i);
+        }
+    }
+    out << "]}";
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+Profiler::Profiler() :
+        mOrigin(Clock::now()) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::BeginRegion(const std::string &region) {
+    ProfileRegion r;
+    r.name = region;
+    r.parent = mOpen.empty() ? ProfileRegion::NoParent : mOpen.back();
+    r.depth = static_cast<unsigned int>(mOpen.size());
+    r.start = std::chrono::duration<double>(Clock::now() - mOrigin).count();
+    r.duration = -1.0;
+    r.bytesRead = 0;
+    r.peakMemory = 0;
+
+    mOpen.push_back(mRegions.size());
+    mRegions.push_back(r);
+    ASSIMP_LOG_DEBUG("START `", region, "`");
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::EndRegion(const std::string &region) {
+    size_t n = mOpen.size();
+    while (n > 0 && mRegions[mOpen[n - 1]].name != region) {
+        --n;
+    }
+    if (n == 0) {
+        return;
+    }
+
+    const double now = std::chrono::duration<double>(Clock::now() - mOrigin).count();
+    const uint64_t peak = GetPeakMemory();
+    while (mOpen.size() >= n) {
+        ProfileRegion &r = mRegions[mOpen.back()];
+        r.duration = now - r.start;
+        r.peakMemory = peak;
+        mOpen.pop_back();
+        ASSIMP_LOG_DEBUG("END   `", r.name, "`, dt= ", r.duration, " s");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::AddBytesRead(uint64_t bytes) {
+    for (const size_t index : mOpen) {
+        mRegions[index].bytesRead += bytes;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::Clear() {
+    mRegions.clear();
+    mOpen.clear();
+    mOrigin = Clock::now();
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::vector<ProfileRegion> &Profiler::GetRegions() const {
+    return mRegions;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string Profiler::ToJson() const {
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out << std::setprecision(9) << "{\"regions\":[";
+    bool first = true;
+    for (size_t i = 0; i < mRegions.size(); ++i) {
+        if (mRegions[i].parent == ProfileRegion::NoParent) {
+            if (!first) {
+                out << ',';
+            }
+            first = false;
+            WriteRegion(out, mRegions, i);
+        }
+    }
+    out << "]}";
+    return out.str();
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string Profiler::ToChromeTrace() const {
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    for (size_t i = 0; i < mRegions.size(); ++i) {
+        const ProfileRegion &region = mRegions[i];
+        if (i > 0) {
+            out << ',';
+        }
+        // complete events, timestamps are given in microseconds
+        out << "{\"name\":";
+        WriteString(out, region.name);
+        out << ",\"cat\":\"assimp\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << region.start * 1e6
+            << ",\"dur\":" << (region.duration < 0.0 ? 0.0 : region.duration * 1e6)
+            << ",\"args\":{\"bytesRead\":" << region.bytesRead
+            << ",\"peakMemory\":" << region.peakMemory << "}}";
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}";
+    return out.str();
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t Profiler::GetPeakMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#   ifdef __APPLE__
+    // reported in bytes
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#   else
+    // reported in kilobytes
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#   endif
+#endif
+}
+
+} // namespace Profiling
+} // namespace Assimp
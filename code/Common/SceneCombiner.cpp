@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
   */
 // ----------------------------------------------------------------------------
 #include "ScenePrivate.h"
+#include "Material/MaterialSystem.h"
 #include <assimp/Hash.h>
 #include <assimp/SceneCombiner.h>
 #include <assimp/StringUtils.h>
@@ -936,12 +937,7 @@ void SceneCombiner::MergeMaterials(aiMaterial **dest,
         size += (*it)->mNumProperties;
     }
 
-    out->Clear();
-    delete[] out->mProperties;
-
-    out->mNumAllocated = size;
-    out->mNumProperties = 0;
-    out->mProperties = new aiMaterialProperty *[out->mNumAllocated];
+    ReserveMaterialProperties(out, size);
 
     for (std::vector<aiMaterial *>::const_iterator it = begin; it != end; ++it) {
         for (unsigned int i = 0; i < (*it)->mNumProperties; ++i) {
@@ -951,18 +947,7 @@ void SceneCombiner::MergeMaterials(aiMaterial **dest,
             const aiMaterialProperty *prop_exist;
             if (aiGetMaterialProperty(out, sprop->mKey.C_Str(), sprop->mSemantic, sprop->mIndex, &prop_exist) != AI_SUCCESS) {
                 // If not, we add it to the new material
-                aiMaterialProperty *prop = out->mProperties[out->mNumProperties] = new aiMaterialProperty();
-
-                prop->mDataLength = sprop->mDataLength;
-                prop->mData = new char[prop->mDataLength];
-                ::memcpy(prop->mData, sprop->mData, prop->mDataLength);
-
-                prop->mIndex = sprop->mIndex;
-                prop->mSemantic = sprop->mSemantic;
-                prop->mKey = sprop->mKey;
-                prop->mType = sprop->mType;
-
-                out->mNumProperties++;
+                out->AddBinaryProperty(sprop->mData, sprop->mDataLength, sprop->mKey.C_Str(), sprop->mSemantic, sprop->mIndex, sprop->mType);
             }
         }
     }
@@ -1111,6 +1096,11 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
             Copy(&dest->mTextureCoordsNames[i], src->mTextureCoordsNames[i]);
         }
     }
+
+    // make a deep copy of the interleaved vertex buffer
+    if (src->mVertexBuffer != nullptr) {
+        dest->mVertexBuffer = new aiVertexBuffer(*src->mVertexBuffer);
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1147,12 +1137,8 @@ void SceneCombiner::Copy(aiMaterial **_dest, const aiMaterial *src) {
 
     aiMaterial *dest = (aiMaterial *)(*_dest = new aiMaterial());
 
-    dest->Clear();
-    delete[] dest->mProperties;
-
-    dest->mNumAllocated = src->mNumAllocated;
+    ReserveMaterialProperties(dest, src->mNumAllocated);
     dest->mNumProperties = src->mNumProperties;
-    dest->mProperties = new aiMaterialProperty *[dest->mNumAllocated];
 
     for (unsigned int i = 0; i < dest->mNumProperties; ++i) {
         aiMaterialProperty *prop = dest->mProperties[i] = new aiMaterialProperty();
@@ -0,0 +1,220 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file TextStreamWriter.cpp
+ *  @brief Implementation of the TextStreamWriter helper class.
+ */
+
+#include "TextStreamWriter.h"
+
+#include <assimp/BlobIOSystem.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Exceptional.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <locale>
+#include <sstream>
+
+namespace Assimp {
+
+// longest number the float formatting may produce: DBL_MAX in fixed
+// notation has 309 digits, plus sign, point and the requested digits
+static constexpr size_t MaxFixedLength = 320;
+
+// ------------------------------------------------------------------------------------------------
+TextStreamWriter::TextStreamWriter(IOStream *stream, size_t bufferSize) :
+        mStream(stream),
+        mBuffer(std::max(bufferSize, size_t(1024))),
+        mUsed(0),
+        mFlushed(0),
+        mPrecision(6),
+        mFixed(false) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+TextStreamWriter::~TextStreamWriter() {
+    // a failed export throws its output away anyway
+    if (std::uncaught_exceptions() > 0) {
+        return;
+    }
+    try {
+        Flush();
+    } catch (const DeadlyExportError &e) {
+        ASSIMP_LOG_ERROR("TextStreamWriter: output lost, ", e.what());
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::Flush() {
+    if (mUsed == 0) {
+        return;
+    }
+    const size_t length = mUsed;
+    mFlushed += length;
+    mUsed = 0;
+    if (mStream != nullptr && mStream->Write(mBuffer.data(), 1, length) != length) {
+        throw DeadlyExportError("Failed to write ", length, " bytes to the output file");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::WriteSlow(const char *data, size_t length) {
+    Flush();
+    if (length < mBuffer.size()) {
+        ::memcpy(mBuffer.data(), data, length);
+        mUsed = length;
+        return;
+    }
+
+    // too large to buffer, hand it over directly
+    mFlushed += length;
+    if (mStream != nullptr && mStream->Write(data, 1, length) != length) {
+        throw DeadlyExportError("Failed to write ", length, " bytes to the output file");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+char *TextStreamWriter::Reserve(size_t length) {
+    if (length > mBuffer.size() - mUsed) {
+        Flush();
+        if (length > mBuffer.size()) {
+            mBuffer.resize(length);
+        }
+    }
+    return mBuffer.data() + mUsed;
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::WriteInteger(long long value) {
+    char *begin = Reserve(24);
+    const std::to_chars_result result = std::to_chars(begin, begin + 24, value);
+    mUsed += static_cast<size_t>(result.ptr - begin);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::WriteUnsigned(unsigned long long value) {
+    char *begin = Reserve(24);
+    const std::to_chars_result result = std::to_chars(begin, begin + 24, value);
+    mUsed += static_cast<size_t>(result.ptr - begin);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::WriteFloat(float value) {
+    // all floats are exactly representable as double, so the digits are the same
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const int precision = std::max(mPrecision, 0);
+    const size_t length = MaxFixedLength + static_cast<size_t>(precision);
+    char *begin = Reserve(length);
+    const std::to_chars_result result = mFixed ?
+            std::to_chars(begin, begin + length, value, std::chars_format::fixed, precision) :
+            std::to_chars(begin, begin + length, value, std::chars_format::general, std::max(precision, 1));
+    mUsed += static_cast<size_t>(result.ptr - begin);
+#else
+    WriteDouble(static_cast<double>(value));
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+void TextStreamWriter::WriteDouble(double value) {
+    const int precision = std::max(mPrecision, 0);
+    const size_t length = MaxFixedLength + static_cast<size_t>(precision);
+    char *begin = Reserve(length);
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const std::to_chars_result result = mFixed ?
+            std::to_chars(begin, begin + length, value, std::chars_format::fixed, precision) :
+            std::to_chars(begin, begin + length, value, std::chars_format::general, std::max(precision, 1));
+    mUsed += static_cast<size_t>(result.ptr - begin);
+#else
+    // standard libraries without floating point to_chars, the classic
+    // locale keeps the global locale from changing the decimal point
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream.precision(precision);
+    if (mFixed) {
+        stream.setf(std::ios::fixed);
+    }
+    stream << value;
+    const std::string text = stream.str();
+    ::memcpy(begin, text.data(), std::min(text.size(), length));
+    mUsed += std::min(text.size(), length);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+ExportOutputFile::ExportOutputFile(IOSystem *ioSystem, const std::string &file, const char *mode) :
+        mIOSystem(ioSystem),
+        mFile(file),
+        mStream(ioSystem->Open(file, mode)) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+ExportOutputFile::~ExportOutputFile() {
+    if (mStream == nullptr) {
+        return;
+    }
+
+    // the export failed, don't leave a truncated file behind. The DeleteFile
+    // of other IOSystems may remove a host file instead of their own
+    mIOSystem->Close(mStream);
+    if (dynamic_cast<DefaultIOSystem *>(mIOSystem) != nullptr || dynamic_cast<BlobIOSystem *>(mIOSystem) != nullptr) {
+        mIOSystem->DeleteFile(mFile);
+    } else {
+        ASSIMP_LOG_WARN("Export failed, the incomplete file ", mFile, " is left to the IOSystem");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ExportOutputFile::Commit() {
+    if (mStream != nullptr) {
+        mIOSystem->Close(mStream);
+        mStream = nullptr;
+    }
+}
+
+} // namespace Assimp
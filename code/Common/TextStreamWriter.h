@@ -0,0 +1,211 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file TextStreamWriter.h
+ *  @brief Defines a buffered writer the text exporters use to stream their
+ *  output to an IOStream while it is generated.
+ */
+#pragma once
+#ifndef AI_TEXTSTREAMWRITER_H_INC
+#define AI_TEXTSTREAMWRITER_H_INC
+
+#include <assimp/defs.h>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Assimp {
+
+class IOStream;
+class IOSystem;
+
+// ---------------------------------------------------------------------------
+/** @brief A buffered text writer on top of an IOStream.
+ *
+ *  Replaces the std::stringstream the text exporters used to build their
+ *  whole file in: the output goes to the stream whenever the buffer is
+ *  full, so the file never needs to be held in memory. Numbers are
+ *  formatted independent of the current locale: floating point numbers
+ *  are written like a std::ostream in the "C" locale with the same
+ *  precision and fixed flag would write them.
+ *
+ *  Writing to a stream which fails throws a DeadlyExportError, call
+ *  Flush() at the end of the output to receive it. A writer without a
+ *  stream discards the output.
+ */
+class ASSIMP_API TextStreamWriter {
+public:
+    /// @brief  Creates the writer.
+    /// @param  stream      The stream to write to, not owned, may be nullptr.
+    /// @param  bufferSize  Number of bytes collected before each write.
+    explicit TextStreamWriter(IOStream *stream, size_t bufferSize = 1 << 16);
+
+    /// @brief  Writes the remaining buffered output unless an exception is
+    ///         in flight. A failing write is logged as an error.
+    ~TextStreamWriter();
+
+    TextStreamWriter(const TextStreamWriter &) = delete;
+    TextStreamWriter &operator=(const TextStreamWriter &) = delete;
+
+    /// @brief  Sets the number of significant digits of floating point
+    ///         numbers, or of the digits after the point in fixed mode.
+    void SetPrecision(int precision) { mPrecision = precision; }
+
+    /// @brief  Selects fixed notation for floating point numbers.
+    void SetFixed(bool fixed) { mFixed = fixed; }
+
+    /// @brief  Writes raw bytes.
+    void Write(const char *data, size_t length) {
+        if (length > mBuffer.size() - mUsed) {
+            WriteSlow(data, length);
+            return;
+        }
+        ::memcpy(mBuffer.data() + mUsed, data, length);
+        mUsed += length;
+    }
+
+    /// @brief  Writes all buffered output to the stream.
+    void Flush();
+
+    /// @brief  Returns the number of bytes written so far, including
+    ///         the buffered ones.
+    size_t Tell() const { return mFlushed + mUsed; }
+
+    TextStreamWriter &operator<<(char c) {
+        if (mUsed == mBuffer.size()) {
+            Flush();
+        }
+        mBuffer[mUsed++] = c;
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(const char *s) {
+        Write(s, ::strlen(s));
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(const std::string &s) {
+        Write(s.data(), s.size());
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(float f) {
+        WriteFloat(f);
+        return *this;
+    }
+
+    TextStreamWriter &operator<<(double d) {
+        WriteDouble(d);
+        return *this;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && (sizeof(T) > 1), TextStreamWriter &>::type
+    operator<<(T value) {
+        if (std::is_signed<T>::value) {
+            WriteInteger(static_cast<long long>(value));
+        } else {
+            WriteUnsigned(static_cast<unsigned long long>(value));
+        }
+        return *this;
+    }
+
+private:
+    void WriteSlow(const char *data, size_t length);
+    void WriteInteger(long long value);
+    void WriteUnsigned(unsigned long long value);
+    void WriteFloat(float value);
+    void WriteDouble(double value);
+
+    /// Returns a pointer to at least length free bytes in the buffer.
+    char *Reserve(size_t length);
+
+private:
+    IOStream *mStream;
+    std::vector<char> mBuffer;
+    size_t mUsed;
+    size_t mFlushed;
+    int mPrecision;
+    bool mFixed;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief The output file of a streaming exporter.
+ *
+ *  Exporters writing through a TextStreamWriter open their output before
+ *  the document is complete. If the export fails, the file is closed and
+ *  deleted again instead of leaving a truncated file behind. This is only
+ *  done for the DefaultIOSystem and the BlobIOSystem, the DeleteFile of
+ *  other IOSystems may fall back to removing a host file of the same name.
+ */
+class ASSIMP_API ExportOutputFile {
+public:
+    /// @brief  Opens the file.
+    /// @param  ioSystem    The IO system to open the file with.
+    /// @param  file        The name of the file.
+    /// @param  mode        The mode to open the file with.
+    ExportOutputFile(IOSystem *ioSystem, const std::string &file, const char *mode);
+
+    /// @brief  Closes the file, and deletes it unless Commit() was called.
+    ~ExportOutputFile();
+
+    ExportOutputFile(const ExportOutputFile &) = delete;
+    ExportOutputFile &operator=(const ExportOutputFile &) = delete;
+
+    /// @brief  Returns the stream of the file, nullptr if it couldn't be opened.
+    IOStream *Get() const { return mStream; }
+
+    /// @brief  Closes the completely written file and keeps it.
+    void Commit();
+
+private:
+    IOSystem *mIOSystem;
+    std::string mFile;
+    IOStream *mStream;
+};
+
+} // namespace Assimp
+
+#endif // AI_TEXTSTREAMWRITER_H_INC
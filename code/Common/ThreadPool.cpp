@@ -0,0 +1,211 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file ThreadPool.cpp
+ *  @brief Implementation of the ThreadPool helper class.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(unsigned int numThreads) :
+        mNumThreads(numThreads ? numThreads : GetHardwareConcurrency()),
+        mWorkers(),
+        mSlices(),
+        mMutex(),
+        mWakeUp(),
+        mDone(),
+        mJob(nullptr),
+        mGeneration(0),
+        mPending(0),
+        mShutdown(false),
+        mBusy(false),
+        mFailed(false),
+        mError() {
+    mSlices.reset(new Slice[mNumThreads]);
+    for (unsigned int i = 0; i < mNumThreads; ++i) {
+        mSlices[i].next = 0;
+        mSlices[i].end = 0;
+    }
+
+    // slot 0 belongs to the thread calling ParallelFor()
+    mWorkers.reserve(mNumThreads - 1);
+    for (unsigned int i = 1; i < mNumThreads; ++i) {
+        mWorkers.emplace_back(&ThreadPool::WorkerMain, this, i);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShutdown = true;
+    }
+    mWakeUp.notify_all();
+    for (std::thread &worker : mWorkers) {
+        worker.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetNumThreads() const {
+    return mNumThreads;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetHardwareConcurrency() {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+    if (count == 0) {
+        return;
+    }
+
+    // Nested calls and trivial jobs are not worth the synchronization
+    if (mNumThreads < 2 || count < 2 || mBusy.exchange(true)) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const size_t step = count / mNumThreads, rest = count % mNumThreads;
+        size_t begin = 0;
+        for (unsigned int i = 0; i < mNumThreads; ++i) {
+            const size_t end = begin + step + (i < rest ? 1 : 0);
+            mSlices[i].next = begin;
+            mSlices[i].end = end;
+            begin = end;
+        }
+        mJob = &func;
+        mError = nullptr;
+        mFailed = false;
+        mPending = mNumThreads - 1;
+        ++mGeneration;
+    }
+    mWakeUp.notify_all();
+
+    Run(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mPending == 0; });
+        mJob = nullptr;
+        error = mError;
+        mError = nullptr;
+    }
+    mBusy = false;
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::WorkerMain(unsigned int id) {
+    unsigned long long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeUp.wait(lock, [this, seen] { return mShutdown || mGeneration != seen; });
+            if (mShutdown) {
+                return;
+            }
+            seen = mGeneration;
+        }
+
+        Run(id);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (--mPending == 0) {
+                mDone.notify_one();
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::Run(unsigned int id) {
+    // drain our own slice first, then steal from the others
+    for (unsigned int n = 0; n < mNumThreads; ++n) {
+        Slice &slice = mSlices[(id + n) % mNumThreads];
+        for (;;) {
+            if (mFailed) {
+                return;
+            }
+            const size_t index = slice.next.fetch_add(1);
+            if (index >= slice.end) {
+                break;
+            }
+            if (!RunIndex(index)) {
+                return;
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ThreadPool::RunIndex(size_t index) {
+    try {
+        (*mJob)(index);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mError) {
+            mError = std::current_exception();
+        }
+        mFailed = true;
+        return false;
+    }
+    return true;
+}
+
+} // namespace Assimp
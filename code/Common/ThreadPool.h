@@ -0,0 +1,136 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file ThreadPool.h
+ *  @brief Defines a small pool of worker threads used to run independent
+ *  per-mesh work in parallel.
+ */
+#pragma once
+#ifndef AI_THREADPOOL_H_INC
+#define AI_THREADPOOL_H_INC
+
+#include <assimp/defs.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A fixed-size pool of worker threads with work stealing.
+ *
+ *  ParallelFor() splits an index range into one contiguous slice per
+ *  participating thread. Each thread drains its own slice first and then
+ *  steals the remaining indices of the other slices, so meshes of very
+ *  different sizes are still balanced across all threads. The calling
+ *  thread takes part in the work, so a pool created for n threads spawns
+ *  only n-1 workers.
+ *
+ *  Exceptions thrown by the functor are captured, the remaining work is
+ *  skipped and the first exception is rethrown on the calling thread.
+ */
+class ASSIMP_API ThreadPool {
+public:
+    /// @brief  Creates the pool.
+    /// @param  numThreads  Number of threads to use, including the calling
+    ///         thread. 0 selects the number of hardware threads.
+    explicit ThreadPool(unsigned int numThreads);
+
+    /// @brief  Stops and joins all workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @brief  Returns the number of threads taking part in a job,
+    ///         including the calling thread.
+    unsigned int GetNumThreads() const;
+
+    /// @brief  Invokes func(i) for every i in [0, count) and returns when
+    ///         all invocations are done.
+    ///
+    /// Calls from inside a running job are executed serially on the
+    /// calling thread.
+    /// @param  count   The number of indices.
+    /// @param  func    The functor to call, must be safe to call concurrently
+    ///                 for different indices.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+    /// @brief  Returns the number of hardware threads, at least 1.
+    static unsigned int GetHardwareConcurrency();
+
+private:
+    struct Slice {
+        std::atomic<size_t> next;
+        size_t end;
+    };
+
+    void WorkerMain(unsigned int id);
+    void Run(unsigned int id);
+    bool RunIndex(size_t index);
+
+private:
+    unsigned int mNumThreads;
+    std::vector<std::thread> mWorkers;
+    std::unique_ptr<Slice[]> mSlices;
+    std::mutex mMutex;
+    std::condition_variable mWakeUp;
+    std::condition_variable mDone;
+    const std::function<void(size_t)> *mJob;
+    unsigned long long mGeneration;
+    unsigned int mPending;
+    bool mShutdown;
+    std::atomic<bool> mBusy;
+    std::atomic<bool> mFailed;
+    std::exception_ptr mError;
+};
+
+} // namespace Assimp
+
+#endif // AI_THREADPOOL_H_INC
@@ -50,10 +50,249 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/material.h>
 #include <assimp/types.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Materials with fewer properties are searched linearly, this is faster than hashing.
+static constexpr unsigned int MinIndexedProperties = 16;
+
+static constexpr unsigned int NoProperty = UINT_MAX;
+
+// ------------------------------------------------------------------------------------------------
+uint32_t HashPropertyKey(const char *pKey, unsigned int type, unsigned int index) {
+    uint32_t hash = SuperFastHash(pKey);
+    hash = SuperFastHash((const char *)&type, sizeof(unsigned int), hash);
+    return SuperFastHash((const char *)&index, sizeof(unsigned int), hash);
+}
+
+// ------------------------------------------------------------------------------------------------
+inline bool MatchesProperty(const aiMaterialProperty *prop, const char *pKey, unsigned int type, unsigned int index) {
+    return prop /* just for safety ... */ && prop->mSemantic == type && prop->mIndex == index && !strcmp(prop->mKey.data, pKey);
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Open addressing hash table mapping (key, semantic, index) to the position
+ *  of a property in aiMaterial::mProperties.
+ *
+ *  The aiMaterial functions keep it up to date. Importers which append to or
+ *  shrink mProperties directly change the property count, which is detected and
+ *  the index is rebuilt. Replacing entries in place is not detected, such code
+ *  has to call InvalidateMaterialPropertyIndex(). Debug builds also compare a
+ *  snapshot of the property pointers to catch missing calls. */
+struct MaterialPropertyIndex {
+    struct Slot {
+        uint32_t hash;
+        unsigned int property;
+    };
+
+    std::vector<Slot> slots;
+    unsigned int numProperties = 0;
+    unsigned int numUsed = 0;
+#ifdef ASSIMP_BUILD_DEBUG
+    std::vector<const aiMaterialProperty *> snapshot;
+#endif
+
+    bool IsValidFor(const aiMaterial *pMat) const {
+        if (slots.empty() || numProperties != pMat->mNumProperties) {
+            return false;
+        }
+#ifdef ASSIMP_BUILD_DEBUG
+        if (0 != ::memcmp(snapshot.data(), pMat->mProperties, snapshot.size() * sizeof(aiMaterialProperty *))) {
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    void Invalidate() {
+        slots.clear();
+        numProperties = 0;
+#ifdef ASSIMP_BUILD_DEBUG
+        snapshot.clear();
+#endif
+    }
+
+    void Build(const aiMaterial *pMat) {
+        size_t capacity = 32;
+        while (capacity < pMat->mNumProperties * 2) {
+            capacity <<= 1;
+        }
+        slots.assign(capacity, Slot{ 0, NoProperty });
+        numUsed = 0;
+        for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
+            Insert(pMat, i);
+        }
+        numProperties = pMat->mNumProperties;
+#ifdef ASSIMP_BUILD_DEBUG
+        snapshot.assign(pMat->mProperties, pMat->mProperties + pMat->mNumProperties);
+#endif
+    }
+
+    // Adds the property at the given position, unless an identical key was seen before
+    void Insert(const aiMaterial *pMat, unsigned int i) {
+        const aiMaterialProperty *prop = pMat->mProperties[i];
+        if (nullptr == prop) {
+            return;
+        }
+        const uint32_t hash = HashPropertyKey(prop->mKey.data, prop->mSemantic, prop->mIndex);
+        const size_t mask = slots.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            if (slots[slot].property == NoProperty) {
+                slots[slot] = Slot{ hash, i };
+                ++numUsed;
+                return;
+            }
+            if (slots[slot].hash == hash && MatchesProperty(pMat->mProperties[slots[slot].property], prop->mKey.data, prop->mSemantic, prop->mIndex)) {
+                return;
+            }
+        }
+    }
+
+    // Candidates are checked against the material, so a stale slot can only cause a miss
+    unsigned int Find(const aiMaterial *pMat, const char *pKey, unsigned int type, unsigned int index) const {
+        const uint32_t hash = HashPropertyKey(pKey, type, index);
+        const size_t mask = slots.size() - 1;
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            const Slot &entry = slots[slot];
+            if (entry.property == NoProperty) {
+                return NoProperty;
+            }
+            if (entry.hash == hash && MatchesProperty(pMat->mProperties[entry.property], pKey, type, index)) {
+                return entry.property;
+            }
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+/** The private data of a material. The index is built lazily, lookups on a const
+ *  material may run concurrently and share the lock while it is valid. */
+struct MaterialPrivateData {
+    std::shared_mutex mutex;
+    MaterialPropertyIndex index;
+};
+
+// ------------------------------------------------------------------------------------------------
+// The property array has a hidden slot in front of it pointing to the private data of the
+// material, so the layout of aiMaterial stays unchanged.
+aiMaterialProperty **AllocateProperties(unsigned int numAllocated, MaterialPrivateData *data) {
+    aiMaterialProperty **storage = new aiMaterialProperty *[numAllocated + 1];
+    storage[0] = reinterpret_cast<aiMaterialProperty *>(data);
+    return storage + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void FreeProperties(aiMaterialProperty **properties) {
+    if (nullptr != properties) {
+        delete[] (properties - 1);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline MaterialPrivateData *GetPrivateData(const aiMaterial *pMat) {
+    if (nullptr == pMat->mProperties) {
+        return nullptr;
+    }
+    return reinterpret_cast<MaterialPrivateData *>(pMat->mProperties[-1]);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Position of the property in pMat->mProperties or NoProperty
+unsigned int FindProperty(const aiMaterial *pMat, const char *pKey, unsigned int type, unsigned int index) {
+    MaterialPrivateData *data = GetPrivateData(pMat);
+    if (pMat->mNumProperties < MinIndexedProperties || nullptr == data) {
+        for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
+            if (MatchesProperty(pMat->mProperties[i], pKey, type, index)) {
+                return i;
+            }
+        }
+        return NoProperty;
+    }
+    {
+        std::shared_lock<std::shared_mutex> lock(data->mutex);
+        if (data->index.IsValidFor(pMat)) {
+            return data->index.Find(pMat, pKey, type, index);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(data->mutex);
+    if (!data->index.IsValidFor(pMat)) {
+        data->index.Build(pMat);
+    }
+    return data->index.Find(pMat, pKey, type, index);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Keeps the index up to date after the property at position i was replaced by one with the
+// same key or appended
+void UpdateProperty(const aiMaterial *pMat, unsigned int i) {
+    MaterialPrivateData *data = GetPrivateData(pMat);
+    if (nullptr == data) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(data->mutex);
+    MaterialPropertyIndex &entry = data->index;
+    // smaller materials skip the index in FindProperty(), so it was not checked before the change
+    if (entry.slots.empty() || pMat->mNumProperties <= MinIndexedProperties) {
+        entry.Invalidate();
+        return;
+    }
+    if (i < entry.numProperties) {
+#ifdef ASSIMP_BUILD_DEBUG
+        entry.snapshot[i] = pMat->mProperties[i];
+#endif
+    } else if (i == entry.numProperties) {
+        if ((entry.numUsed + 1) * 2 > entry.slots.size()) {
+            entry.Build(pMat);
+        } else {
+            entry.Insert(pMat, i);
+            ++entry.numProperties;
+#ifdef ASSIMP_BUILD_DEBUG
+            entry.snapshot.push_back(pMat->mProperties[i]);
+#endif
+        }
+    } else {
+        // modified elsewhere, rebuilt on the next query
+        entry.Invalidate();
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::ReserveMaterialProperties(aiMaterial *mat, unsigned int numAllocated) {
+    ai_assert(nullptr != mat);
+    if (nullptr != mat->mProperties && numAllocated <= mat->mNumAllocated) {
+        return;
+    }
+
+    MaterialPrivateData *data = GetPrivateData(mat);
+    aiMaterialProperty **properties = AllocateProperties(numAllocated, data != nullptr ? data : new MaterialPrivateData());
+    if (nullptr != mat->mProperties) {
+        ::memcpy(properties, mat->mProperties, mat->mNumProperties * sizeof(aiMaterialProperty *));
+    }
+    FreeProperties(mat->mProperties);
+    mat->mProperties = properties;
+    mat->mNumAllocated = numAllocated;
+}
+
+// ------------------------------------------------------------------------------------------------
+void Assimp::InvalidateMaterialPropertyIndex(const aiMaterial *mat) {
+    ai_assert(nullptr != mat);
+    MaterialPrivateData *data = GetPrivateData(mat);
+    if (nullptr != data) {
+        std::unique_lock<std::shared_mutex> lock(data->mutex);
+        data->index.Invalidate();
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get a specific property from a material
 aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
@@ -65,22 +304,31 @@ aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
     ai_assert(pKey != nullptr);
     ai_assert(pPropOut != nullptr);
 
-    /*  Just search for a property with exactly this name ..
-     *  could be improved by hashing, but it's possibly
-     *  no worth the effort (we're bound to C structures,
-     *  thus std::map or derivates are not applicable. */
-    for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
-        aiMaterialProperty *prop = pMat->mProperties[i];
-
-        if (prop /* just for safety ... */
-                && 0 == strncmp(prop->mKey.data, pKey, strlen(pKey)) && (UINT_MAX == type || prop->mSemantic == type) /* UINT_MAX is a wild-card, but this is undocumented :-) */
-                && (UINT_MAX == index || prop->mIndex == index)) {
-            *pPropOut = pMat->mProperties[i];
-            return AI_SUCCESS;
+    /*  UINT_MAX is a wild-card for the semantic and the index, but this
+     *  is undocumented :-). Such queries can't use the index. */
+    if (UINT_MAX == type || UINT_MAX == index) {
+        for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
+            aiMaterialProperty *prop = pMat->mProperties[i];
+
+            if (prop /* just for safety ... */
+                    && !strcmp(prop->mKey.data, pKey) && (UINT_MAX == type || prop->mSemantic == type)
+                    && (UINT_MAX == index || prop->mIndex == index)) {
+                *pPropOut = pMat->mProperties[i];
+                return AI_SUCCESS;
+            }
         }
+        *pPropOut = nullptr;
+        return AI_FAILURE;
     }
-    *pPropOut = nullptr;
-    return AI_FAILURE;
+
+    // Search for a property with exactly this name, hashed for large materials
+    const unsigned int i = FindProperty(pMat, pKey, type, index);
+    if (NoProperty == i) {
+        *pPropOut = nullptr;
+        return AI_FAILURE;
+    }
+    *pPropOut = pMat->mProperties[i];
+    return AI_SUCCESS;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -485,14 +733,15 @@ static const unsigned int DefaultNumAllocated = 5;
 aiMaterial::aiMaterial() :
         mProperties(nullptr), mNumProperties(0), mNumAllocated(DefaultNumAllocated) {
     // Allocate 5 entries by default
-    mProperties = new aiMaterialProperty *[DefaultNumAllocated];
+    mProperties = AllocateProperties(DefaultNumAllocated, new MaterialPrivateData());
 }
 
 // ------------------------------------------------------------------------------------------------
 aiMaterial::~aiMaterial() {
     Clear();
 
-    delete[] mProperties;
+    delete GetPrivateData(this);
+    FreeProperties(mProperties);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -511,6 +760,7 @@ void aiMaterial::Clear() {
         AI_DEBUG_INVALIDATE_PTR(mProperties[i]);
     }
     mNumProperties = 0;
+    InvalidateMaterialPropertyIndex(this);
 
     // The array remains allocated, we just invalidated its contents
 }
@@ -532,6 +782,7 @@ aiReturn aiMaterial::RemoveProperty(const char *pKey, unsigned int type, unsigne
             for (unsigned int a = i; a < mNumProperties; ++a) {
                 mProperties[a] = mProperties[a + 1];
             }
+            InvalidateMaterialPropertyIndex(this);
             return AI_SUCCESS;
         }
     }
@@ -555,16 +806,9 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
     }
 
     // first search the list whether there is already an entry with this key
-    unsigned int iOutIndex(UINT_MAX);
-    for (unsigned int i = 0; i < mNumProperties; ++i) {
-        aiMaterialProperty *prop(mProperties[i]);
-
-        if (prop /* just for safety */ && !strcmp(prop->mKey.data, pKey) &&
-                prop->mSemantic == type && prop->mIndex == index) {
-
-            delete mProperties[i];
-            iOutIndex = i;
-        }
+    const unsigned int iOutIndex = FindProperty(this, pKey, type, index);
+    if (UINT_MAX != iOutIndex) {
+        delete mProperties[iOutIndex];
     }
 
     // Allocate a new material property
@@ -585,29 +829,21 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
 
     if (UINT_MAX != iOutIndex) {
         mProperties[iOutIndex] = pcNew.release();
+        UpdateProperty(this, iOutIndex);
         return AI_SUCCESS;
     }
 
     // resize the array ... double the storage allocated
     if (mNumProperties == mNumAllocated) {
-        const unsigned int iOld = mNumAllocated;
-        mNumAllocated *= 2;
-
-        aiMaterialProperty **ppTemp;
         try {
-            ppTemp = new aiMaterialProperty *[mNumAllocated];
+            ReserveMaterialProperties(this, std::max(mNumAllocated * 2, DefaultNumAllocated));
         } catch (std::bad_alloc &) {
             return AI_OUTOFMEMORY;
         }
-
-        // just copy all items over; then replace the old array
-        memcpy(ppTemp, mProperties, iOld * sizeof(void *));
-
-        delete[] mProperties;
-        mProperties = ppTemp;
     }
     // push back ...
     mProperties[mNumProperties++] = pcNew.release();
+    UpdateProperty(this, mNumProperties - 1);
 
     return AI_SUCCESS;
 }
@@ -657,26 +893,9 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
     ai_assert(pcSrc->mNumProperties <= pcSrc->mNumAllocated);
 
     const unsigned int iOldNum = pcDest->mNumProperties;
-    pcDest->mNumAllocated += pcSrc->mNumAllocated;
+    ReserveMaterialProperties(pcDest, pcDest->mNumAllocated + pcSrc->mNumAllocated);
     pcDest->mNumProperties += pcSrc->mNumProperties;
 
-    const unsigned int numAllocated = pcDest->mNumAllocated;
-    aiMaterialProperty **pcOld = pcDest->mProperties;
-    pcDest->mProperties = new aiMaterialProperty *[numAllocated];
-
-    ai_assert(!iOldNum || pcOld);
-    ai_assert(iOldNum < numAllocated);
-
-    if (iOldNum && pcOld) {
-        for (unsigned int i = 0; i < iOldNum; ++i) {
-            pcDest->mProperties[i] = pcOld[i];
-        }
-    }
-
-    if (pcOld) {
-        delete[] pcOld;
-    }
-
     for (unsigned int i = iOldNum; i < pcDest->mNumProperties; ++i) {
         aiMaterialProperty *propSrc = pcSrc->mProperties[i];
 
@@ -705,4 +924,5 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
         prop->mData = new char[propSrc->mDataLength];
         memcpy(prop->mData, propSrc->mData, prop->mDataLength);
     }
+    InvalidateMaterialPropertyIndex(pcDest);
 }
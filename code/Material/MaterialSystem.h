@@ -46,6 +46,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef AI_MATERIALSYSTEM_H_INC
 #define AI_MATERIALSYSTEM_H_INC
 
+#include <assimp/defs.h>
+
 #include <stdint.h>
 
 struct aiMaterial;
@@ -65,6 +67,26 @@ namespace Assimp {
  */
 uint32_t ComputeMaterialHash(const aiMaterial* mat, bool includeMatName = false);
 
+// ------------------------------------------------------------------------------
+/** Grows the property array of a material so it can hold at least
+ *  numAllocated properties. The array carries the lookup index of the material
+ *  in a hidden slot in front of it, so it must be grown through this function
+ *  instead of replacing aiMaterial::mProperties.
+ *
+ *  @param  mat           The material
+ *  @param  numAllocated  The minimum number of entries
+ */
+ASSIMP_API void ReserveMaterialProperties(aiMaterial *mat, unsigned int numAllocated);
+
+// ------------------------------------------------------------------------------
+/** Drops the lookup index of a material, it is rebuilt on the next query.
+ *  Code which replaces entries of aiMaterial::mProperties in place has to call
+ *  this, a changed number of properties is detected by the index itself.
+ *
+ *  @param  mat  The material
+ */
+ASSIMP_API void InvalidateMaterialPropertyIndex(const aiMaterial *mat);
+
 
 } // ! namespace Assimp
 
@@ -51,6 +51,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -86,10 +88,10 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+    std::atomic<bool> bHas(false);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
         if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -47,8 +47,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "FindInstancesProcess.h"
+#include <cmath>
+#include <cstring>
 #include <memory>
 #include <stdio.h>
+#include <unordered_map>
+#include <vector>
 
 using namespace Assimp;
 
@@ -56,6 +60,7 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 FindInstancesProcess::FindInstancesProcess()
 :   configSpeedFlag (false)
+,   configContentHash (false)
 {}
 
 // ------------------------------------------------------------------------------------------------
@@ -73,6 +78,62 @@ void FindInstancesProcess::SetupProperties(const Importer* pImp)
 {
     // AI_CONFIG_FAVOUR_SPEED
     configSpeedFlag = (0 != pImp->GetPropertyInteger(AI_CONFIG_FAVOUR_SPEED,0));
+
+    // AI_CONFIG_PP_FI_CONTENT_HASH
+    configContentHash = pImp->GetPropertyBool(AI_CONFIG_PP_FI_CONTENT_HASH,false);
+}
+
+// use a constant epsilon for colors and UV coordinates
+static const float uvEpsilon = 10e-4f;
+
+// ------------------------------------------------------------------------------------------------
+// Get the size of the grid the values are quantized to. It's the power of two next to the epsilon,
+// so the grid is the same for instances whose epsilons differ slightly.
+static double GetQuantizationCell(float epsilon)
+{
+    int exponent = 0;
+    std::frexp(static_cast<double>(epsilon), &exponent);
+    return std::ldexp(1.0, exponent);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Mix an array of vectors quantized to the given grid into the hash, FNV-1a style
+static void HashArray(uint64_t& hash, const aiVector3D* data, unsigned int size, double cell)
+{
+    for (const aiVector3D* end = data + size; data != end; ++data) {
+        for (unsigned int c = 0; c < 3; ++c) {
+            // adding 0.0 turns -0.0 into 0.0
+            const double q = std::floor(static_cast<double>((*data)[c]) / cell) + 0.0;
+            uint64_t bits;
+            ::memcpy(&bits, &q, sizeof(bits));
+            hash = (hash ^ bits) * 0x100000001b3ull;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Get a hash of the positions, normals and texture coordinates of a mesh, quantized by the
+// epsilons which are used to compare them.
+static uint64_t GetMeshContentHash(const aiMesh* mesh, float epsilon)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    if (epsilon > 0.f) {
+        const double cell = GetQuantizationCell(epsilon);
+        if (mesh->HasPositions()) {
+            HashArray(hash, mesh->mVertices, mesh->mNumVertices, cell);
+        }
+        if (mesh->HasNormals()) {
+            HashArray(hash, mesh->mNormals, mesh->mNumVertices, cell);
+        }
+    }
+
+    const double uvCell = GetQuantizationCell(uvEpsilon);
+    for (unsigned int j = 0, end = mesh->GetNumUVChannels(); j < end; ++j) {
+        if (mesh->mTextureCoords[j]) {
+            HashArray(hash, mesh->mTextureCoords[j], mesh->mNumVertices, uvCell);
+        }
+    }
+    return hash;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -122,130 +183,142 @@ void FindInstancesProcess::Execute( aiScene* pScene)
         // in the pipeline, so we could, depending on the file format,
         // have several thousand small meshes. That's too much for a brute
         // everyone-against-everyone check involving up to 10 comparisons
-        // each.
+        // each, so meshes with equal hashes are kept in buckets and each
+        // mesh is only compared against the ones in its bucket.
         std::unique_ptr<uint64_t[]> hashes (new uint64_t[pScene->mNumMeshes]);
+        std::unique_ptr<float[]> epsilons (new float[pScene->mNumMeshes]);
         std::unique_ptr<unsigned int[]> remapping (new unsigned int[pScene->mNumMeshes]);
 
-        unsigned int numMeshesOut = 0;
-        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
-
+        // the hashes don't depend on each other
+        ParallelFor(pScene->mNumMeshes, [&](unsigned int i) {
             aiMesh* inst = pScene->mMeshes[i];
-            hashes[i] = GetMeshHash(inst);
 
             // Find an appropriate epsilon
             // to compare position differences against
-            float epsilon = ComputePositionEpsilon(inst);
-            epsilon *= epsilon;
+            const float epsilon = ComputePositionEpsilon(inst);
+            epsilons[i] = epsilon * epsilon;
 
-            for (int a = i-1; a >= 0; --a) {
-                if (hashes[i] == hashes[a])
-                {
-                    aiMesh* orig = pScene->mMeshes[a];
-                    if (!orig)
-                        continue;
+            hashes[i] = GetMeshHash(inst);
+            if (configContentHash) {
+                hashes[i] ^= GetMeshContentHash(inst, epsilon) * 0x9e3779b97f4a7c15ull;
+            }
+        });
+
+        std::unordered_map<uint64_t, std::vector<unsigned int>> buckets;
+        buckets.reserve(pScene->mNumMeshes);
 
-                    // check for hash collision .. we needn't check
-                    // the vertex format, it *must* match due to the
-                    // (brilliant) construction of the hash
-                    if (orig->mNumBones       != inst->mNumBones      ||
-                        orig->mNumFaces       != inst->mNumFaces      ||
-                        orig->mNumVertices    != inst->mNumVertices   ||
-                        orig->mMaterialIndex  != inst->mMaterialIndex ||
-                        orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+        unsigned int numMeshesOut = 0;
+        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+
+            aiMesh* inst = pScene->mMeshes[i];
+            const float epsilon = epsilons[i];
+
+            // the bucket holds the meshes kept so far, try the latest ones first
+            std::vector<unsigned int>& bucket = buckets[hashes[i]];
+            for (auto it = bucket.rbegin(); it != bucket.rend(); ++it) {
+                const unsigned int a = *it;
+                aiMesh* orig = pScene->mMeshes[a];
+
+                // check for hash collision .. we needn't check
+                // the vertex format, it *must* match due to the
+                // (brilliant) construction of the hash
+                if (orig->mNumBones       != inst->mNumBones      ||
+                    orig->mNumFaces       != inst->mNumFaces      ||
+                    orig->mNumVertices    != inst->mNumVertices   ||
+                    orig->mMaterialIndex  != inst->mMaterialIndex ||
+                    orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+                    continue;
+
+                // up to now the meshes are equal. Now compare vertex positions, normals,
+                // tangents and bitangents using this epsilon.
+                if (orig->HasPositions()) {
+                    if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+                        continue;
+                }
+                if (orig->HasNormals()) {
+                    if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
+                        continue;
+                }
+                if (orig->HasTangentsAndBitangents()) {
+                    if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
+                        !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
                         continue;
+                }
 
-                    // up to now the meshes are equal. Now compare vertex positions, normals,
-                    // tangents and bitangents using this epsilon.
-                    if (orig->HasPositions()) {
-                        if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+                {
+                    unsigned int j, end = orig->GetNumUVChannels();
+                    for(j = 0; j < end; ++j) {
+                        if (!orig->mTextureCoords[j]) {
                             continue;
+                        }
+                        if(!CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
+                            break;
+                        }
                     }
-                    if (orig->HasNormals()) {
-                        if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
-                            continue;
+                    if (j != end) {
+                        continue;
                     }
-                    if (orig->HasTangentsAndBitangents()) {
-                        if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
-                            !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
+                }
+                {
+                    unsigned int j, end = orig->GetNumColorChannels();
+                    for(j = 0; j < end; ++j) {
+                        if (!orig->mColors[j]) {
                             continue;
-                    }
-
-                    // use a constant epsilon for colors and UV coordinates
-                    static const float uvEpsilon = 10e-4f;
-                    {
-                        unsigned int j, end = orig->GetNumUVChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mTextureCoords[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
                         }
-                        if (j != end) {
-                            continue;
+                        if(!CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
+                            break;
                         }
                     }
-                    {
-                        unsigned int j, end = orig->GetNumColorChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mColors[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
-                        }
-                        if (j != end) {
-                            continue;
-                        }
+                    if (j != end) {
+                        continue;
                     }
+                }
 
-                    // These two checks are actually quite expensive and almost *never* required.
-                    // Almost. That's why they're still here. But there's no reason to do them
-                    // in speed-targeted imports.
-                    if (!configSpeedFlag) {
-
-                        // It seems to be strange, but we really need to check whether the
-                        // bones are identical too. Although it's extremely unprobable
-                        // that they're not if control reaches here, we need to deal
-                        // with unprobable cases, too. It could still be that there are
-                        // equal shapes which are deformed differently.
-                        if (!CompareBones(orig,inst))
-                            continue;
+                // These two checks are actually quite expensive and almost *never* required.
+                // Almost. That's why they're still here. But there's no reason to do them
+                // in speed-targeted imports.
+                if (!configSpeedFlag) {
+
+                    // It seems to be strange, but we really need to check whether the
+                    // bones are identical too. Although it's extremely unprobable
+                    // that they're not if control reaches here, we need to deal
+                    // with unprobable cases, too. It could still be that there are
+                    // equal shapes which are deformed differently.
+                    if (!CompareBones(orig,inst))
+                        continue;
 
-                        // For completeness ... compare even the index buffers for equality
-                        // face order & winding order doesn't care. Input data is in verbose format.
-                        std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
-                        std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
+                    // For completeness ... compare even the index buffers for equality
+                    // face order & winding order doesn't care. Input data is in verbose format.
+                    std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
+                    std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
 
-                        for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
-                            aiFace& f = orig->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
-                                ftbl_orig[f.mIndices[nn]] = tt;
+                    for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
+                        aiFace& f = orig->mFaces[tt];
+                        for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
+                            ftbl_orig[f.mIndices[nn]] = tt;
 
-                            aiFace& f2 = inst->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
-                                ftbl_inst[f2.mIndices[nn]] = tt;
-                        }
-                        if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
-                            continue;
+                        aiFace& f2 = inst->mFaces[tt];
+                        for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
+                            ftbl_inst[f2.mIndices[nn]] = tt;
                     }
+                    if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
+                        continue;
+                }
 
-                    // We're still here. Or in other words: 'inst' is an instance of 'orig'.
-                    // Place a marker in our list that we can easily update mesh indices.
-                    remapping[i] = remapping[a];
+                // We're still here. Or in other words: 'inst' is an instance of 'orig'.
+                // Place a marker in our list that we can easily update mesh indices.
+                remapping[i] = remapping[a];
 
-                    // Delete the instanced mesh, we don't need it anymore
-                    delete inst;
-                    pScene->mMeshes[i] = nullptr;
-                    break;
-                }
+                // Delete the instanced mesh, we don't need it anymore
+                delete inst;
+                pScene->mMeshes[i] = nullptr;
+                break;
             }
 
             // If we didn't find a match for the current mesh: keep it
             if (pScene->mMeshes[i]) {
                 remapping[i] = numMeshesOut++;
+                bucket.push_back(i);
             }
         }
         ai_assert(0 != numMeshesOut);
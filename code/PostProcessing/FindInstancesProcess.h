@@ -105,7 +105,7 @@ inline bool CompareArrays(const aiColor4D* first, const aiColor4D* second,
 // ---------------------------------------------------------------------------
 /** @brief A post-processing steps to search for instanced meshes
 */
-class FindInstancesProcess : public BaseProcess {
+class ASSIMP_API FindInstancesProcess : public BaseProcess {
 public:
     FindInstancesProcess();
     ~FindInstancesProcess() override = default;
@@ -124,6 +124,7 @@ public:
 
 private:
     bool configSpeedFlag;
+    bool configContentHash;
 }; // ! end class FindInstancesProcess
 
 }  // ! end namespace Assimp
@@ -49,6 +49,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -84,11 +86,11 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+    std::atomic<bool> bHas(false);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
         if (GenMeshVertexNormals(pScene->mMeshes[a], a))
             bHas = true;
-    }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
@@ -56,6 +56,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <stdio.h>
 #include <stack>
+#include <vector>
 
 namespace Assimp {
 
@@ -89,10 +90,16 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
+    // the statistics are summed up in mesh order to keep the output stable
+    std::vector<ai_real> results(pScene->mNumMeshes, 0.f);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        results[a] = ProcessMesh(pScene->mMeshes[a], a);
+    });
+
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
+        const float res = results[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out += res;
@@ -0,0 +1,308 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to generate interleaved
+ *        vertex buffers for all meshes.
+ */
+
+#ifndef ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
+
+#include "PostProcessing/InterleaveVerticesProcess.h"
+
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/config.h>
+#include <assimp/scene.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Parses "<prefix><index>", the index is optional and defaults to 0
+bool ParseChannel(const std::string &name, const char *prefix, unsigned int maxChannels, unsigned int &index) {
+    const size_t len = ::strlen(prefix);
+    if (name.compare(0, len, prefix) != 0) {
+        return false;
+    }
+    index = 0;
+    if (name.size() == len) {
+        return true;
+    }
+    for (size_t i = len; i < name.size(); ++i) {
+        if (name[i] < '0' || name[i] > '9' || index >= maxChannels) {
+            return false;
+        }
+        index = index * 10 + static_cast<unsigned int>(name[i] - '0');
+    }
+    return index < maxChannels;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParseSemantic(const std::string &name, aiVertexAttribute &attribute) {
+    attribute.mIndex = 0;
+    if (name == "position") {
+        attribute.mSemantic = aiVertexAttributeSemantic_POSITION;
+    } else if (name == "normal") {
+        attribute.mSemantic = aiVertexAttributeSemantic_NORMAL;
+    } else if (name == "tangent") {
+        attribute.mSemantic = aiVertexAttributeSemantic_TANGENT;
+    } else if (name == "bitangent") {
+        attribute.mSemantic = aiVertexAttributeSemantic_BITANGENT;
+    } else if (ParseChannel(name, "texcoord", AI_MAX_NUMBER_OF_TEXTURECOORDS, attribute.mIndex)) {
+        attribute.mSemantic = aiVertexAttributeSemantic_TEXCOORD;
+    } else if (ParseChannel(name, "color", AI_MAX_NUMBER_OF_COLOR_SETS, attribute.mIndex)) {
+        attribute.mSemantic = aiVertexAttributeSemantic_COLOR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Parses "float<N>", "ubyte<N>n" or "short<N>n"
+bool ParseType(const std::string &name, aiVertexAttribute &attribute, unsigned int &componentSize) {
+    size_t pos = 0;
+    bool normalized = false;
+    if (name.compare(0, 5, "float") == 0) {
+        attribute.mType = aiVertexAttributeType_FLOAT;
+        componentSize = 4;
+        pos = 5;
+    } else if (name.compare(0, 5, "ubyte") == 0) {
+        attribute.mType = aiVertexAttributeType_UBYTE_NORM;
+        componentSize = 1;
+        pos = 5;
+        normalized = true;
+    } else if (name.compare(0, 5, "short") == 0) {
+        attribute.mType = aiVertexAttributeType_SHORT_NORM;
+        componentSize = 2;
+        pos = 5;
+        normalized = true;
+    } else {
+        return false;
+    }
+
+    if (name.size() != pos + (normalized ? 2 : 1) || name[pos] < '1' || name[pos] > '4') {
+        return false;
+    }
+    if (normalized && name[pos + 1] != 'n') {
+        return false;
+    }
+    attribute.mNumComponents = static_cast<unsigned int>(name[pos] - '0');
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline unsigned int AlignTo4(unsigned int value) {
+    return (value + 3u) & ~3u;
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteComponents(unsigned char *out, const aiVertexAttribute &attribute, const float *values) {
+    switch (attribute.mType) {
+    case aiVertexAttributeType_UBYTE_NORM:
+        for (unsigned int c = 0; c < attribute.mNumComponents; ++c) {
+            out[c] = static_cast<unsigned char>(std::min(std::max(values[c], 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+        break;
+    case aiVertexAttributeType_SHORT_NORM:
+        for (unsigned int c = 0; c < attribute.mNumComponents; ++c) {
+            const int16_t value = static_cast<int16_t>(std::lround(std::min(std::max(values[c], -1.0f), 1.0f) * 32767.0f));
+            ::memcpy(out + c * sizeof(int16_t), &value, sizeof(int16_t));
+        }
+        break;
+    default:
+        ::memcpy(out, values, attribute.mNumComponents * sizeof(float));
+        break;
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool InterleaveVerticesProcess::IsActive(unsigned int) const {
+    // No flag bit is left for this step, the configured vertex format enables it
+    return !mFormat.empty();
+}
+
+// ------------------------------------------------------------------------------------------------
+void InterleaveVerticesProcess::SetupProperties(const Importer *pImp) {
+    mFormat = pImp->GetPropertyString(AI_CONFIG_PP_IV_VERTEX_FORMAT, "");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool InterleaveVerticesProcess::ParseFormat(const std::string &format, std::vector<aiVertexAttribute> &attributes, unsigned int &stride) {
+    attributes.clear();
+    stride = 0;
+
+    std::istringstream stream(format);
+    std::string token;
+    while (stream >> token) {
+        const size_t colon = token.find(':');
+        if (colon == std::string::npos) {
+            ASSIMP_LOG_ERROR("InterleaveVerticesProcess: Expected <semantic>:<type>, got ", token);
+            return false;
+        }
+
+        aiVertexAttribute attribute;
+        unsigned int componentSize = 0;
+        if (!ParseSemantic(token.substr(0, colon), attribute)) {
+            ASSIMP_LOG_ERROR("InterleaveVerticesProcess: Unknown vertex attribute semantic in ", token);
+            return false;
+        }
+        if (!ParseType(token.substr(colon + 1), attribute, componentSize)) {
+            ASSIMP_LOG_ERROR("InterleaveVerticesProcess: Unknown vertex attribute type in ", token);
+            return false;
+        }
+        attribute.mOffset = stride;
+        stride = AlignTo4(stride + attribute.mNumComponents * componentSize);
+        attributes.push_back(attribute);
+    }
+
+    return !attributes.empty();
+}
+
+// ------------------------------------------------------------------------------------------------
+void InterleaveVerticesProcess::ProcessMesh(aiMesh *mesh, const std::vector<aiVertexAttribute> &attributes, unsigned int stride) {
+    ai_assert(nullptr != mesh);
+
+    delete mesh->mVertexBuffer;
+    aiVertexBuffer *buffer = mesh->mVertexBuffer = new aiVertexBuffer();
+
+    buffer->mStride = stride;
+    buffer->mNumAttributes = static_cast<unsigned int>(attributes.size());
+    buffer->mAttributes = new aiVertexAttribute[attributes.size()];
+    std::copy(attributes.begin(), attributes.end(), buffer->mAttributes);
+
+    buffer->mNumVertices = mesh->mNumVertices;
+    if (mesh->mNumVertices > 0) {
+        buffer->mData = new unsigned char[static_cast<size_t>(mesh->mNumVertices) * stride]();
+    }
+
+    for (const aiVertexAttribute &attribute : attributes) {
+        const aiVector3D *vectors = nullptr;
+        const aiColor4D *colors = nullptr;
+        float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        switch (attribute.mSemantic) {
+        case aiVertexAttributeSemantic_POSITION:
+            vectors = mesh->mVertices;
+            values[3] = 1.0f;
+            break;
+        case aiVertexAttributeSemantic_NORMAL:
+            vectors = mesh->mNormals;
+            break;
+        case aiVertexAttributeSemantic_TANGENT:
+            vectors = mesh->mTangents;
+            break;
+        case aiVertexAttributeSemantic_BITANGENT:
+            vectors = mesh->mBitangents;
+            break;
+        case aiVertexAttributeSemantic_TEXCOORD:
+            vectors = mesh->mTextureCoords[attribute.mIndex];
+            break;
+        case aiVertexAttributeSemantic_COLOR:
+            colors = mesh->mColors[attribute.mIndex];
+            std::fill(values, values + 4, 1.0f);
+            break;
+        default:
+            break;
+        }
+
+        unsigned char *out = buffer->mData + attribute.mOffset;
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i, out += stride) {
+            if (nullptr != vectors) {
+                values[0] = vectors[i].x;
+                values[1] = vectors[i].y;
+                values[2] = vectors[i].z;
+            } else if (nullptr != colors) {
+                values[0] = colors[i].r;
+                values[1] = colors[i].g;
+                values[2] = colors[i].b;
+                values[3] = colors[i].a;
+            }
+            WriteComponents(out, attribute, values);
+        }
+    }
+
+    size_t numIndices = 0;
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        numIndices += mesh->mFaces[i].mNumIndices;
+    }
+    buffer->mNumIndices = static_cast<unsigned int>(numIndices);
+    if (numIndices > 0) {
+        buffer->mIndices = new unsigned int[numIndices];
+        unsigned int *outIndex = buffer->mIndices;
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            const aiFace &face = mesh->mFaces[i];
+            outIndex = std::copy(face.mIndices, face.mIndices + face.mNumIndices, outIndex);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void InterleaveVerticesProcess::Execute(aiScene *pScene) {
+    if (nullptr == pScene || mFormat.empty()) {
+        return;
+    }
+
+    std::vector<aiVertexAttribute> attributes;
+    unsigned int stride = 0;
+    if (!ParseFormat(mFormat, attributes, stride)) {
+        ASSIMP_LOG_ERROR("InterleaveVerticesProcess: Invalid vertex format \"", mFormat, "\", skipping the step");
+        return;
+    }
+
+    ASSIMP_LOG_DEBUG("InterleaveVerticesProcess begin");
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        if (nullptr != pScene->mMeshes[a]) {
+            ProcessMesh(pScene->mMeshes[a], attributes, stride);
+        }
+    });
+    ASSIMP_LOG_DEBUG("InterleaveVerticesProcess finished");
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
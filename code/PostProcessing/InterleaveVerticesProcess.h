@@ -0,0 +1,113 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to generate interleaved vertex
+ *        buffers and packed index buffers for all meshes.
+ */
+
+#pragma once
+
+#ifndef AI_INTERLEAVEVERTICESPROCESS_H_INC
+#define AI_INTERLEAVEVERTICESPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <assimp/mesh.h>
+#include <string>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/**
+ * @brief Post-processing process to copy the vertex streams of all meshes into
+ *        a single interleaved buffer in a configurable layout, see
+ *        #AI_CONFIG_PP_IV_VERTEX_FORMAT.
+ *
+ * There is no aiPostProcessSteps flag left for the step, so it isn't part of
+ * the regular step list. The Importer runs it after all other steps whenever
+ * the vertex format property is set.
+ */
+class ASSIMP_API InterleaveVerticesProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    InterleaveVerticesProcess() = default;
+    ~InterleaveVerticesProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns true once SetupProperties() read a vertex format, the flags are ignored.
+    bool IsActive(unsigned int pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will read the vertex format.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /// @brief Will parse a vertex format description.
+    /// @param format       The description, see #AI_CONFIG_PP_IV_VERTEX_FORMAT.
+    /// @param attributes   The attributes with their offsets.
+    /// @param stride       The size of a vertex.
+    /// @return false, if the description is invalid.
+    static bool ParseFormat(const std::string &format, std::vector<aiVertexAttribute> &attributes, unsigned int &stride);
+
+    // -------------------------------------------------------------------
+    /// @brief Will create the vertex buffer of a single mesh.
+    /// @param mesh         The mesh, an existing buffer will be replaced.
+    /// @param attributes   The vertex layout.
+    /// @param stride       The size of a vertex.
+    static void ProcessMesh(aiMesh *mesh, const std::vector<aiVertexAttribute> &attributes, unsigned int stride);
+
+private:
+    std::string mFormat;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_INTERLEAVEVERTICES_PROCESS
+
+#endif // AI_INTERLEAVEVERTICESPROCESS_H_INC
@@ -47,14 +47,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "JoinVerticesProcess.h"
 #include "ProcessHelper.h"
-#include <assimp/Vertex.h>
+#include "Common/ThreadPool.h"
 #include <assimp/TinyFormatter.h>
 
 #include <stdio.h>
-#include <unordered_set>
-#include <unordered_map>
+#include <algorithm>
+#include <cstring>
 #include <memory>
-#include <map>
+#include <type_traits>
 
 using namespace Assimp;
 
@@ -77,9 +77,13 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 
     // execute the step
+    std::vector<int> numVertices(pScene->mNumMeshes, 0);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        numVertices[a] = ProcessMesh( pScene->mMeshes[a],a);
+    });
     int iNumVertices = 0;
     for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+        iNumVertices += numVertices[a];
     }
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
@@ -156,6 +160,125 @@ void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes with fewer vertices are welded in a single partition, the
+// synchronization would cost more than it saves.
+static constexpr unsigned int MIN_VERTICES_PER_PARTITION = 1u << 15;
+
+static constexpr unsigned int NO_VERTEX = 0xffffffffu;
+
+// ------------------------------------------------------------------------------------------------
+// Bit pattern of a component for hashing. +0 and -0 compare equal, so they
+// have to hash equal as well.
+inline uint64_t componentBits(ai_real value) {
+    using Bits = std::conditional<sizeof(ai_real) == 8, uint64_t, uint32_t>::type;
+    if (value == static_cast<ai_real>(0)) {
+        return 0;
+    }
+    Bits bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline uint64_t hashCombine(uint64_t hash, uint64_t value) {
+    return (hash ^ value) * 0x100000001b3ull;
+}
+
+// ------------------------------------------------------------------------------------------------
+// The vertex channels a mesh actually has. Two vertices are identical if
+// all of them match, this is the equality Vertex::operator< implements
+// (tangents and bitangents are not compared, absent channels are zero).
+struct VertexChannels {
+    const aiVector3D *vectors[2 + AI_MAX_NUMBER_OF_TEXTURECOORDS];
+    const aiColor4D *colors[AI_MAX_NUMBER_OF_COLOR_SETS];
+    unsigned int numVectors;
+    unsigned int numColors;
+
+    explicit VertexChannels(const aiMesh *pMesh) :
+            numVectors(0), numColors(0) {
+        vectors[numVectors++] = pMesh->mVertices;
+        if (pMesh->HasNormals()) {
+            vectors[numVectors++] = pMesh->mNormals;
+        }
+        for (unsigned int a = 0; pMesh->HasTextureCoords(a); a++) {
+            vectors[numVectors++] = pMesh->mTextureCoords[a];
+        }
+        for (unsigned int a = 0; pMesh->HasVertexColors(a); a++) {
+            colors[numColors++] = pMesh->mColors[a];
+        }
+    }
+
+    uint64_t Hash(unsigned int idx) const {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (unsigned int a = 0; a < numVectors; a++) {
+            const aiVector3D &v = vectors[a][idx];
+            hash = hashCombine(hash, componentBits(v.x));
+            hash = hashCombine(hash, componentBits(v.y));
+            hash = hashCombine(hash, componentBits(v.z));
+        }
+        for (unsigned int a = 0; a < numColors; a++) {
+            const aiColor4D &c = colors[a][idx];
+            hash = hashCombine(hash, componentBits(c.r));
+            hash = hashCombine(hash, componentBits(c.g));
+            hash = hashCombine(hash, componentBits(c.b));
+            hash = hashCombine(hash, componentBits(c.a));
+        }
+        // final avalanche, the table uses the low and the partitioning the high bits
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    bool Equal(unsigned int a, unsigned int b) const {
+        for (unsigned int c = 0; c < numVectors; c++) {
+            if (vectors[c][a] != vectors[c][b]) {
+                return false;
+            }
+        }
+        for (unsigned int c = 0; c < numColors; c++) {
+            if (colors[c][a] != colors[c][b]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Welds the given vertices (in ascending order) using an open addressing table
+// with linear probing. Each vertex is mapped to the first identical vertex.
+void weldVertices(const VertexChannels &channels, const std::vector<uint64_t> &hashes,
+        const std::vector<unsigned int> &vertices, std::vector<unsigned int> &firstIdentical) {
+    size_t capacity = 16;
+    while (capacity < vertices.size() * 2) {
+        capacity <<= 1;
+    }
+    const size_t mask = capacity - 1;
+    std::vector<unsigned int> table(capacity, NO_VERTEX);
+
+    for (unsigned int vertex : vertices) {
+        const uint64_t hash = hashes[vertex];
+        size_t slot = static_cast<size_t>(hash) & mask;
+        for (;;) {
+            const unsigned int other = table[slot];
+            if (other == NO_VERTEX) {
+                table[slot] = vertex;
+                firstIdentical[vertex] = vertex;
+                break;
+            }
+            if (hashes[other] == hash && channels.Equal(other, vertex)) {
+                firstIdentical[vertex] = other;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+}
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -207,25 +330,54 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
             uniqueAnimatedVertices[animMeshIndex].reserve(pMesh->mNumVertices);
         }
     }
-    // a map that maps a vertex to its new index
-    std::map<Vertex, int> vertex2Index = {};
-    // we can not end up with more vertices than we started with
-    // Now check each vertex if it brings something new to the table
+    // Hash only the channels the mesh actually has. Large meshes are split
+    // into partitions by hash which are welded independently, identical
+    // vertices always end up in the same partition.
+    const VertexChannels channels(pMesh);
+    unsigned int numPartitions = 1;
+    if (nullptr != GetThreadPool()) {
+        numPartitions = std::max(1u, std::min(GetThreadPool()->GetNumThreads(),
+                pMesh->mNumVertices / MIN_VERTICES_PER_PARTITION));
+    }
+
+    std::vector<uint64_t> hashes(pMesh->mNumVertices);
+    const unsigned int numChunks = (pMesh->mNumVertices + MIN_VERTICES_PER_PARTITION - 1) / MIN_VERTICES_PER_PARTITION;
+    ParallelFor(numChunks, [&](unsigned int chunk) {
+        const unsigned int end = std::min(pMesh->mNumVertices, (chunk + 1) * MIN_VERTICES_PER_PARTITION);
+        for (unsigned int a = chunk * MIN_VERTICES_PER_PARTITION; a < end; a++) {
+            if (usedVertexIndicesMask[a]) {
+                hashes[a] = channels.Hash(a);
+            }
+        }
+    });
+
+    std::vector<std::vector<unsigned int>> partitions(numPartitions);
+    for (std::vector<unsigned int> &partition : partitions) {
+        partition.reserve(pMesh->mNumVertices / numPartitions);
+    }
+    for (unsigned int a = 0; a < pMesh->mNumVertices; a++) {
+        if (usedVertexIndicesMask[a]) {
+            partitions[(hashes[a] >> 32) % numPartitions].push_back(a);
+        }
+    }
+
+    // For each used vertex the index of the first vertex identical to it
+    std::vector<unsigned int> firstIdentical(pMesh->mNumVertices, NO_VERTEX);
+    ParallelFor(numPartitions, [&](unsigned int partition) {
+        weldVertices(channels, hashes, partitions[partition], firstIdentical);
+    });
+
+    // Now assign the new indices in vertex order, the first occurrence of
+    // a vertex is always processed before its duplicates.
     int newIndex = 0;
     for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
         // if the vertex is unused Do nothing
         if (!usedVertexIndicesMask[a]) {
             continue;
         }
-        // collect the vertex data
-        Vertex v(pMesh,a);
-        // is the vertex already in the map?
-        auto it = vertex2Index.find(v);
-        // if the vertex is not in the map then it is a new vertex add it.
-        if (it == vertex2Index.end()) {
+        const unsigned int first = firstIdentical[a];
+        if (first == a) {
             // this is a new vertex give it a new index
-            vertex2Index.emplace(v, newIndex);
-            // keep track of its index and increment 1
             replaceIndex[a] = newIndex++;
             // add the vertex to the unique vertices
             uniqueVertices.push_back(a);
@@ -237,7 +389,7 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
         } else{
             // if the vertex is already there just find the replace index that is appropriate to it
 			// mark it with JOINED_VERTICES_MARK
-            replaceIndex[a] = it->second | JOINED_VERTICES_MARK;
+            replaceIndex[a] = replaceIndex[first] | JOINED_VERTICES_MARK;
         }
     }
 
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 
 #include "TextureTransform.h"
+#include "Material/MaterialSystem.h"
 #include <assimp/StringUtils.h>
 
 using namespace Assimp;
@@ -259,6 +260,7 @@ void TextureTransformStep::Execute( aiScene* pScene) {
                         }
 
                         delete prop2;
+                        InvalidateMaterialPropertyIndex(mat);
 
                         // Warn: could be an underflow, but this does not invoke undefined behaviour
                         --a2;
@@ -70,6 +70,10 @@ class BaseProcess;
 class SharedPostProcessInfo;
 class IOStream;
 
+namespace Profiling {
+class Profiler;
+}
+
 // utility to do char4 to uint32 in a portable manner
 #define AI_MAKE_MAGIC(string) ((uint32_t)((string[0] << 24) + \
                                           (string[1] << 16) + (string[2] << 8) + string[3]))
@@ -405,6 +409,9 @@ protected:
     std::exception_ptr m_Exception;
     /// Currently set progress handler.
     ProgressHandler *m_progress;
+    /// Profiler of the running import, nullptr if #AI_CONFIG_GLOB_MEASURE_TIME is not set.
+    /// Use it with Profiling::ScopedRegion to time the phases of an import.
+    Profiling::Profiler *m_profiler;
 };
 
 } // end of namespace Assimp
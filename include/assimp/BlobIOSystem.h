@@ -295,6 +295,22 @@ public:
         delete pFile;
     }
 
+    // -------------------------------------------------------------------
+    /// @brief  Drops the blob written to the given file.
+    bool DeleteFile(const std::string &file) override {
+        bool found = false;
+        for (auto it = blobs.begin(); it != blobs.end();) {
+            if (it->first == file) {
+                delete it->second;
+                it = blobs.erase(it);
+                found = true;
+            } else {
+                ++it;
+            }
+        }
+        return created.erase(file) > 0 || found;
+    }
+
 private:
     // -------------------------------------------------------------------
     void OnDestruct(const std::string &filename, BlobIOStream *child) {
@@ -311,7 +327,7 @@ private:
 };
 
 // --------------------------------------------------------------------------------------------
-BlobIOStream::~BlobIOStream() {
+inline BlobIOStream::~BlobIOStream() {
     if (nullptr != creator) {
         creator->OnDestruct(file, this);
     }
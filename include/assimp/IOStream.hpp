@@ -124,6 +124,19 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the complete file contents without copying them,
+     *  if the stream supports this.
+     *
+     *  Streams which hold the whole file in memory (memory mapped files,
+     *  memory buffers) return a pointer to FileSize() bytes. It stays
+     *  valid until the stream is closed and does not depend on the
+     *  read cursor. The default implementation returns nullptr, use
+     *  Read() in this case. */
+    virtual const uint8_t* GetMappedData() const {
+        return nullptr;
+    }
 }; //! class IOStream
 
 } //!namespace Assimp
@@ -78,6 +78,10 @@ class BaseProcess;
 class SharedPostProcessInfo;
 class BatchLoader;
 
+namespace Profiling {
+class Profiler;
+}
+
 // =======================================================================
 // Holy stuff, only for members of the high council of the Jedi.
 class ImporterPimpl;
@@ -519,6 +523,20 @@ public:
      * following methods is called: #ReadFile(), #FreeScene(). */
     const std::exception_ptr& GetException() const;
 
+    // -------------------------------------------------------------------
+    /** Returns the profile recorded by the last call to ReadFile().
+     *
+     * The profile is only recorded if #AI_CONFIG_GLOB_MEASURE_TIME is
+     * enabled. It holds nested regions with wall time, bytes read and
+     * peak memory for reading, the importer's own phases, preprocessing
+     * and each post-processing step. Later calls to ApplyPostProcessing()
+     * are appended to it.
+     *
+     * @return The profile or nullptr if nothing was measured.
+     * @note The returned pointer remains valid until the Importer is
+     * destroyed, its contents are replaced by the next #ReadFile(). */
+    const Profiling::Profiler *GetProfile() const;
+
     // -------------------------------------------------------------------
     /** Returns the scene loaded by the last successful call to ReadFile()
      *
@@ -50,51 +50,117 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #   pragma GCC system_header
 #endif
 
-#include <chrono>
-#include <assimp/DefaultLogger.hpp>
-#include <assimp/TinyFormatter.h>
+#include <assimp/defs.h>
 
-#include <map>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 namespace Assimp {
 namespace Profiling {
 
-using namespace Formatter;
+// ------------------------------------------------------------------------------------------------
+/** A single measured region. Regions are nested, the parent of a region is the region which
+ *  was open when it began.
+ */
+struct ProfileRegion {
+    //! Name of the region, e.g. "import" or "aiProcess_Triangulate"
+    std::string name;
+
+    //! Index of the enclosing region in Profiler::GetRegions(), or NoParent
+    size_t parent;
+
+    //! Nesting depth, 0 for top-level regions
+    unsigned int depth;
+
+    //! Start time relative to the creation of the profiler, in seconds
+    double start;
+
+    //! Wall time spent in the region, in seconds. Negative while the region is open.
+    double duration;
+
+    //! Number of bytes read from input streams while the region was open
+    uint64_t bytesRead;
+
+    //! Peak resident memory of the process at the end of the region, in bytes.
+    //! 0 if the platform does not report it.
+    uint64_t peakMemory;
+
+    static constexpr size_t NoParent = ~static_cast<size_t>(0);
+};
 
 // ------------------------------------------------------------------------------------------------
-/** Simple wrapper around boost::timer to simplify reporting. Timings are automatically
- *  dumped to the log file.
+/** Records a tree of named, timed regions. Timings are written to the log as well, the full
+ *  profile can be retrieved with GetRegions() or serialized with ToJson() and ToChromeTrace().
+ *  An Importer keeps the profile of its last import if #AI_CONFIG_GLOB_MEASURE_TIME is set,
+ *  see Importer::GetProfile().
  */
-class Profiler {
+class ASSIMP_API Profiler {
 public:
-    Profiler() = default;
+    Profiler();
 
+    /** Start a named timer, nested into the innermost open region */
+    void BeginRegion(const std::string& region);
 
-    /** Start a named timer */
-    void BeginRegion(const std::string& region) {
-        regions[region] = std::chrono::system_clock::now();
-        ASSIMP_LOG_DEBUG("START `",region,"`");
-    }
+    /** End a specific named timer and write its end time to the log. Regions which were
+     *  opened inside of it and are still open are closed as well. */
+    void EndRegion(const std::string& region);
+
+    /** Account bytes read from an input stream to all open regions */
+    void AddBytesRead(uint64_t bytes);
+
+    /** Remove all recorded regions and restart the clock */
+    void Clear();
 
+    /** Get all recorded regions in the order they were started */
+    const std::vector<ProfileRegion>& GetRegions() const;
 
-    /** End a specific named timer and write its end time to the log */
-    void EndRegion(const std::string& region) {
-        RegionMap::const_iterator it = regions.find(region);
-        if (it == regions.end()) {
-            return;
+    /** Serialize the profile as a nested JSON document */
+    std::string ToJson() const;
+
+    /** Serialize the profile in the Chrome trace event format (chrome://tracing, Perfetto) */
+    std::string ToChromeTrace() const;
+
+    /** Returns the peak resident memory of the process in bytes, 0 if unknown */
+    static uint64_t GetPeakMemory();
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point mOrigin;
+    std::vector<ProfileRegion> mRegions;
+    std::vector<size_t> mOpen;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Opens a region on construction and closes it on destruction. Does nothing if no profiler
+ *  is given, so it can be used unconditionally.
+ */
+class ScopedRegion {
+public:
+    ScopedRegion(Profiler *profiler, const char *region) :
+            mProfiler(profiler), mRegion(region) {
+        if (mProfiler) {
+            mProfiler->BeginRegion(mRegion);
         }
+    }
 
-        std::chrono::duration<double> elapsedSeconds = std::chrono::system_clock::now() - regions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+    ~ScopedRegion() {
+        if (mProfiler) {
+            mProfiler->EndRegion(mRegion);
+        }
     }
 
+    ScopedRegion(const ScopedRegion &) = delete;
+    ScopedRegion &operator=(const ScopedRegion &) = delete;
+
 private:
-    typedef std::map<std::string,std::chrono::time_point<std::chrono::system_clock>> RegionMap;
-    RegionMap regions;
+    Profiler *mProfiler;
+    const char *mRegion;
 };
 
 }
 }
 
 #endif // AI_INCLUDED_PROFILER_H
-
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_IRRXML_WRAPPER
 
 #include <assimp/ai_assert.h>
+#include <assimp/ParsingUtils.h>
 #include <assimp/StringUtils.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -50,7 +51,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IOStream.hpp"
 
 #include <pugixml.hpp>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <istream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -87,6 +92,552 @@ public:
 using XmlNode = pugi::xml_node;
 using XmlAttribute = pugi::xml_attribute;
 
+/// @brief The Xml-Pull-Parser class.
+///
+/// Reads an xml-file block by block from a stream and reports it as a sequence of
+/// events, so the file is never held in memory as a whole. Only utf-8 encoded
+/// files are supported, comments, processing instructions and the doctype are
+/// skipped.
+///
+/// An example:
+/// @code
+/// XmlPullParser theParser(stream);
+/// for (XmlPullParser::Event ev = theParser.next(); ev != XmlPullParser::EndOfDocument; ev = theParser.next()) {
+///     if (ev == XmlPullParser::StartElement && theParser.getName() == "float_array") {
+///         const char *begin, *end;
+///         while (theParser.readTextBlock(begin, end)) {
+///             // parse the values in [begin, end)
+///         }
+///     }
+/// }
+/// @endcode
+class XmlPullParser {
+public:
+    /// @brief The events reported by the parser.
+    enum Event {
+        StartElement, ///< A start tag, name and attributes are valid.
+        EndElement, ///< An end tag, the name is valid. Also reported for empty-element tags.
+        Text, ///< Character data or a CDATA section inside of an element.
+        EndOfDocument ///< The end of the stream was reached.
+    };
+
+    using Attribute = std::pair<std::string, std::string>;
+
+    /// @brief  The class constructor.
+    /// @param[in] stream       The input stream, must stay valid while the parser is in use.
+    /// @param[in] blockSize    The number of bytes read from the stream at once.
+    explicit XmlPullParser(IOStream *stream, size_t blockSize = 64 * 1024);
+
+    ///	@brief  The class destructor, default implementation.
+    ~XmlPullParser() = default;
+
+    /// @brief  Will return true, if the stream is utf-8 encoded (or plain ascii).
+    /// @return false for utf-16 or utf-32 encoded streams and for streams declaring any other
+    ///         encoding in their xml declaration, which the pull parser can't read.
+    bool isUtf8();
+
+    /// @brief  Will read the next event, throws a DeadlyImportError if the xml is malformed.
+    /// @return The event.
+    Event next();
+
+    /// @brief  Will return the name of the element of the current StartElement or EndElement event.
+    const std::string &getName() const;
+
+    /// @brief  Will return the attributes of the current StartElement event with decoded values.
+    const std::vector<Attribute> &getAttributes() const;
+
+    /// @brief  Will return the decoded character data of the current Text event.
+    const std::string &getText() const;
+
+    /// @brief  Will return true, if the current Text event is a CDATA section.
+    bool isCData() const;
+
+    /// @brief  Will read the character data following the current position block by block
+    ///         instead of reporting it as a Text event. The blocks never split a whitespace
+    ///         separated token and stay valid until the next call, entities are not decoded.
+    ///         Use it to parse large arrays of numbers directly after a StartElement event.
+    /// @param[out] begin   The begin of the block.
+    /// @param[out] end     The end of the block.
+    /// @return true, if a block was read, false at the end of the character data.
+    bool readTextBlock(const char *&begin, const char *&end);
+
+    /// @brief  Will return the current depth of open elements.
+    size_t getDepth() const;
+
+    XmlPullParser(const XmlPullParser &) = delete;
+    XmlPullParser &operator=(const XmlPullParser &) = delete;
+
+private:
+    bool fill();
+    bool ensure(size_t count);
+    size_t find(char c, size_t offset);
+    size_t find(const char *token, size_t offset);
+    bool startsWith(const char *token);
+    size_t findTagEnd();
+    void readStartTag(size_t tagEnd);
+    void readText();
+    [[noreturn]] void fail(const char *message) const;
+    static void decode(const char *begin, const char *end, std::string &out, bool attribute);
+
+    static constexpr size_t npos = ~static_cast<size_t>(0);
+
+    IOStream *mStream;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mEnd;
+    size_t mOffset;
+    bool mEof;
+    bool mPendingEnd;
+    bool mIsCData;
+    std::string mName;
+    std::string mText;
+    std::string mRaw;
+    std::vector<Attribute> mAttributes;
+    std::vector<std::string> mOpenElements;
+};
+
+/// @brief  Will be called for every new element while a document is built from a
+///         XmlPullParser. The handler may consume the character data of the element
+///         with XmlPullParser::readTextBlock() instead of storing it in the document.
+using XmlElementHandler = std::function<void(XmlPullParser &parser, XmlNode &node)>;
+
+inline XmlPullParser::XmlPullParser(IOStream *stream, size_t blockSize) :
+        mStream(stream),
+        mBuffer(std::max<size_t>(blockSize, 16) + 1, '\0'),
+        mPos(0),
+        mEnd(0),
+        mOffset(0),
+        mEof(nullptr == stream),
+        mPendingEnd(false),
+        mIsCData(false) {
+    // skip the utf-8 byte order mark
+    if (startsWith("\xef\xbb\xbf")) {
+        mPos += 3;
+    }
+}
+
+inline bool XmlPullParser::isUtf8() {
+    if (!ensure(2)) {
+        return true;
+    }
+    const unsigned char c0 = static_cast<unsigned char>(mBuffer[mPos]);
+    const unsigned char c1 = static_cast<unsigned char>(mBuffer[mPos + 1]);
+    // byte order marks of utf-16 and utf-32 or a '<' encoded with more than one byte
+    if ((c0 == 0xfe && c1 == 0xff) || (c0 == 0xff && c1 == 0xfe) || c0 == 0 || c1 == 0) {
+        return false;
+    }
+
+    // without an encoding in the xml declaration the document is utf-8
+    if (!startsWith("<?xml") || !ensure(6) || !IsSpaceOrNewLine(mBuffer[mPos + 5])) {
+        return true;
+    }
+    const size_t end = find("?>", 5);
+    if (npos == end) {
+        return true;
+    }
+    const std::string declaration(mBuffer.data() + mPos, end);
+    const std::string::size_type key = declaration.find("encoding");
+    if (std::string::npos == key) {
+        return true;
+    }
+    const std::string::size_type valueBegin = declaration.find_first_of("\"'", key + 8);
+    if (std::string::npos == valueBegin) {
+        return true;
+    }
+    const std::string::size_type valueEnd = declaration.find(declaration[valueBegin], valueBegin + 1);
+    if (std::string::npos == valueEnd) {
+        return true;
+    }
+    const std::string encoding = ai_tolower(declaration.substr(valueBegin + 1, valueEnd - valueBegin - 1));
+    return encoding == "utf-8" || encoding == "utf8" || encoding == "us-ascii" || encoding == "ascii";
+}
+
+inline XmlPullParser::Event XmlPullParser::next() {
+    if (mPendingEnd) {
+        mPendingEnd = false;
+        mName = mOpenElements.back();
+        mOpenElements.pop_back();
+        return EndElement;
+    }
+
+    mIsCData = false;
+    for (;;) {
+        if (!ensure(1)) {
+            if (!mOpenElements.empty()) {
+                fail("unexpected end of file");
+            }
+            return EndOfDocument;
+        }
+
+        if (mBuffer[mPos] != '<') {
+            readText();
+            // like pugixml, whitespace-only character data is not reported
+            if (mOpenElements.empty() || std::all_of(mText.begin(), mText.end(), IsSpaceOrNewLine<char>)) {
+                continue;
+            }
+            return Text;
+        }
+
+        if (startsWith("<?")) {
+            const size_t end = find("?>", 2);
+            if (npos == end) {
+                fail("unterminated processing instruction");
+            }
+            mPos += end + 2;
+        } else if (startsWith("<!--")) {
+            const size_t end = find("-->", 4);
+            if (npos == end) {
+                fail("unterminated comment");
+            }
+            mPos += end + 3;
+        } else if (startsWith("<![CDATA[")) {
+            const size_t end = find("]]>", 9);
+            if (npos == end) {
+                fail("unterminated CDATA section");
+            }
+            if (mOpenElements.empty()) {
+                fail("CDATA section outside of the root element");
+            }
+            mText.assign(mBuffer.data() + mPos + 9, end - 9);
+            mPos += end + 3;
+            mIsCData = true;
+            return Text;
+        } else if (startsWith("<!")) {
+            // the doctype, which may contain an internal subset in brackets
+            int depth = 0;
+            for (size_t i = 2;; ++i) {
+                if (!ensure(i + 1)) {
+                    fail("unterminated document type declaration");
+                }
+                const char c = mBuffer[mPos + i];
+                if (c == '[') {
+                    ++depth;
+                } else if (c == ']') {
+                    --depth;
+                } else if (c == '>' && depth <= 0) {
+                    mPos += i + 1;
+                    break;
+                }
+            }
+        } else if (startsWith("</")) {
+            const size_t end = find('>', 2);
+            if (npos == end) {
+                fail("unterminated end tag");
+            }
+            const char *nameBegin = mBuffer.data() + mPos + 2;
+            const char *nameEnd = mBuffer.data() + mPos + end;
+            while (nameEnd != nameBegin && IsSpaceOrNewLine(nameEnd[-1])) {
+                --nameEnd;
+            }
+            mName.assign(nameBegin, nameEnd);
+            if (mOpenElements.empty() || mOpenElements.back() != mName) {
+                fail("end tag does not match the start tag");
+            }
+            mOpenElements.pop_back();
+            mPos += end + 1;
+            return EndElement;
+        } else {
+            const size_t end = findTagEnd();
+            if (npos == end) {
+                fail("unterminated start tag");
+            }
+            readStartTag(end);
+            return StartElement;
+        }
+    }
+}
+
+inline const std::string &XmlPullParser::getName() const {
+    return mName;
+}
+
+inline const std::vector<XmlPullParser::Attribute> &XmlPullParser::getAttributes() const {
+    return mAttributes;
+}
+
+inline const std::string &XmlPullParser::getText() const {
+    return mText;
+}
+
+inline bool XmlPullParser::isCData() const {
+    return mIsCData;
+}
+
+inline bool XmlPullParser::readTextBlock(const char *&begin, const char *&end) {
+    if (mPendingEnd) {
+        return false;
+    }
+
+    for (size_t offset = 0;;) {
+        const char *data = mBuffer.data() + mPos;
+        const size_t size = mEnd - mPos;
+        if (const char *lt = static_cast<const char *>(::memchr(data + offset, '<', size - offset))) {
+            begin = data;
+            end = lt;
+            mPos += static_cast<size_t>(lt - data);
+            return begin != end;
+        }
+
+        // don't split a token at the end of the buffer
+        size_t stop = size;
+        while (stop > 0 && !IsSpaceOrNewLine(data[stop - 1])) {
+            --stop;
+        }
+        if (stop > 0) {
+            begin = data;
+            end = data + stop;
+            mPos += stop;
+            return true;
+        }
+
+        offset = size;
+        if (!fill()) {
+            // the character data runs to the end of the file
+            begin = mBuffer.data() + mPos;
+            end = mBuffer.data() + mEnd;
+            mPos = mEnd;
+            return begin != end;
+        }
+    }
+}
+
+inline size_t XmlPullParser::getDepth() const {
+    return mOpenElements.size();
+}
+
+inline bool XmlPullParser::fill() {
+    if (mEof) {
+        return false;
+    }
+
+    // keep the unread data, the buffer grows if a single token doesn't fit
+    if (mPos > 0) {
+        ::memmove(mBuffer.data(), mBuffer.data() + mPos, mEnd - mPos);
+        mOffset += mPos;
+        mEnd -= mPos;
+        mPos = 0;
+    }
+    if (mEnd + 1 == mBuffer.size()) {
+        mBuffer.resize(mBuffer.size() * 2);
+    }
+
+    // the buffer stays zero-terminated for the number parsers
+    const size_t read = mStream->Read(mBuffer.data() + mEnd, 1, mBuffer.size() - mEnd - 1);
+    mEnd += read;
+    mBuffer[mEnd] = '\0';
+    if (0 == read) {
+        mEof = true;
+        return false;
+    }
+    return true;
+}
+
+inline bool XmlPullParser::ensure(size_t count) {
+    while (mEnd - mPos < count) {
+        if (!fill()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline size_t XmlPullParser::find(char c, size_t offset) {
+    for (;;) {
+        if (mPos + offset < mEnd) {
+            const char *data = mBuffer.data() + mPos;
+            if (const char *hit = static_cast<const char *>(::memchr(data + offset, c, mEnd - mPos - offset))) {
+                return static_cast<size_t>(hit - data);
+            }
+            offset = mEnd - mPos;
+        }
+        if (!fill()) {
+            return npos;
+        }
+    }
+}
+
+inline size_t XmlPullParser::find(const char *token, size_t offset) {
+    const size_t len = ::strlen(token);
+    for (;;) {
+        const size_t hit = find(token[0], offset);
+        if (npos == hit || !ensure(hit + len)) {
+            return npos;
+        }
+        if (0 == ::memcmp(mBuffer.data() + mPos + hit, token, len)) {
+            return hit;
+        }
+        offset = hit + 1;
+    }
+}
+
+inline bool XmlPullParser::startsWith(const char *token) {
+    const size_t len = ::strlen(token);
+    return ensure(len) && 0 == ::memcmp(mBuffer.data() + mPos, token, len);
+}
+
+inline size_t XmlPullParser::findTagEnd() {
+    char quote = 0;
+    for (size_t i = 1;; ++i) {
+        if (!ensure(i + 1)) {
+            return npos;
+        }
+        const char c = mBuffer[mPos + i];
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '>') {
+            return i;
+        }
+    }
+}
+
+inline void XmlPullParser::readStartTag(size_t tagEnd) {
+    const char *it = mBuffer.data() + mPos + 1;
+    const char *end = mBuffer.data() + mPos + tagEnd;
+    const bool empty = end[-1] == '/';
+    if (empty) {
+        --end;
+    }
+
+    const char *name = it;
+    while (it != end && !IsSpaceOrNewLine(*it)) {
+        ++it;
+    }
+    if (it == name) {
+        fail("expected element name");
+    }
+    mName.assign(name, it);
+
+    mAttributes.clear();
+    for (;;) {
+        while (it != end && IsSpaceOrNewLine(*it)) {
+            ++it;
+        }
+        if (it == end) {
+            break;
+        }
+
+        const char *attributeName = it;
+        while (it != end && *it != '=' && !IsSpaceOrNewLine(*it)) {
+            ++it;
+        }
+        const char *attributeNameEnd = it;
+        while (it != end && IsSpaceOrNewLine(*it)) {
+            ++it;
+        }
+        if (it == end || *it != '=') {
+            fail("expected '=' behind the attribute name");
+        }
+        ++it;
+        while (it != end && IsSpaceOrNewLine(*it)) {
+            ++it;
+        }
+        if (it == end || (*it != '"' && *it != '\'')) {
+            fail("expected a quoted attribute value");
+        }
+
+        const char quote = *it++;
+        const char *value = it;
+        while (it != end && *it != quote) {
+            ++it;
+        }
+        if (it == end) {
+            fail("unterminated attribute value");
+        }
+        mAttributes.emplace_back(std::string(attributeName, attributeNameEnd), std::string());
+        decode(value, it, mAttributes.back().second, true);
+        ++it;
+    }
+
+    mPos += tagEnd + 1;
+    mOpenElements.push_back(mName);
+    mPendingEnd = empty;
+}
+
+inline void XmlPullParser::readText() {
+    // collect the raw text first, entities may span the blocks
+    mRaw.clear();
+    for (;;) {
+        const char *data = mBuffer.data() + mPos;
+        const char *lt = static_cast<const char *>(::memchr(data, '<', mEnd - mPos));
+        const size_t size = lt ? static_cast<size_t>(lt - data) : mEnd - mPos;
+        mRaw.append(data, size);
+        mPos += size;
+        if (lt || !fill()) {
+            break;
+        }
+    }
+    decode(mRaw.data(), mRaw.data() + mRaw.size(), mText, false);
+}
+
+inline void XmlPullParser::fail(const char *message) const {
+    throw DeadlyImportError("XML: ", message, " at offset ", mOffset + mPos);
+}
+
+inline void XmlPullParser::decode(const char *begin, const char *end, std::string &out, bool attribute) {
+    out.clear();
+    out.reserve(static_cast<size_t>(end - begin));
+    for (const char *it = begin; it != end; ++it) {
+        char c = *it;
+        // normalize the line ends and the whitespace in attribute values like pugixml
+        if (c == '\r') {
+            if (it + 1 != end && it[1] == '\n') {
+                ++it;
+            }
+            c = '\n';
+        }
+        if (attribute && (c == '\n' || c == '\t')) {
+            c = ' ';
+        }
+
+        if (c == '&') {
+            const char *semicolon = std::find(it + 1, std::min(end, it + 12), ';');
+            if (semicolon != std::min(end, it + 12)) {
+                const std::string entity(it + 1, semicolon);
+                unsigned long codepoint = 0;
+                if (entity == "lt") {
+                    codepoint = '<';
+                } else if (entity == "gt") {
+                    codepoint = '>';
+                } else if (entity == "amp") {
+                    codepoint = '&';
+                } else if (entity == "quot") {
+                    codepoint = '"';
+                } else if (entity == "apos") {
+                    codepoint = '\'';
+                } else if (entity.size() > 1 && entity[0] == '#') {
+                    codepoint = entity[1] == 'x' ? std::strtoul(entity.c_str() + 2, nullptr, 16) : std::strtoul(entity.c_str() + 1, nullptr, 10);
+                }
+
+                if (codepoint > 0 && codepoint <= 0x10ffff) {
+                    // utf-8 encode the character
+                    if (codepoint < 0x80) {
+                        out += static_cast<char>(codepoint);
+                    } else if (codepoint < 0x800) {
+                        out += static_cast<char>(0xc0 | (codepoint >> 6));
+                        out += static_cast<char>(0x80 | (codepoint & 0x3f));
+                    } else if (codepoint < 0x10000) {
+                        out += static_cast<char>(0xe0 | (codepoint >> 12));
+                        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+                        out += static_cast<char>(0x80 | (codepoint & 0x3f));
+                    } else {
+                        out += static_cast<char>(0xf0 | (codepoint >> 18));
+                        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f));
+                        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+                        out += static_cast<char>(0x80 | (codepoint & 0x3f));
+                    }
+                    it = semicolon;
+                    continue;
+                }
+            }
+        }
+        out += c;
+    }
+}
+
 /// @brief The Xml-Parser class.
 ///
 /// Use this parser if you have to import any kind of xml-format.
@@ -129,6 +680,13 @@ public:
     /// @return true, if the parsing was successful, false if not.
     bool parse(IOStream *stream);
 
+    /// @brief  Will parse an xml-file from a given stream with a XmlPullParser, so only
+    ///         the document but never the whole file is held in memory.
+    /// @param[in] stream      The input stream.
+    /// @param[in] handler     Will be called for every new element, may be empty.
+    /// @return true, if the parsing was successful, false if not.
+    bool parseStreaming(IOStream *stream, const XmlElementHandler &handler);
+
     /// @brief  Will parse an xml-file from a stringstream.
     /// @param[in] str      The input istream (note: not "const" to match pugixml param)
     /// @return true, if the parsing was successful, false if not.
@@ -327,6 +885,58 @@ bool TXmlParser<TNodeType>::parse(IOStream *stream) {
     return false;
 }
 
+template <class TNodeType>
+bool TXmlParser<TNodeType>::parseStreaming(IOStream *stream, const XmlElementHandler &handler) {
+    if (hasRoot()) {
+        clear();
+    }
+
+    if (nullptr == stream) {
+        ASSIMP_LOG_DEBUG("Stream is nullptr.");
+        return false;
+    }
+
+    XmlPullParser parser(stream);
+    if (!parser.isUtf8()) {
+        // leave the other encodings to pugixml
+        stream->Seek(0, aiOrigin_SET);
+        return parse(stream);
+    }
+
+    mDoc = new pugi::xml_document();
+    std::vector<TNodeType> parents(1, mDoc->root());
+    try {
+        for (XmlPullParser::Event event = parser.next(); event != XmlPullParser::EndOfDocument; event = parser.next()) {
+            if (event == XmlPullParser::StartElement) {
+                TNodeType node = parents.back().append_child(parser.getName().c_str());
+                for (const XmlPullParser::Attribute &attribute : parser.getAttributes()) {
+                    node.append_attribute(attribute.first.c_str()).set_value(attribute.second.c_str());
+                }
+                parents.push_back(node);
+                if (handler) {
+                    handler(parser, node);
+                }
+            } else if (event == XmlPullParser::EndElement) {
+                parents.pop_back();
+            } else {
+                parents.back().append_child(parser.isCData() ? pugi::node_cdata : pugi::node_pcdata).set_value(parser.getText().c_str());
+            }
+        }
+    } catch (const DeadlyImportError &e) {
+        ASSIMP_LOG_DEBUG("Error while parse xml. ", e.what());
+        clear();
+        return false;
+    }
+
+    if (mDoc->first_child().empty()) {
+        ASSIMP_LOG_DEBUG("Error while parse xml. No document element.");
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
 template <class TNodeType>
 bool TXmlParser<TNodeType>::parse(std::istream &inStream) {
     if (hasRoot()) {
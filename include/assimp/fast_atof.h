@@ -21,6 +21,7 @@
 #   pragma GCC system_header
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdint.h>
@@ -37,6 +38,18 @@
 #  include <assimp/Compiler/pstdint.h>
 #endif
 
+#include <cstring>
+
+// SSE2 is used to classify digits in fast_atoreal_batch, the digits are
+// accumulated with SWAR arithmetic which relies on little endian byte order.
+#if !defined(ASSIMP_FAST_ATOF_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define AI_FAST_ATOF_SSE2
+#  include <emmintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  endif
+#endif
+
 namespace Assimp {
 
 static constexpr size_t NumItems = 16;
@@ -373,6 +386,175 @@ inline ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+namespace Intern {
+
+// ------------------------------------------------------------------------------------
+// Returns whether c separates two numbers of a batch.
+inline bool IsNumberSeparator(char c, bool cross_lines) {
+    return c == ' ' || c == '\t' || (cross_lines && (c == '\n' || c == '\r' || c == '\f'));
+}
+
+// ------------------------------------------------------------------------------------
+// Returns whether c may end a number of a batch.
+inline bool IsNumberTerminator(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\0';
+}
+
+#ifdef AI_FAST_ATOF_SSE2
+
+// ------------------------------------------------------------------------------------
+// Number of decimal digits at the start of the 16 bytes at p, 16 if all of them are.
+inline unsigned int CountLeadingDigits16(const char* p) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1)));
+    const unsigned int nonDigits = ~static_cast<unsigned int>(_mm_movemask_epi8(isDigit)) | 0x10000u;
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, nonDigits);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(nonDigits));
+#endif
+}
+
+// ------------------------------------------------------------------------------------
+// Value of the 1 to 8 decimal digits at p, 8 bytes at p must be readable.
+inline uint64_t ParseDigits8(const char* p, unsigned int num) {
+    uint64_t value;
+    ::memcpy(&value, p, sizeof(value));
+
+    // move the digits to the top, the bytes in front of them become zeros
+    value <<= 8 * (8 - num);
+    value = ((value & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+    value = ((value & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+    return ((value & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32;
+}
+
+// ------------------------------------------------------------------------------------
+// Value of the 1 to 15 decimal digits at p, 16 bytes at p must be readable.
+inline uint64_t ParseDigits16(const char* p, unsigned int num) {
+    if (num <= 8) {
+        return ParseDigits8(p, num);
+    }
+    static const uint64_t powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    return ParseDigits8(p, 8) * powers[num - 8] + ParseDigits8(p + 8, num - 8);
+}
+
+// ------------------------------------------------------------------------------------
+// Vectorized fast_atoreal_move for the common case of plain decimal numbers with
+// less than 16 integer and fractional digits. Returns nullptr for anything else.
+template<typename Real, typename ExceptionType>
+inline const char* fast_atoreal_simd(const char* c, const char* end, Real& out, bool check_comma) {
+    bool inv = (*c == '-');
+    if (inv || *c == '+') {
+        ++c;
+    }
+    if (end - c < 16) {
+        return nullptr;
+    }
+
+    const unsigned int numInt = CountLeadingDigits16(c);
+    if (numInt == 0 || numInt == 16) {
+        return nullptr;
+    }
+    Real f = static_cast<Real>(ParseDigits16(c, numInt));
+    c += numInt;
+
+    if (*c == '.') {
+        if (end - c < 17) {
+            return nullptr;
+        }
+        const unsigned int numFrac = CountLeadingDigits16(c + 1);
+        if (numFrac == 0 || numFrac == 16) {
+            return nullptr;
+        }
+
+        // same computation as fast_atoreal_move, so the results are identical
+        const unsigned int diff = std::min(numFrac, static_cast<unsigned int>(AI_FAST_ATOF_RELAVANT_DECIMALS));
+        double pl = static_cast<double>(ParseDigits16(c + 1, diff));
+        pl *= fast_atof_table[diff];
+        f += static_cast<Real>(pl);
+        c += 1 + numFrac;
+    } else if (check_comma && *c == ',') {
+        return nullptr;
+    }
+
+    if (*c == 'e' || *c == 'E') {
+        ++c;
+        const bool einv = (*c=='-');
+        if (einv || *c=='+') {
+            ++c;
+        }
+
+        Real exp = static_cast<Real>( strtoul10_64<ExceptionType>(c, &c) );
+        if (einv) {
+            exp = -exp;
+        }
+        f *= std::pow(static_cast<Real>(10.0), exp);
+    }
+
+    if (inv) {
+        f = -f;
+    }
+    out = f;
+    return c;
+}
+
+#endif // AI_FAST_ATOF_SSE2
+
+} // namespace Intern
+
+// ------------------------------------------------------------------------------------
+//! Parses up to count whitespace separated numbers from [c, end) into out.
+//! Leading whitespace is skipped. With cross_lines set to false, only spaces and tabs
+//! separate the numbers and parsing stops at the end of the line.
+//! Parsing also stops at the end of the range and in front of a token which does not
+//! start like a number or which is not followed by whitespace, so the caller can
+//! handle the rest. The text must not end with a number at end, it needs a terminator
+//! such as a 0 or a line end like for fast_atoreal_move().
+//! Plain decimal numbers are parsed with SSE2 where available, the results are
+//! identical to fast_atoreal_move().
+//! @param parsed Receives the number of values written to out.
+//! @return Position behind the last parsed number.
+// ------------------------------------------------------------------------------------
+template<typename Real, typename ExceptionType = DeadlyImportError>
+inline const char* fast_atoreal_batch(const char* c, const char* end, Real* out, size_t count, size_t& parsed,
+        bool cross_lines = true, bool check_comma = true) {
+    parsed = 0;
+    while (parsed < count) {
+        const char* begin = c;
+        while (begin != end && Intern::IsNumberSeparator(*begin, cross_lines)) {
+            ++begin;
+        }
+        if (begin == end) {
+            break;
+        }
+
+        const char first = *begin;
+        if (!((first >= '0' && first <= '9') || first == '-' || first == '+' || first == '.' ||
+                first == 'n' || first == 'N' || first == 'i' || first == 'I')) {
+            break;
+        }
+
+        Real value;
+        const char* next = nullptr;
+#ifdef AI_FAST_ATOF_SSE2
+        next = Intern::fast_atoreal_simd<Real, ExceptionType>(begin, end, value, check_comma);
+#endif
+        if (!next) {
+            next = fast_atoreal_move<Real, ExceptionType>(begin, value, check_comma);
+        }
+        if (next != end && !Intern::IsNumberTerminator(*next)) {
+            break;
+        }
+
+        out[parsed++] = value;
+        c = next;
+    }
+    return c;
+}
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
@@ -965,7 +965,10 @@ public:
 
 #endif
 
-    /** List of all material properties loaded. */
+    /** List of all material properties loaded.
+     *
+     *  The array is owned by the material, use the member functions to add or
+     *  remove properties instead of replacing or freeing it. */
     C_STRUCT aiMaterialProperty **mProperties;
 
     /** Number of properties in the data base */
@@ -616,6 +616,167 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the meaning of an attribute in an #aiVertexBuffer.
+ */
+enum aiVertexAttributeSemantic {
+    /** Vertex position, from #aiMesh::mVertices */
+    aiVertexAttributeSemantic_POSITION = 0x0,
+
+    /** Vertex normal, from #aiMesh::mNormals */
+    aiVertexAttributeSemantic_NORMAL = 0x1,
+
+    /** Vertex tangent, from #aiMesh::mTangents */
+    aiVertexAttributeSemantic_TANGENT = 0x2,
+
+    /** Vertex bitangent, from #aiMesh::mBitangents */
+    aiVertexAttributeSemantic_BITANGENT = 0x3,
+
+    /** Texture coordinate, from #aiMesh::mTextureCoords[mIndex] */
+    aiVertexAttributeSemantic_TEXCOORD = 0x4,
+
+    /** Vertex color, from #aiMesh::mColors[mIndex] */
+    aiVertexAttributeSemantic_COLOR = 0x5,
+
+/** This value is not used. It is just here to force the
+     *  compiler to map this enum to a 32 Bit integer.
+     */
+#ifndef SWIG
+    _aiVertexAttributeSemantic_Force32Bit = INT_MAX
+#endif
+}; //! enum aiVertexAttributeSemantic
+
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the storage type of a single component of an attribute
+ *  in an #aiVertexBuffer.
+ */
+enum aiVertexAttributeType {
+    /** 32 bit float */
+    aiVertexAttributeType_FLOAT = 0x0,
+
+    /** 8 bit unsigned integer, normalized from [0,1] to [0,255] */
+    aiVertexAttributeType_UBYTE_NORM = 0x1,
+
+    /** 16 bit signed integer, normalized from [-1,1] to [-32767,32767] */
+    aiVertexAttributeType_SHORT_NORM = 0x2,
+
+/** This value is not used. It is just here to force the
+     *  compiler to map this enum to a 32 Bit integer.
+     */
+#ifndef SWIG
+    _aiVertexAttributeType_Force32Bit = INT_MAX
+#endif
+}; //! enum aiVertexAttributeType
+
+// ---------------------------------------------------------------------------
+/** @brief Describes a single attribute of the vertices in an #aiVertexBuffer.
+ */
+struct aiVertexAttribute {
+    /** The meaning of the attribute. */
+    enum aiVertexAttributeSemantic mSemantic;
+
+    /** The channel index for texture coordinates and colors, 0 otherwise. */
+    unsigned int mIndex;
+
+    /** The storage type of a single component. */
+    enum aiVertexAttributeType mType;
+
+    /** The number of components, 1 to 4. */
+    unsigned int mNumComponents;
+
+    /** The offset of the attribute from the start of a vertex, in bytes. */
+    unsigned int mOffset;
+
+#ifdef __cplusplus
+    aiVertexAttribute() AI_NO_EXCEPT
+            : mSemantic(aiVertexAttributeSemantic_POSITION),
+              mIndex(0),
+              mType(aiVertexAttributeType_FLOAT),
+              mNumComponents(0),
+              mOffset(0) {
+        // empty
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief An interleaved vertex buffer and a packed index buffer of a mesh.
+ *
+ * It is generated by the InterleaveVertices post processing step, see
+ * #AI_CONFIG_PP_IV_VERTEX_FORMAT, and stores all vertices of the mesh in the
+ * layout described by mAttributes, so the data can be handed to a graphics
+ * API without further conversion. The separate vertex streams of the mesh are
+ * kept untouched.
+ */
+struct aiVertexBuffer {
+    /** The size of a single vertex in bytes. */
+    unsigned int mStride;
+
+    /** The number of attributes in mAttributes. */
+    unsigned int mNumAttributes;
+
+    /** The layout of a single vertex. */
+    C_STRUCT aiVertexAttribute *mAttributes;
+
+    /** The number of vertices, equal to #aiMesh::mNumVertices. */
+    unsigned int mNumVertices;
+
+    /** The vertex data, mNumVertices * mStride bytes. */
+    unsigned char *mData;
+
+    /** The number of indices in mIndices. */
+    unsigned int mNumIndices;
+
+    /** The indices of all faces of the mesh, in the order of #aiMesh::mFaces. */
+    unsigned int *mIndices;
+
+#ifdef __cplusplus
+    //! The default class constructor.
+    aiVertexBuffer() AI_NO_EXCEPT
+            : mStride(0),
+              mNumAttributes(0),
+              mAttributes(nullptr),
+              mNumVertices(0),
+              mData(nullptr),
+              mNumIndices(0),
+              mIndices(nullptr) {
+        // empty
+    }
+
+    //! Copy constructor - copies the contents of the other buffer.
+    aiVertexBuffer(const aiVertexBuffer &other)
+            : mStride(other.mStride),
+              mNumAttributes(other.mNumAttributes),
+              mAttributes(nullptr),
+              mNumVertices(other.mNumVertices),
+              mData(nullptr),
+              mNumIndices(other.mNumIndices),
+              mIndices(nullptr) {
+        if (other.mAttributes) {
+            mAttributes = new aiVertexAttribute[mNumAttributes];
+            ::memcpy(mAttributes, other.mAttributes, mNumAttributes * sizeof(aiVertexAttribute));
+        }
+        if (other.mData) {
+            mData = new unsigned char[static_cast<size_t>(mNumVertices) * mStride];
+            ::memcpy(mData, other.mData, static_cast<size_t>(mNumVertices) * mStride);
+        }
+        if (other.mIndices) {
+            mIndices = new unsigned int[mNumIndices];
+            ::memcpy(mIndices, other.mIndices, mNumIndices * sizeof(unsigned int));
+        }
+    }
+
+    aiVertexBuffer &operator=(const aiVertexBuffer &) = delete;
+
+    //! The class destructor.
+    ~aiVertexBuffer() {
+        delete[] mAttributes;
+        delete[] mData;
+        delete[] mIndices;
+    }
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +987,13 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * Interleaved vertex buffer and packed index buffer of the mesh.
+     * nullptr unless the InterleaveVertices step was run, see
+     * #AI_CONFIG_PP_IV_VERTEX_FORMAT.
+     */
+    C_STRUCT aiVertexBuffer *mVertexBuffer;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +1016,8 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mVertexBuffer(nullptr) {
         // empty
     }
 
@@ -895,6 +1064,7 @@ struct aiMesh {
         }
 
         delete[] mFaces;
+        delete mVertexBuffer;
     }
 
     //! @brief Check whether the mesh contains positions. Provided no special
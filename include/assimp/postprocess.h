@@ -603,6 +603,11 @@ enum aiPostProcessSteps
     /**
      */
     aiProcess_GenBoundingBoxes = 0x80000000
+
+    // -------------------------------------------------------------------------
+    /* All 32 bits are taken, so the InterleaveVertices step has no flag.
+     * It is enabled by setting #AI_CONFIG_PP_IV_VERTEX_FORMAT instead.
+     */
 };
 
 
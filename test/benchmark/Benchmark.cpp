@@ -0,0 +1,689 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+/** @file  Benchmark.cpp
+ *  @brief Times the importers and the post processing steps and writes the results as JSON.
+ *
+ *  Every importer is timed on the files of test/models and on synthetic, scaled-up inputs
+ *  which are generated at startup. Every post processing step is timed on its own on the
+ *  synthetic inputs. If the JSON of a previous run is given as baseline, cases which got
+ *  slower than the tolerance are reported and the program exits with 1, so it can be used
+ *  to catch performance regressions per commit.
+ */
+
+#include <assimp/Importer.hpp>
+#include <assimp/importerdesc.h>
+#include <assimp/Profiler.h>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/istreamwrapper.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+struct Options {
+    std::string modelsDir = ASSIMP_TEST_MODELS_DIR;
+    std::string filter;
+    std::string output;
+    std::string baseline;
+    unsigned int repeat = 3;
+    unsigned int scale = 512;
+    unsigned int flags = 0;
+    double tolerance = 0.1;
+    double minTime = 0.001;
+    bool models = true;
+    bool synthetic = true;
+    bool steps = true;
+};
+
+// ------------------------------------------------------------------------------------------------
+struct Result {
+    std::string name;
+    std::string importer;
+    std::string step;
+    uint64_t bytes = 0;
+    uint64_t vertices = 0;
+    uint64_t faces = 0;
+    double seconds = 0.0;
+    double meanSeconds = 0.0;
+    uint64_t peakMemory = 0;
+    double baselineSeconds = -1.0;
+    std::string error;
+};
+
+// ------------------------------------------------------------------------------------------------
+struct PostProcessStep {
+    unsigned int flag;
+    const char *name;
+};
+
+// All steps which can run on their own. The interleaved vertex buffers have no flag, they are
+// enabled by AI_CONFIG_PP_IV_VERTEX_FORMAT and run by ApplyPostProcessing(0).
+const PostProcessStep Steps[] = {
+    { aiProcess_CalcTangentSpace, "aiProcess_CalcTangentSpace" },
+    { aiProcess_JoinIdenticalVertices, "aiProcess_JoinIdenticalVertices" },
+    { aiProcess_MakeLeftHanded, "aiProcess_MakeLeftHanded" },
+    { aiProcess_Triangulate, "aiProcess_Triangulate" },
+    { aiProcess_GenNormals | aiProcess_ForceGenNormals, "aiProcess_GenNormals" },
+    { aiProcess_GenSmoothNormals | aiProcess_ForceGenNormals, "aiProcess_GenSmoothNormals" },
+    { aiProcess_SplitLargeMeshes, "aiProcess_SplitLargeMeshes" },
+    { aiProcess_PreTransformVertices, "aiProcess_PreTransformVertices" },
+    { aiProcess_LimitBoneWeights, "aiProcess_LimitBoneWeights" },
+    { aiProcess_ValidateDataStructure, "aiProcess_ValidateDataStructure" },
+    { aiProcess_ImproveCacheLocality, "aiProcess_ImproveCacheLocality" },
+    { aiProcess_RemoveRedundantMaterials, "aiProcess_RemoveRedundantMaterials" },
+    { aiProcess_FixInfacingNormals, "aiProcess_FixInfacingNormals" },
+    { aiProcess_SortByPType, "aiProcess_SortByPType" },
+    { aiProcess_FindDegenerates, "aiProcess_FindDegenerates" },
+    { aiProcess_FindInvalidData, "aiProcess_FindInvalidData" },
+    { aiProcess_GenUVCoords, "aiProcess_GenUVCoords" },
+    { aiProcess_TransformUVCoords, "aiProcess_TransformUVCoords" },
+    { aiProcess_FindInstances, "aiProcess_FindInstances" },
+    { aiProcess_OptimizeMeshes, "aiProcess_OptimizeMeshes" },
+    { aiProcess_OptimizeGraph, "aiProcess_OptimizeGraph" },
+    { aiProcess_FlipUVs, "aiProcess_FlipUVs" },
+    { aiProcess_FlipWindingOrder, "aiProcess_FlipWindingOrder" },
+    { aiProcess_SplitByBoneCount, "aiProcess_SplitByBoneCount" },
+    { aiProcess_Debone, "aiProcess_Debone" },
+    { aiProcess_GlobalScale, "aiProcess_GlobalScale" },
+    { aiProcess_DropNormals, "aiProcess_DropNormals" },
+    { aiProcess_GenBoundingBoxes, "aiProcess_GenBoundingBoxes" },
+    { 0, "InterleaveVertices" }
+};
+
+const char *InterleavedFormat = "position:float3 normal:short4n texcoord0:float2";
+
+// ------------------------------------------------------------------------------------------------
+class Timer {
+public:
+    Timer() :
+            mStart(std::chrono::steady_clock::now()) {}
+
+    double Elapsed() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Linux allows to reset the peak resident memory of the process, which makes the peak of a
+// single case measurable. Everywhere else the peak of the whole run so far is reported.
+bool ResetPeakMemory() {
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+        clearRefs.flush();
+        return static_cast<bool>(clearRefs);
+    }
+#endif
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+uint64_t GetPeakMemory() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024u;
+        }
+    }
+#endif
+    return Profiling::Profiler::GetPeakMemory();
+}
+
+// ------------------------------------------------------------------------------------------------
+void CountScene(const aiScene *scene, uint64_t &vertices, uint64_t &faces) {
+    vertices = faces = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        vertices += scene->mMeshes[i]->mNumVertices;
+        faces += scene->mMeshes[i]->mNumFaces;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// The synthetic inputs are a height field of scale x scale vertices.
+aiVector3f GridPosition(unsigned int x, unsigned int y, unsigned int scale) {
+    const float fx = static_cast<float>(x) / static_cast<float>(scale - 1);
+    const float fy = static_cast<float>(y) / static_cast<float>(scale - 1);
+    return aiVector3f(fx, fy, 0.05f * std::sin(fx * 20.0f) * std::cos(fy * 20.0f));
+}
+
+// ------------------------------------------------------------------------------------------------
+aiVector3f GridNormal(unsigned int x, unsigned int y, unsigned int scale) {
+    const float fx = static_cast<float>(x) / static_cast<float>(scale - 1);
+    const float fy = static_cast<float>(y) / static_cast<float>(scale - 1);
+    aiVector3f normal(-std::cos(fx * 20.0f) * std::cos(fy * 20.0f), std::sin(fx * 20.0f) * std::sin(fy * 20.0f), 1.0f);
+    return normal.Normalize();
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void PutLittleEndian(std::vector<char> &buffer, T value) {
+    uint8_t bytes[sizeof(T)];
+    ::memcpy(bytes, &value, sizeof(T));
+    const uint16_t probe = 1;
+    if (*reinterpret_cast<const uint8_t *>(&probe) != 1) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// ------------------------------------------------------------------------------------------------
+bool WriteFile(const fs::path &path, const std::vector<char> &buffer) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Text OBJ with positions, normals, texture coordinates and quads.
+bool WriteGridObj(const fs::path &path, unsigned int scale) {
+    std::vector<char> buffer;
+    char line[256];
+    auto put = [&](int length) {
+        buffer.insert(buffer.end(), line, line + length);
+    };
+    for (unsigned int y = 0; y < scale; ++y) {
+        for (unsigned int x = 0; x < scale; ++x) {
+            const aiVector3f p = GridPosition(x, y, scale), n = GridNormal(x, y, scale);
+            put(::snprintf(line, sizeof(line), "v %f %f %f\nvn %f %f %f\nvt %f %f\n", p.x, p.y, p.z, n.x, n.y, n.z, p.x, p.y));
+        }
+    }
+    for (unsigned int y = 0; y + 1 < scale; ++y) {
+        for (unsigned int x = 0; x + 1 < scale; ++x) {
+            const unsigned int a = y * scale + x + 1, b = a + 1, c = a + scale + 1, d = a + scale;
+            put(::snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c, d, d, d));
+        }
+    }
+    return WriteFile(path, buffer);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Binary STL, every triangle with its own vertices as the format requires.
+bool WriteGridStl(const fs::path &path, unsigned int scale) {
+    const uint32_t numTriangles = 2 * (scale - 1) * (scale - 1);
+    std::vector<char> buffer(80, '\0');
+    buffer.reserve(84 + numTriangles * 50u);
+    PutLittleEndian(buffer, numTriangles);
+    for (unsigned int y = 0; y + 1 < scale; ++y) {
+        for (unsigned int x = 0; x + 1 < scale; ++x) {
+            const aiVector3f quad[4] = {
+                GridPosition(x, y, scale), GridPosition(x + 1, y, scale),
+                GridPosition(x + 1, y + 1, scale), GridPosition(x, y + 1, scale)
+            };
+            static const unsigned int Corners[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+            for (const auto &corners : Corners) {
+                const aiVector3f &a = quad[corners[0]], &b = quad[corners[1]], &c = quad[corners[2]];
+                const aiVector3f normal = ((b - a) ^ (c - a)).Normalize();
+                for (const aiVector3f &v : { normal, a, b, c }) {
+                    PutLittleEndian(buffer, v.x);
+                    PutLittleEndian(buffer, v.y);
+                    PutLittleEndian(buffer, v.z);
+                }
+                PutLittleEndian(buffer, static_cast<uint16_t>(0));
+            }
+        }
+    }
+    return WriteFile(path, buffer);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Binary PLY with positions only and triangles, so the normal generation has work to do.
+bool WriteGridPly(const fs::path &path, unsigned int scale) {
+    const unsigned int numVertices = scale * scale;
+    const unsigned int numFaces = 2 * (scale - 1) * (scale - 1);
+    std::ostringstream header;
+    header << "ply\nformat binary_little_endian 1.0\n"
+           << "element vertex " << numVertices << "\nproperty float x\nproperty float y\nproperty float z\n"
+           << "element face " << numFaces << "\nproperty list uchar int vertex_indices\nend_header\n";
+    const std::string text = header.str();
+    std::vector<char> buffer(text.begin(), text.end());
+    buffer.reserve(buffer.size() + numVertices * 12u + numFaces * 13u);
+    for (unsigned int y = 0; y < scale; ++y) {
+        for (unsigned int x = 0; x < scale; ++x) {
+            const aiVector3f p = GridPosition(x, y, scale);
+            PutLittleEndian(buffer, p.x);
+            PutLittleEndian(buffer, p.y);
+            PutLittleEndian(buffer, p.z);
+        }
+    }
+    for (unsigned int y = 0; y + 1 < scale; ++y) {
+        for (unsigned int x = 0; x + 1 < scale; ++x) {
+            const int32_t a = y * scale + x, b = a + 1, c = a + scale + 1, d = a + scale;
+            const int32_t triangles[2][3] = { { a, b, c }, { a, c, d } };
+            for (const auto &triangle : triangles) {
+                PutLittleEndian(buffer, static_cast<uint8_t>(3));
+                for (const int32_t index : triangle) {
+                    PutLittleEndian(buffer, index);
+                }
+            }
+        }
+    }
+    return WriteFile(path, buffer);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetImporterName(const Importer &importer, const fs::path &path) {
+    const std::string extension = path.extension().string();
+    const size_t index = importer.GetImporterIndex(extension.c_str());
+    const aiImporterDesc *desc = index != static_cast<size_t>(-1) ? importer.GetImporterInfo(index) : nullptr;
+    return desc ? desc->mName : std::string();
+}
+
+// ------------------------------------------------------------------------------------------------
+Result BenchmarkImport(const fs::path &path, const std::string &name, const Options &options) {
+    Result result;
+    result.name = name;
+
+    std::error_code ec;
+    result.bytes = static_cast<uint64_t>(fs::file_size(path, ec));
+
+    double total = 0.0;
+    for (unsigned int i = 0; i < options.repeat; ++i) {
+        Importer importer;
+        if (i == 0) {
+            result.importer = GetImporterName(importer, path);
+        }
+        ResetPeakMemory();
+        const Timer timer;
+        const aiScene *scene = importer.ReadFile(path.string(), options.flags);
+        const double seconds = timer.Elapsed();
+        result.peakMemory = std::max(result.peakMemory, GetPeakMemory());
+        if (nullptr == scene) {
+            result.error = importer.GetErrorString();
+            return result;
+        }
+        CountScene(scene, result.vertices, result.faces);
+        result.seconds = i == 0 ? seconds : std::min(result.seconds, seconds);
+        total += seconds;
+    }
+    result.meanSeconds = total / options.repeat;
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+// The input is imported without post processing for every run, only the step itself is timed.
+Result BenchmarkStep(const fs::path &path, const std::string &name, const PostProcessStep &step, const Options &options) {
+    Result result;
+    result.name = name;
+    result.step = step.name;
+
+    double total = 0.0;
+    for (unsigned int i = 0; i < options.repeat; ++i) {
+        Importer importer;
+        if (0 == step.flag) {
+            importer.SetPropertyString(AI_CONFIG_PP_IV_VERTEX_FORMAT, InterleavedFormat);
+        }
+        const aiScene *scene = importer.ReadFile(path.string(), 0);
+        if (nullptr == scene) {
+            result.error = importer.GetErrorString();
+            return result;
+        }
+        CountScene(scene, result.vertices, result.faces);
+
+        ResetPeakMemory();
+        const Timer timer;
+        scene = importer.ApplyPostProcessing(step.flag);
+        const double seconds = timer.Elapsed();
+        result.peakMemory = std::max(result.peakMemory, GetPeakMemory());
+        if (nullptr == scene) {
+            result.error = importer.GetErrorString();
+            return result;
+        }
+        result.seconds = i == 0 ? seconds : std::min(result.seconds, seconds);
+        total += seconds;
+    }
+    result.meanSeconds = total / options.repeat;
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::vector<fs::path> CollectModels(const Options &options) {
+    std::vector<fs::path> files;
+    const Importer importer;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(options.modelsDir, fs::directory_options::skip_permission_denied, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        const fs::path &path = it->path();
+        const std::string extension = path.extension().string();
+        if (extension.empty() || !importer.IsExtensionSupported(extension)) {
+            continue;
+        }
+        if (!options.filter.empty() && path.generic_string().find(options.filter) == std::string::npos) {
+            continue;
+        }
+        files.push_back(path);
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string Quote(const std::string &text) {
+    std::string out = "\"";
+    for (const char c : text) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                ::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                out += escaped;
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out + "\"";
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string GetKey(const Result &result) {
+    return result.step.empty() ? result.name : result.name + "|" + result.step;
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteResults(std::ostream &out, const char *group, const std::vector<Result> &results) {
+    out << "  " << Quote(group) << ": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        out << (i ? ",\n" : "\n") << "    {\"name\": " << Quote(r.name);
+        if (r.step.empty()) {
+            out << ", \"importer\": " << Quote(r.importer) << ", \"bytes\": " << r.bytes;
+        } else {
+            out << ", \"step\": " << Quote(r.step);
+        }
+        if (!r.error.empty()) {
+            out << ", \"error\": " << Quote(r.error) << "}";
+            continue;
+        }
+        out << ", \"vertices\": " << r.vertices << ", \"faces\": " << r.faces
+            << ", \"seconds\": " << r.seconds << ", \"mean_seconds\": " << r.meanSeconds;
+        if (r.seconds > 0.0) {
+            if (r.step.empty()) {
+                out << ", \"mb_per_s\": " << r.bytes / r.seconds / 1e6;
+            }
+            out << ", \"vertices_per_s\": " << r.vertices / r.seconds;
+        }
+        out << ", \"peak_rss\": " << r.peakMemory;
+        if (r.baselineSeconds > 0.0) {
+            out << ", \"baseline_seconds\": " << r.baselineSeconds << ", \"ratio\": " << r.seconds / r.baselineSeconds;
+        }
+        out << "}";
+    }
+    out << (results.empty() ? "]" : "\n  ]");
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads the seconds of all cases of a previous run, keyed like GetKey().
+bool ReadBaseline(const std::string &path, std::map<std::string, double> &seconds) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    rapidjson::IStreamWrapper stream(file);
+    rapidjson::Document doc;
+    doc.ParseStream(stream);
+    if (doc.HasParseError() || !doc.IsObject()) {
+        return false;
+    }
+    for (const char *group : { "imports", "steps" }) {
+        if (!doc.HasMember(group) || !doc[group].IsArray()) {
+            continue;
+        }
+        for (const rapidjson::Value &entry : doc[group].GetArray()) {
+            if (!entry.IsObject() || !entry.HasMember("name") || !entry["name"].IsString() ||
+                    !entry.HasMember("seconds") || !entry["seconds"].IsNumber()) {
+                continue;
+            }
+            Result key;
+            key.name = entry["name"].GetString();
+            if (entry.HasMember("step") && entry["step"].IsString()) {
+                key.step = entry["step"].GetString();
+            }
+            seconds[GetKey(key)] = entry["seconds"].GetDouble();
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void PrintUsage() {
+    std::cout << "Usage: assimp_benchmark [options]\n"
+              << "  --models <dir>      Directory of the models to import, default: " << ASSIMP_TEST_MODELS_DIR << "\n"
+              << "  --filter <text>     Only import models whose path contains the text\n"
+              << "  --repeat <n>        Number of runs per case, the fastest one is reported, default: 3\n"
+              << "  --scale <n>         Vertices per side of the synthetic inputs, default: 512\n"
+              << "  --flags <n>         Post processing flags for the import of the models, default: 0\n"
+              << "  --no-models         Skip the models\n"
+              << "  --no-synthetic      Skip the synthetic inputs, implies --no-steps\n"
+              << "  --no-steps          Skip the post processing steps\n"
+              << "  --output <file>     Write the JSON to the file instead of stdout\n"
+              << "  --baseline <file>   Compare with the JSON of a previous run, exits with 1 on regressions\n"
+              << "  --tolerance <f>     Allowed slowdown relative to the baseline, default: 0.1\n"
+              << "  --min-time <s>      Ignore cases faster than this in the baseline, default: 0.001\n";
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ParseOptions(int argc, char *argv[], Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        auto next = [&]() {
+            ++i;
+            return value;
+        };
+        if (arg == "--no-models") {
+            options.models = false;
+        } else if (arg == "--no-synthetic") {
+            options.synthetic = false;
+        } else if (arg == "--no-steps") {
+            options.steps = false;
+        } else if (nullptr == value) {
+            return false;
+        } else if (arg == "--models") {
+            options.modelsDir = next();
+        } else if (arg == "--filter") {
+            options.filter = next();
+        } else if (arg == "--output") {
+            options.output = next();
+        } else if (arg == "--baseline") {
+            options.baseline = next();
+        } else if (arg == "--repeat") {
+            options.repeat = std::max(1, std::atoi(next()));
+        } else if (arg == "--scale") {
+            options.scale = std::max(2, std::atoi(next()));
+        } else if (arg == "--flags") {
+            options.flags = static_cast<unsigned int>(std::strtoul(next(), nullptr, 0));
+        } else if (arg == "--tolerance") {
+            options.tolerance = std::atof(next());
+        } else if (arg == "--min-time") {
+            options.minTime = std::atof(next());
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // Namespace
+
+// ------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::map<std::string, double> baseline;
+    if (!options.baseline.empty() && !ReadBaseline(options.baseline, baseline)) {
+        std::cerr << "Unable to read the baseline " << options.baseline << std::endl;
+        return 2;
+    }
+
+    std::vector<Result> imports, steps;
+    if (options.models) {
+        const fs::path root(options.modelsDir);
+        for (const fs::path &path : CollectModels(options)) {
+            const std::string name = path.lexically_relative(root).generic_string();
+            std::cerr << "import " << name << std::endl;
+            imports.push_back(BenchmarkImport(path, name, options));
+        }
+    }
+
+    if (options.synthetic) {
+        std::error_code ec;
+        const fs::path dir = fs::temp_directory_path(ec) / "assimp_benchmark";
+        fs::create_directories(dir, ec);
+        const std::string suffix = "grid_" + std::to_string(options.scale);
+        const std::pair<std::string, bool (*)(const fs::path &, unsigned int)> generators[] = {
+            { suffix + ".obj", WriteGridObj },
+            { suffix + ".stl", WriteGridStl },
+            { suffix + ".ply", WriteGridPly }
+        };
+        for (const auto &generator : generators) {
+            const fs::path path = dir / generator.first;
+            const std::string name = "synthetic/" + generator.first;
+            if (!generator.second(path, options.scale)) {
+                std::cerr << "Unable to write " << path.string() << std::endl;
+                return 2;
+            }
+            std::cerr << "import " << name << std::endl;
+            imports.push_back(BenchmarkImport(path, name, options));
+            if (!options.steps) {
+                continue;
+            }
+            for (const PostProcessStep &step : Steps) {
+                std::cerr << "step " << step.name << " on " << name << std::endl;
+                steps.push_back(BenchmarkStep(path, name, step, options));
+            }
+        }
+        fs::remove_all(dir, ec);
+    }
+
+    std::vector<std::string> regressions;
+    for (std::vector<Result> *results : { &imports, &steps }) {
+        for (Result &result : *results) {
+            const auto it = baseline.find(GetKey(result));
+            if (it == baseline.end() || !result.error.empty()) {
+                continue;
+            }
+            result.baselineSeconds = it->second;
+            if (it->second >= options.minTime && result.seconds > it->second * (1.0 + options.tolerance)) {
+                regressions.push_back(GetKey(result));
+                std::cerr << "regression " << GetKey(result) << ": " << it->second << " s -> " << result.seconds << " s" << std::endl;
+            }
+        }
+    }
+
+    std::ofstream file;
+    if (!options.output.empty()) {
+        file.open(options.output);
+        if (!file) {
+            std::cerr << "Unable to write " << options.output << std::endl;
+            return 2;
+        }
+    }
+    std::ostream &out = options.output.empty() ? std::cout : file;
+    out << std::setprecision(9);
+
+    std::ostringstream version;
+    version << aiGetVersionMajor() << "." << aiGetVersionMinor() << "." << aiGetVersionPatch();
+    std::ostringstream revision;
+    revision << std::hex << aiGetVersionRevision();
+
+    out << "{\n  \"version\": " << Quote(version.str()) << ",\n  \"revision\": " << Quote(revision.str())
+        << ",\n  \"repeat\": " << options.repeat << ",\n  \"scale\": " << options.scale << ",\n  \"flags\": " << options.flags
+        << ",\n  \"peak_rss_per_case\": " << (ResetPeakMemory() ? "true" : "false") << ",\n";
+    WriteResults(out, "imports", imports);
+    out << ",\n";
+    WriteResults(out, "steps", steps);
+    out << ",\n  \"regressions\": [";
+    for (size_t i = 0; i < regressions.size(); ++i) {
+        out << (i ? ", " : "") << Quote(regressions[i]);
+    }
+    out << "]\n}\n";
+
+    return regressions.empty() ? 0 : 1;
+}
@@ -0,0 +1,311 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "Common/TextStreamWriter.h"
+
+#include <assimp/BlobIOSystem.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/Exceptional.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/scene.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <locale>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+// Collects everything written in a string, or fails every write
+class StringIOStream : public IOStream {
+public:
+    explicit StringIOStream(bool fail = false) :
+            mFail(fail), mWrites(0) {}
+
+    size_t Read(void *, size_t, size_t) override { return 0; }
+    size_t Write(const void *buffer, size_t size, size_t count) override {
+        if (mFail) {
+            return 0;
+        }
+        ++mWrites;
+        mData.append(static_cast<const char *>(buffer), size * count);
+        return count;
+    }
+    aiReturn Seek(size_t, aiOrigin) override { return AI_FAILURE; }
+    size_t Tell() const override { return mData.size(); }
+    size_t FileSize() const override { return mData.size(); }
+    void Flush() override {}
+
+    bool mFail;
+    size_t mWrites;
+    std::string mData;
+};
+
+// Hands out StringIOStreams and records which files were deleted
+class RecordingIOSystem : public DefaultIOSystem {
+public:
+    explicit RecordingIOSystem(bool fail = false) :
+            mFail(fail) {}
+
+    bool Exists(const char *) const override { return false; }
+    char getOsSeparator() const override { return '/'; }
+    IOStream *Open(const char *pFile, const char *) override {
+        mOpened.emplace_back(pFile);
+        return new StringIOStream(mFail);
+    }
+    void Close(IOStream *pFile) override { delete pFile; }
+    bool DeleteFile(const std::string &file) override {
+        mDeleted.push_back(file);
+        return true;
+    }
+
+    bool mFail;
+    std::vector<std::string> mOpened;
+    std::vector<std::string> mDeleted;
+};
+
+// Hands out failing StringIOStreams and keeps the default DeleteFile
+class FailingIOSystem : public IOSystem {
+public:
+    bool Exists(const char *) const override { return false; }
+    char getOsSeparator() const override { return '/'; }
+    IOStream *Open(const char *, const char *) override { return new StringIOStream(true); }
+    void Close(IOStream *pFile) override { delete pFile; }
+};
+
+} // namespace
+
+class utTextStreamWriter : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utTextStreamWriter, formatsLikeClassicLocaleStreamTest) {
+    const double doubles[] = { 0.0, -0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 1e-7, 123456789.0, 1e21, -2.5e-300,
+        std::numeric_limits<double>::max(), std::numeric_limits<double>::infinity() };
+    const float floats[] = { 0.0f, 0.1f, -0.75f, 1.0f / 3.0f, 3.4e38f, 1e-30f, 16777216.0f };
+    const int precisions[] = { 0, 1, 6, 9, 17 };
+
+    for (bool fixed : { false, true }) {
+        for (int precision : precisions) {
+            std::ostringstream expected;
+            expected.imbue(std::locale::classic());
+            expected.precision(precision);
+            if (fixed) {
+                expected.setf(std::ios::fixed);
+            }
+
+            StringIOStream stream;
+            {
+                TextStreamWriter writer(&stream);
+                writer.SetPrecision(precision);
+                writer.SetFixed(fixed);
+                for (double d : doubles) {
+                    expected << d << ' ';
+                    writer << d << ' ';
+                }
+                for (float f : floats) {
+                    expected << f << ' ';
+                    writer << f << ' ';
+                }
+                writer.Flush();
+            }
+            EXPECT_EQ(expected.str(), stream.mData) << "precision " << precision << (fixed ? " fixed" : "");
+        }
+    }
+}
+
+TEST_F(utTextStreamWriter, formatsIntegersAndStringsTest) {
+    StringIOStream stream;
+    TextStreamWriter writer(&stream);
+    writer << "int " << -42 << ' ' << 7u << ' ' << std::numeric_limits<int64_t>::min() << ' '
+           << std::numeric_limits<uint64_t>::max() << ' ' << static_cast<short>(-3) << ' ' << std::string("end");
+    const std::string expected("int -42 7 -9223372036854775808 18446744073709551615 -3 end");
+    EXPECT_EQ(expected.size(), writer.Tell());
+    writer.Flush();
+    EXPECT_EQ(expected, stream.mData);
+}
+
+TEST_F(utTextStreamWriter, streamsLargeOutputTest) {
+    StringIOStream stream;
+    std::ostringstream expected;
+    {
+        TextStreamWriter writer(&stream, 1024);
+        const std::string block(3000, 'x');
+        for (unsigned int i = 0; i < 10000; ++i) {
+            writer << i << '\n';
+            expected << i << '\n';
+            if (i % 1000 == 0) {
+                writer << block;
+                expected << block;
+            }
+        }
+        // the output went to the stream in pieces while it was written
+        EXPECT_LT(1u, stream.mWrites);
+    }
+    EXPECT_EQ(expected.str(), stream.mData);
+}
+
+TEST_F(utTextStreamWriter, failingStreamThrowsTest) {
+    StringIOStream stream(true);
+    TextStreamWriter writer(&stream);
+    writer << "some data";
+    EXPECT_THROW(writer.Flush(), DeadlyExportError);
+}
+
+TEST_F(utTextStreamWriter, outputFileIsDeletedUnlessCommittedTest) {
+    RecordingIOSystem io;
+    {
+        ExportOutputFile file(&io, "kept.txt", "wt");
+        ASSERT_NE(nullptr, file.Get());
+        file.Commit();
+    }
+    {
+        ExportOutputFile file(&io, "failed.txt", "wt");
+        ASSERT_NE(nullptr, file.Get());
+    }
+    ASSERT_EQ(1u, io.mDeleted.size());
+    EXPECT_EQ("failed.txt", io.mDeleted[0]);
+}
+
+TEST_F(utTextStreamWriter, blobOutputFileIsDroppedUnlessCommittedTest) {
+    BlobIOSystem io("kept.txt");
+    {
+        ExportOutputFile file(&io, "kept.txt", "wt");
+        ASSERT_NE(nullptr, file.Get());
+        file.Get()->Write("kept", 1, 4);
+        file.Commit();
+    }
+    {
+        ExportOutputFile file(&io, "failed.txt", "wt");
+        ASSERT_NE(nullptr, file.Get());
+        file.Get()->Write("failed", 1, 6);
+    }
+    EXPECT_TRUE(io.Exists("kept.txt"));
+    EXPECT_FALSE(io.Exists("failed.txt"));
+
+    std::unique_ptr<aiExportDataBlob> blob(io.GetBlobChain());
+    ASSERT_NE(nullptr, blob);
+    EXPECT_EQ(4u, blob->size);
+    EXPECT_EQ(nullptr, blob->next);
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utTextStreamWriter, failedExportRemovesOutputTest) {
+    aiScene scene;
+    scene.mRootNode = new aiNode("root");
+    scene.mNumMaterials = 1;
+    scene.mMaterials = new aiMaterial *[1]{ new aiMaterial() };
+    scene.mNumMeshes = 1;
+    scene.mMeshes = new aiMesh *[1]{ new aiMesh() };
+    aiMesh *mesh = scene.mMeshes[0];
+    mesh->mNumVertices = 3;
+    mesh->mVertices = new aiVector3D[3]{ aiVector3D(0, 0, 0), aiVector3D(1, 0, 0), aiVector3D(0, 1, 0) };
+    mesh->mNumFaces = 1;
+    mesh->mFaces = new aiFace[1];
+    mesh->mFaces[0].mNumIndices = 3;
+    mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    scene.mRootNode->mNumMeshes = 1;
+    scene.mRootNode->mMeshes = new unsigned int[1]{ 0 };
+
+    // the OBJ exporter writes the geometry and the material library, both go away again
+    Exporter exporter;
+    RecordingIOSystem *io = new RecordingIOSystem(true);
+    exporter.SetIOHandler(io);
+    EXPECT_EQ(AI_FAILURE, exporter.Export(&scene, "obj", "failed.obj"));
+    ASSERT_EQ(2u, io->mDeleted.size());
+    EXPECT_EQ("failed.mtl", io->mDeleted[0]);
+    EXPECT_EQ("failed.obj", io->mDeleted[1]);
+
+    io->mFail = false;
+    io->mDeleted.clear();
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(&scene, "obj", "kept.obj"));
+    EXPECT_TRUE(io->mDeleted.empty());
+}
+
+TEST_F(utTextStreamWriter, failedExportKeepsHostFileOfCustomIOSystemTest) {
+    aiScene scene;
+    scene.mRootNode = new aiNode("root");
+    scene.mNumMaterials = 1;
+    scene.mMaterials = new aiMaterial *[1]{ new aiMaterial() };
+    scene.mNumMeshes = 1;
+    scene.mMeshes = new aiMesh *[1]{ new aiMesh() };
+    aiMesh *mesh = scene.mMeshes[0];
+    mesh->mNumVertices = 3;
+    mesh->mVertices = new aiVector3D[3]{ aiVector3D(0, 0, 0), aiVector3D(1, 0, 0), aiVector3D(0, 1, 0) };
+    mesh->mNumFaces = 1;
+    mesh->mFaces = new aiFace[1];
+    mesh->mFaces[0].mNumIndices = 3;
+    mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    scene.mRootNode->mNumMeshes = 1;
+    scene.mRootNode->mMeshes = new unsigned int[1]{ 0 };
+
+    // a host file with the name of the output, which the custom IOSystem does not own
+    const std::string file = (std::filesystem::temp_directory_path() / "assimp_custom_io_export.obj").string();
+    {
+        std::ofstream host(file, std::ios::binary | std::ios::trunc);
+        host << "host";
+    }
+
+    Exporter exporter;
+    exporter.SetIOHandler(new FailingIOSystem());
+    EXPECT_EQ(AI_FAILURE, exporter.Export(&scene, "obj", file.c_str()));
+
+    std::ifstream host(file, std::ios::binary);
+    ASSERT_TRUE(host.is_open());
+    std::string content;
+    host >> content;
+    EXPECT_EQ("host", content);
+    host.close();
+    std::remove(file.c_str());
+}
+#endif
@@ -0,0 +1,146 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+
+#include "UnitTestPCH.h"
+
+#include "Common/ThreadPool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+using namespace Assimp;
+
+class utThreadPool : public ::testing::Test {
+    // empty
+};
+
+TEST_F(utThreadPool, parallelForVisitsEachIndexOnceTest) {
+    ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.GetNumThreads());
+
+    std::vector<std::atomic<int>> visited(1000);
+    for (auto &v : visited) {
+        v = 0;
+    }
+    pool.ParallelFor(visited.size(), [&](size_t i) {
+        ++visited[i];
+    });
+    for (auto &v : visited) {
+        EXPECT_EQ(1, v);
+    }
+
+    // the pool must be reusable
+    std::atomic<size_t> sum(0);
+    pool.ParallelFor(100, [&](size_t i) {
+        sum += i;
+    });
+    EXPECT_EQ(4950u, sum);
+}
+
+TEST_F(utThreadPool, parallelForRethrowsTest) {
+    ThreadPool pool(3);
+    bool caught = false;
+    try {
+        pool.ParallelFor(64, [](size_t i) {
+            if (i == 17) {
+                throw std::runtime_error("failure");
+            }
+        });
+    } catch (const std::runtime_error &) {
+        caught = true;
+    }
+    EXPECT_TRUE(caught);
+
+    std::atomic<size_t> count(0);
+    pool.ParallelFor(64, [&](size_t) {
+        ++count;
+    });
+    EXPECT_EQ(64u, count);
+}
+
+TEST_F(utThreadPool, nestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<size_t> count(0);
+    pool.ParallelFor(8, [&](size_t) {
+        pool.ParallelFor(8, [&](size_t) {
+            ++count;
+        });
+    });
+    EXPECT_EQ(64u, count);
+}
+
+TEST_F(utThreadPool, parallelPostProcessingMatchesSerialTest) {
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace |
+                               aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality;
+
+    Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+
+    Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_PP_THREAD_COUNT, 4);
+    const aiScene *actual = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, actual);
+
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        const aiMesh *a = expected->mMeshes[i], *b = actual->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, a->mNumVertices * sizeof(aiVector3D)));
+        EXPECT_EQ(0, memcmp(a->mNormals, b->mNormals, a->mNumVertices * sizeof(aiVector3D)));
+        ASSERT_EQ(a->HasTangentsAndBitangents(), b->HasTangentsAndBitangents());
+        if (a->HasTangentsAndBitangents()) {
+            EXPECT_EQ(0, memcmp(a->mTangents, b->mTangents, a->mNumVertices * sizeof(aiVector3D)));
+        }
+        for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+            ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            EXPECT_EQ(0, memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, a->mFaces[f].mNumIndices * sizeof(unsigned int)));
+        }
+    }
+}
@@ -40,6 +40,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/XmlParser.h>
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
+
+#include <sstream>
 
 using namespace Assimp;
 
@@ -84,3 +87,94 @@ TEST_F(utXmlParser, parse_xml_and_traverse_test) {
         EXPECT_FALSE(nodeName.empty());
     }
 }
+
+TEST_F(utXmlParser, parse_streaming_xml_test) {
+    static const char xml[] =
+            "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+            "<!DOCTYPE root [ <!ELEMENT root ANY> ]>\n"
+            "<root a=\"1 &amp; 2\" b='&lt;x&gt;'>\n"
+            "  <!-- a comment -->\n"
+            "  <empty/>\n"
+            "  <text>Hello &#x41;&#66; world</text>\n"
+            "  <cdata><![CDATA[<not> a tag]]></cdata>\n"
+            "  <values count=\"4\">1 2.5 -3 4</values>\n"
+            "</root>\n";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlParser parser;
+    std::vector<float> values;
+    const XmlElementHandler handler = [&values](XmlPullParser &pullParser, XmlNode &) {
+        if (pullParser.getName() != "values") {
+            return;
+        }
+        const char *begin = nullptr, *end = nullptr;
+        while (pullParser.readTextBlock(begin, end)) {
+            std::string block(begin, end);
+            std::istringstream in(block);
+            for (float value; in >> value;) {
+                values.push_back(value);
+            }
+        }
+    };
+    ASSERT_TRUE(parser.parseStreaming(&stream, handler));
+
+    XmlNode root = parser.getRootNode().child("root");
+    ASSERT_FALSE(root.empty());
+    EXPECT_STREQ("1 & 2", root.attribute("a").as_string());
+    EXPECT_STREQ("<x>", root.attribute("b").as_string());
+    EXPECT_FALSE(root.child("empty").empty());
+    EXPECT_STREQ("Hello AB world", root.child("text").text().as_string());
+    EXPECT_STREQ("<not> a tag", root.child("cdata").text().as_string());
+    EXPECT_EQ(4U, root.child("values").attribute("count").as_uint());
+    EXPECT_STREQ("", root.child("values").text().as_string());
+    ASSERT_EQ(4U, values.size());
+    EXPECT_FLOAT_EQ(-3.0f, values[2]);
+}
+
+TEST_F(utXmlParser, parse_streaming_xml_small_blocks_test) {
+    std::string xml = "<root><values>";
+    for (int i = 0; i < 1000; ++i) {
+        xml += std::to_string(i * 1001) + " ";
+    }
+    xml += "</values></root>";
+
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml.c_str()), xml.size());
+    XmlPullParser parser(&stream, 16);
+    std::vector<int> values;
+    for (XmlPullParser::Event event = parser.next(); event != XmlPullParser::EndOfDocument; event = parser.next()) {
+        if (event != XmlPullParser::StartElement || parser.getName() != "values") {
+            continue;
+        }
+        const char *begin = nullptr, *end = nullptr;
+        while (parser.readTextBlock(begin, end)) {
+            // blocks never split a number
+            std::istringstream in(std::string(begin, end));
+            for (int value; in >> value;) {
+                values.push_back(value);
+            }
+        }
+    }
+    ASSERT_EQ(1000U, values.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i * 1001, values[i]);
+    }
+}
+
+TEST_F(utXmlParser, parse_streaming_latin1_xml_test) {
+    // the pull parser only reads utf-8, other encodings go through pugixml
+    static const char xml[] = "<?xml version='1.0' encoding='ISO-8859-1'?><root name=\"Caf\xe9\"/>";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlPullParser pullParser(&stream);
+    EXPECT_FALSE(pullParser.isUtf8());
+
+    stream.Seek(0, aiOrigin_SET);
+    XmlParser parser;
+    ASSERT_TRUE(parser.parseStreaming(&stream, XmlElementHandler()));
+    EXPECT_STREQ("Caf\xc3\xa9", parser.getRootNode().child("root").attribute("name").as_string());
+}
+
+TEST_F(utXmlParser, parse_streaming_malformed_xml_test) {
+    static const char xml[] = "<root><a></b></root>";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlParser parser;
+    EXPECT_FALSE(parser.parseStreaming(&stream, XmlElementHandler()));
+}
@@ -42,11 +42,83 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/Exporter.hpp>
 #include <assimp/ProgressHandler.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace Assimp;
 
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
+namespace {
+
+// The parts of the last scene passed to CaptureScene()
+struct CapturedScene {
+    const aiScene *scene = nullptr;
+    std::vector<const aiMesh *> meshes;
+    std::vector<const aiMaterial *> materials;
+    std::vector<unsigned int> numFaces;
+} gCaptured;
+
+void CaptureScene(const char *, IOSystem *, const aiScene *pScene, const ExportProperties *) {
+    gCaptured = CapturedScene();
+    gCaptured.scene = pScene;
+    for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
+        gCaptured.meshes.push_back(pScene->mMeshes[i]);
+        gCaptured.numFaces.push_back(pScene->mMeshes[i]->mNumFaces);
+    }
+    for (unsigned int i = 0; i < pScene->mNumMaterials; ++i) {
+        gCaptured.materials.push_back(pScene->mMaterials[i]);
+    }
+}
+
+// A triangle and a quad with texture coordinates, both referenced by the root node
+aiScene *CreateTriangleAndQuadScene() {
+    aiScene *scene = new aiScene();
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1];
+    scene->mMaterials[0] = new aiMaterial();
+
+    scene->mNumMeshes = 2;
+    scene->mMeshes = new aiMesh *[2];
+    for (unsigned int m = 0; m < 2; ++m) {
+        aiMesh *mesh = scene->mMeshes[m] = new aiMesh();
+        mesh->mNumVertices = 3 + m;
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+        mesh->mNumUVComponents[0] = 2;
+        mesh->mNumFaces = 1;
+        mesh->mFaces = new aiFace[1];
+        mesh->mFaces[0].mNumIndices = mesh->mNumVertices;
+        mesh->mFaces[0].mIndices = new unsigned int[mesh->mNumVertices];
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            mesh->mVertices[i] = aiVector3D(static_cast<ai_real>(i & 1), static_cast<ai_real>(i >> 1), 0);
+            mesh->mTextureCoords[0][i] = mesh->mVertices[i];
+            mesh->mFaces[0].mIndices[i] = i;
+        }
+        mesh->mPrimitiveTypes = m ? aiPrimitiveType_POLYGON : aiPrimitiveType_TRIANGLE;
+    }
+
+    scene->mRootNode = new aiNode("root");
+    scene->mRootNode->mNumMeshes = 2;
+    scene->mRootNode->mMeshes = new unsigned int[2]{ 0, 1 };
+    return scene;
+}
+
+// The contents of all blobs of an export
+std::vector<std::string> GetBlobContents(const aiExportDataBlob *blob) {
+    std::vector<std::string> contents;
+    for (; blob != nullptr; blob = blob->next) {
+        contents.emplace_back(static_cast<const char *>(blob->data), blob->size);
+    }
+    return contents;
+}
+
+} // namespace
+
 class TestProgressHandler : public ProgressHandler {
 public:
     TestProgressHandler() :
@@ -102,4 +174,81 @@ TEST_F(ExporterTest, ExporterIdTest) {
     EXPECT_EQ(nullptr, desc) << "More exporters than claimed";
 }
 
+TEST_F(ExporterTest, exportWithoutStepsUsesSceneDirectly) {
+    Exporter exporter;
+    exporter.RegisterExporter(Exporter::ExportFormatEntry("capture", "Capture", "capture", &CaptureScene, 0));
+    std::unique_ptr<aiScene> scene(CreateTriangleAndQuadScene());
+
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(scene.get(), "capture", "unittest_output.capture"));
+    EXPECT_EQ(scene.get(), gCaptured.scene);
+}
+
+TEST_F(ExporterTest, exportCopiesOnlyModifiedParts) {
+    Exporter exporter;
+    exporter.RegisterExporter(Exporter::ExportFormatEntry("capture", "Capture", "capture", &CaptureScene, 0));
+    std::unique_ptr<aiScene> scene(CreateTriangleAndQuadScene());
+
+    // only the quad is changed by the triangulation
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(scene.get(), "capture", "unittest_output.capture", aiProcess_Triangulate));
+    ASSERT_NE(scene.get(), gCaptured.scene);
+    ASSERT_EQ(2u, gCaptured.meshes.size());
+    EXPECT_EQ(scene->mMeshes[0], gCaptured.meshes[0]);
+    EXPECT_NE(scene->mMeshes[1], gCaptured.meshes[1]);
+    EXPECT_EQ(2u, gCaptured.numFaces[1]);
+    EXPECT_EQ(scene->mMaterials[0], gCaptured.materials[0]);
+
+    // the scene of the caller is unchanged
+    EXPECT_EQ(1u, scene->mMeshes[1]->mNumFaces);
+    EXPECT_EQ(4u, scene->mMeshes[1]->mFaces[0].mNumIndices);
+
+    // flipping the texture coordinates changes all meshes and the materials
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(scene.get(), "capture", "unittest_output.capture", aiProcess_FlipUVs));
+    EXPECT_NE(scene->mMeshes[0], gCaptured.meshes[0]);
+    EXPECT_NE(scene->mMeshes[1], gCaptured.meshes[1]);
+    EXPECT_NE(scene->mMaterials[0], gCaptured.materials[0]);
+    EXPECT_EQ(0.0f, scene->mMeshes[0]->mTextureCoords[0][0].y);
+}
+
+TEST_F(ExporterTest, exportSameSceneTwiceGivesSameResult) {
+    // the scene of the caller reaches the exporters as it is, converting
+    // it must not leave any changes behind for the next export
+    Exporter exporter;
+    std::unique_ptr<aiScene> scene(CreateTriangleAndQuadScene());
+    for (const char *format : { "gltf", "glb", "gltf2", "glb2", "obj", "ply", "stl" }) {
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene.get(), format);
+        if (nullptr == blob) {
+            continue;
+        }
+        const std::vector<std::string> first = GetBlobContents(blob);
+        const std::vector<std::string> second = GetBlobContents(exporter.ExportToBlob(scene.get(), format));
+        EXPECT_EQ(first, second) << format;
+    }
+}
+
+TEST_F(ExporterTest, exportersLeaveSceneUnchanged) {
+    Exporter exporter;
+    std::unique_ptr<aiScene> scene(CreateTriangleAndQuadScene());
+    std::unique_ptr<aiScene> reference(CreateTriangleAndQuadScene());
+    for (size_t i = 0; i < exporter.GetExportFormatCount(); ++i) {
+        const char *format = exporter.GetExportFormatDescription(i)->id;
+        // pbrt derives its own output file name and 3mf writes its archive
+        // past the IOSystem, so neither can export to a blob
+        if (std::string(format) == "pbrt" || std::string(format) == "3mf") {
+            continue;
+        }
+        exporter.ExportToBlob(scene.get(), format);
+
+        ASSERT_EQ(reference->mNumMeshes, scene->mNumMeshes) << format;
+        for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+            const aiMesh *mesh = scene->mMeshes[m], *expected = reference->mMeshes[m];
+            ASSERT_EQ(expected->mNumVertices, mesh->mNumVertices) << format;
+            ASSERT_EQ(expected->mNumFaces, mesh->mNumFaces) << format;
+            for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+                EXPECT_EQ(expected->mVertices[v], mesh->mVertices[v]) << format;
+                EXPECT_EQ(expected->mTextureCoords[0][v], mesh->mTextureCoords[0][v]) << format;
+            }
+        }
+    }
+}
+
 #endif
@@ -357,6 +357,17 @@ TEST_F(utColladaImportExport, exporterUniqueIdsTest) {
     ImportAsNames(outFileNamed, scene);
 }
 
+TEST_F(utColladaImportExport, importLatin1EncodedTest) {
+    // the node names are encoded in ISO-8859-1 and must arrive as utf-8
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_COLLADA_USE_COLLADA_NAMES, 1);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/Collada/cube_ISO8859-1.dae", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_NE(nullptr, scene->mRootNode);
+    EXPECT_NE(nullptr, scene->mRootNode->FindNode("Bo\xc3\xae" "te"));
+    EXPECT_NE(nullptr, scene->mRootNode->FindNode("Lumi\xc3\xa8re"));
+}
+
 // This file is invalid, we just want to ensure that the importer is not crashing
 // This was reported as GH#4286. The "count" parameter in "Cube-mesh-positions-array" is too small.
 TEST_F(utColladaImportExport, parseInvalid4286) {
@@ -43,10 +43,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/commonMetaData.h>
+#include <assimp/config.h>
 #include <assimp/material.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/types.h>
+#include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
 using namespace Assimp;
@@ -461,3 +463,74 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+TEST_F(utFBXImporterExporter, importWithParallelInflate) {
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_FBX_INFLATE_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallel);
+
+    ASSERT_EQ(serial->mNumMeshes, parallel->mNumMeshes);
+    for (unsigned int i = 0; i < serial->mNumMeshes; ++i) {
+        const aiMesh *a = serial->mMeshes[i], *b = parallel->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+        }
+    }
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+TEST_F(utFBXImporterExporter, exportWithCompressedArrays) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "fbx");
+    ASSERT_NE(nullptr, blob);
+    const size_t uncompressedSize = blob->size;
+    Assimp::Importer uncompressedImporter;
+    const aiScene *uncompressed = uncompressedImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, uncompressed);
+
+    Assimp::ExportProperties properties;
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_COMPRESSION_THRESHOLD, 128);
+    blob = exporter.ExportToBlob(scene, "fbx", 0, &properties);
+    ASSERT_NE(nullptr, blob);
+    const size_t serialSize = blob->size;
+
+    // the geometry arrays deflated together through the pool compress the same
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_FBX_DEFLATE_THREADS, 4);
+    blob = exporter.ExportToBlob(scene, "fbx", 0, &properties);
+    ASSERT_NE(nullptr, blob);
+    EXPECT_LT(blob->size, uncompressedSize);
+    EXPECT_EQ(serialSize, blob->size);
+    Assimp::Importer compressedImporter;
+    const aiScene *compressed = compressedImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "fbx");
+    ASSERT_NE(nullptr, compressed);
+
+    ASSERT_EQ(uncompressed->mNumMeshes, compressed->mNumMeshes);
+    for (unsigned int i = 0; i < uncompressed->mNumMeshes; ++i) {
+        const aiMesh *a = uncompressed->mMeshes[i], *b = compressed->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ASSERT_EQ(a->HasNormals(), b->HasNormals());
+        ASSERT_EQ(a->HasTextureCoords(0), b->HasTextureCoords(0));
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            if (a->HasNormals()) {
+                EXPECT_EQ(a->mNormals[v], b->mNormals[v]);
+            }
+            if (a->HasTextureCoords(0)) {
+                EXPECT_EQ(a->mTextureCoords[0][v], b->mTextureCoords[0][v]);
+            }
+        }
+    }
+}
+#endif // ASSIMP_BUILD_NO_EXPORT
@@ -41,6 +41,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
 
 namespace {
 
@@ -187,3 +188,49 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+TEST_F(FastAtofTest, FastAtorealBatchMatchesScalar)
+{
+    const std::string text = "0 1.354 1054E-3 -1054E-3 -10.54E30\t-345554.54e-5 549067 006 .125 -.1e+9\n"
+            "12.345678901234567890 123456789012345678 3.14159265358979323846e-2 1. +7 nan -Inf 1,5 "
+            "0.000001e-301 56733.68 -0 7.54979e-8";
+
+    std::vector<double> expected;
+    const char *c = text.c_str();
+    const char *end = c + text.size();
+    while (*c) {
+        double value = 0.0;
+        c = Assimp::fast_atoreal_move(c, value);
+        expected.push_back(value);
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+    }
+
+    std::vector<double> values(expected.size() + 1);
+    size_t parsed = 0;
+    const char *next = Assimp::fast_atoreal_batch(text.c_str(), end, values.data(), values.size(), parsed);
+    ASSERT_EQ(expected.size(), parsed);
+    EXPECT_EQ(end, next);
+    for (size_t i = 0; i < parsed; ++i) {
+        if (IsNan(expected[i])) {
+            EXPECT_TRUE(IsNan(values[i]));
+        } else {
+            EXPECT_EQ(0, memcmp(&expected[i], &values[i], sizeof(double))) << "value " << i;
+        }
+    }
+}
+
+TEST_F(FastAtofTest, FastAtorealBatchStopsAtLineAndToken)
+{
+    const char *text = "1.5 2.5\n3.5";
+    float values[3] = {};
+    size_t parsed = 0;
+    const char *next = Assimp::fast_atoreal_batch(text, text + strlen(text), values, 3, parsed, false);
+    EXPECT_EQ(2u, parsed);
+    EXPECT_EQ('\n', *next);
+    EXPECT_EQ(2.5f, values[1]);
+
+    const char *bad = "1.5 2.5x 3";
+    next = Assimp::fast_atoreal_batch(bad, bad + strlen(bad), values, 3, parsed);
+    EXPECT_EQ(1u, parsed);
+    EXPECT_EQ(bad + 3, next);
+}
@@ -0,0 +1,120 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/FindInstancesProcess.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+
+#include <memory>
+
+using namespace Assimp;
+
+class FindInstancesProcessTest : public ::testing::Test {
+protected:
+    static constexpr unsigned int NumUnique = 200;
+    static constexpr unsigned int NumMeshes = 3 * NumUnique;
+
+    void SetUp() override {
+        // mesh i is an instance of mesh i % NumUnique, all meshes have the same vertex format
+        mScene.reset(new aiScene());
+        mScene->mNumMeshes = NumMeshes;
+        mScene->mMeshes = new aiMesh *[NumMeshes];
+        for (unsigned int i = 0; i < NumMeshes; ++i) {
+            aiMesh *mesh = mScene->mMeshes[i] = new aiMesh();
+            mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+            mesh->mNumVertices = 3;
+            mesh->mVertices = new aiVector3D[3];
+            mesh->mNormals = new aiVector3D[3];
+            mesh->mTextureCoords[0] = new aiVector3D[3];
+            mesh->mNumUVComponents[0] = 2;
+            const ai_real offset = static_cast<ai_real>(i % NumUnique);
+            for (unsigned int v = 0; v < 3; ++v) {
+                mesh->mVertices[v] = aiVector3D(offset + (v & 1), offset + (v >> 1), offset);
+                mesh->mNormals[v] = aiVector3D(0, 0, 1);
+                mesh->mTextureCoords[0][v] = aiVector3D(static_cast<ai_real>(v & 1), static_cast<ai_real>(v >> 1), 0);
+            }
+            mesh->mNumFaces = 1;
+            mesh->mFaces = new aiFace[1];
+            mesh->mFaces[0].mNumIndices = 3;
+            mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+        }
+
+        mScene->mRootNode = new aiNode();
+        mScene->mRootNode->mNumMeshes = NumMeshes;
+        mScene->mRootNode->mMeshes = new unsigned int[NumMeshes];
+        for (unsigned int i = 0; i < NumMeshes; ++i) {
+            mScene->mRootNode->mMeshes[i] = i;
+        }
+    }
+
+    void CheckInstances() {
+        ASSERT_EQ(NumUnique, mScene->mNumMeshes);
+        for (unsigned int i = 0; i < NumUnique; ++i) {
+            EXPECT_EQ(static_cast<ai_real>(i), mScene->mMeshes[i]->mVertices[0].z);
+        }
+        for (unsigned int i = 0; i < NumMeshes; ++i) {
+            EXPECT_EQ(i % NumUnique, mScene->mRootNode->mMeshes[i]);
+        }
+    }
+
+    std::unique_ptr<aiScene> mScene;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, findInstances) {
+    FindInstancesProcess process;
+    process.Execute(mScene.get());
+    CheckInstances();
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(FindInstancesProcessTest, findInstancesWithContentHash) {
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_FI_CONTENT_HASH, true);
+
+    FindInstancesProcess process;
+    process.SetupProperties(&importer);
+    process.Execute(mScene.get());
+    CheckInstances();
+}
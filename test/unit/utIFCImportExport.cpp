@@ -41,7 +41,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
 
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 
 using namespace Assimp;
@@ -59,6 +61,68 @@ TEST_F(utIFCImportExport, importIFCFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+static unsigned int CountNodes(const aiNode *nd) {
+    unsigned int count = 1;
+    for (unsigned int i = 0; i < nd->mNumChildren; ++i) {
+        count += CountNodes(nd->mChildren[i]);
+    }
+    return count;
+}
+
+TEST_F(utIFCImportExport, importIFCGeometryInParallel) {
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    // the merged result must not depend on the number of threads
+    Assimp::Importer importers[2];
+    const aiScene *scenes[2] = {};
+    const int threads[2] = { 2, 4 };
+    for (int i = 0; i < 2; ++i) {
+        importers[i].SetPropertyInteger(AI_CONFIG_IMPORT_IFC_GEOMETRY_THREADS, threads[i]);
+        scenes[i] = importers[i].ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scenes[i]);
+        EXPECT_EQ(serial->mNumMeshes, scenes[i]->mNumMeshes);
+        EXPECT_EQ(serial->mNumMaterials, scenes[i]->mNumMaterials);
+        EXPECT_EQ(CountNodes(serial->mRootNode), CountNodes(scenes[i]->mRootNode));
+    }
+
+    ASSERT_EQ(scenes[0]->mNumMeshes, scenes[1]->mNumMeshes);
+    for (unsigned int i = 0; i < scenes[0]->mNumMeshes; ++i) {
+        const aiMesh *a = scenes[0]->mMeshes[i];
+        const aiMesh *b = scenes[1]->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        EXPECT_EQ(a->mNumFaces, b->mNumFaces);
+        EXPECT_EQ(a->mMaterialIndex, b->mMaterialIndex);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+        }
+    }
+}
+
+TEST_F(utIFCImportExport, importIFCParseInParallel) {
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_IFC_PARSE_THREADS, 4);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/IFC/AC14-FZK-Haus.ifc", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(serial->mNumMaterials, scene->mNumMaterials);
+    EXPECT_EQ(CountNodes(serial->mRootNode), CountNodes(scene->mRootNode));
+    ASSERT_EQ(serial->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < serial->mNumMeshes; ++i) {
+        const aiMesh *a = serial->mMeshes[i];
+        const aiMesh *b = scene->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        EXPECT_EQ(a->mNumFaces, b->mNumFaces);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+        }
+    }
+}
+
 TEST_F(utIFCImportExport, importComplextypeAsColor) {
     std::string asset =
             "ISO-10303-21;\n"
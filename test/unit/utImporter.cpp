@@ -46,6 +46,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
+#include <assimp/commonMetaData.h>
+#include <assimp/config.h>
+
+#include <filesystem>
+#include <fstream>
 
 using namespace ::std;
 using namespace ::Assimp;
@@ -181,6 +187,176 @@ TEST_F(ImporterTest, testMemoryRead) {
     EXPECT_EQ(12U, sc->mMeshes[0]->mNumFaces);
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCache) {
+    namespace fs = std::filesystem;
+    const fs::path directory = fs::temp_directory_path() / "assimp_import_cache_test";
+    fs::remove_all(directory);
+
+    auto readFile = [&](Importer &importer, unsigned int flags) {
+        importer.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, directory.string());
+        importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    };
+    auto hasRegion = [](const Importer &importer, const char *name) {
+        for (const Profiling::ProfileRegion &region : importer.GetProfile()->GetRegions()) {
+            if (region.name == name) {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto countEntries = [&]() {
+        return std::distance(fs::directory_iterator(directory), fs::directory_iterator());
+    };
+
+    Importer first;
+    const aiScene *imported = readFile(first, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, imported);
+    EXPECT_TRUE(hasRegion(first, "import"));
+    EXPECT_EQ(1, countEntries());
+
+    // the same file with the same settings is loaded from the cache
+    Importer second;
+    const aiScene *cached = readFile(second, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_FALSE(hasRegion(second, "import"));
+    EXPECT_TRUE(hasRegion(second, "cache"));
+    ASSERT_EQ(imported->mNumMeshes, cached->mNumMeshes);
+    EXPECT_EQ(imported->mNumMaterials, cached->mNumMaterials);
+    for (unsigned int i = 0; i < imported->mNumMeshes; ++i) {
+        ASSERT_EQ(imported->mMeshes[i]->mNumVertices, cached->mMeshes[i]->mNumVertices);
+        EXPECT_EQ(imported->mMeshes[i]->mNumFaces, cached->mMeshes[i]->mNumFaces);
+        for (unsigned int v = 0; v < imported->mMeshes[i]->mNumVertices; ++v) {
+            EXPECT_EQ(imported->mMeshes[i]->mVertices[v], cached->mMeshes[i]->mVertices[v]);
+        }
+    }
+
+    // other flags are a different entry
+    Importer third;
+    ASSERT_NE(nullptr, readFile(third, aiProcess_Triangulate));
+    EXPECT_TRUE(hasRegion(third, "import"));
+    EXPECT_EQ(2, countEntries());
+
+    // bounding boxes have no assbin chunk, such scenes are not cached
+    Importer fourth;
+    ASSERT_NE(nullptr, readFile(fourth, aiProcess_Triangulate | aiProcess_GenBoundingBoxes));
+    EXPECT_EQ(2, countEntries());
+    Importer fifth;
+    const aiScene *uncached = readFile(fifth, aiProcess_Triangulate | aiProcess_GenBoundingBoxes);
+    ASSERT_NE(nullptr, uncached);
+    EXPECT_TRUE(hasRegion(fifth, "import"));
+    EXPECT_NE(uncached->mMeshes[0]->mAABB.mMin, uncached->mMeshes[0]->mAABB.mMax);
+
+    fs::remove_all(directory);
+}
+
+// ------------------------------------------------------------------------------------------------
+static bool hasProfileRegion(const Importer &importer, const char *name) {
+    for (const Profiling::ProfileRegion &region : importer.GetProfile()->GetRegions()) {
+        if (region.name == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCacheChangedDependency) {
+    namespace fs = std::filesystem;
+    const fs::path directory = fs::temp_directory_path() / "assimp_import_cache_dependency_test";
+    fs::remove_all(directory);
+    fs::create_directories(directory / "model");
+
+    const fs::path obj = directory / "model" / "quad.obj";
+    auto writeFile = [](const fs::path &path, const char *text) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << text;
+    };
+    writeFile(obj, "mtllib quad.mtl\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nusemtl paint\nf 1 2 3 4\n");
+    writeFile(directory / "model" / "quad.mtl", "newmtl paint\nKd 1 0 0\n");
+
+    auto readFile = [&](Importer &importer) {
+        importer.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, (directory / "cache").string());
+        importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+        return importer.ReadFile(obj.string(), aiProcess_Triangulate);
+    };
+    auto diffuse = [](const aiScene *scene) {
+        aiColor3D color;
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            aiString name;
+            scene->mMaterials[i]->Get(AI_MATKEY_NAME, name);
+            if (name == aiString("paint")) {
+                scene->mMaterials[i]->Get(AI_MATKEY_COLOR_DIFFUSE, color);
+            }
+        }
+        return color;
+    };
+
+    Importer first;
+    ASSERT_NE(nullptr, readFile(first));
+    EXPECT_TRUE(hasProfileRegion(first, "import"));
+    Importer second;
+    const aiScene *cached = readFile(second);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_FALSE(hasProfileRegion(second, "import"));
+    EXPECT_EQ(aiColor3D(1, 0, 0), diffuse(cached));
+
+    // the material library is not part of the key, the entry records its hash
+    writeFile(directory / "model" / "quad.mtl", "newmtl paint\nKd 0 1 0\n");
+    Importer third;
+    const aiScene *changed = readFile(third);
+    ASSERT_NE(nullptr, changed);
+    EXPECT_TRUE(hasProfileRegion(third, "import"));
+    EXPECT_EQ(aiColor3D(0, 1, 0), diffuse(changed));
+
+    Importer fourth;
+    const aiScene *recached = readFile(fourth);
+    ASSERT_NE(nullptr, recached);
+    EXPECT_FALSE(hasProfileRegion(fourth, "import"));
+    EXPECT_EQ(aiColor3D(0, 1, 0), diffuse(recached));
+
+    fs::remove_all(directory);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCacheKeepsNamesAndMetadata) {
+    namespace fs = std::filesystem;
+    const fs::path directory = fs::temp_directory_path() / "assimp_import_cache_names_test";
+    fs::remove_all(directory);
+
+    auto readFile = [&](Importer &importer) {
+        importer.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, directory.string());
+        importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_Triangulate);
+    };
+
+    Importer first;
+    const aiScene *imported = readFile(first);
+    ASSERT_NE(nullptr, imported);
+    EXPECT_TRUE(hasProfileRegion(first, "import"));
+    Importer second;
+    const aiScene *cached = readFile(second);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_FALSE(hasProfileRegion(second, "import"));
+
+    EXPECT_EQ(imported->mName, cached->mName);
+    ASSERT_EQ(imported->mNumMeshes, cached->mNumMeshes);
+    for (unsigned int i = 0; i < imported->mNumMeshes; ++i) {
+        EXPECT_EQ(imported->mMeshes[i]->mName, cached->mMeshes[i]->mName);
+    }
+    ASSERT_NE(nullptr, imported->mMetaData);
+    ASSERT_NE(nullptr, cached->mMetaData);
+    ASSERT_EQ(imported->mMetaData->mNumProperties, cached->mMetaData->mNumProperties);
+    aiString generator;
+    ASSERT_TRUE(imported->mMetaData->Get(AI_METADATA_SOURCE_GENERATOR, generator));
+    aiString cachedGenerator;
+    ASSERT_TRUE(cached->mMetaData->Get(AI_METADATA_SOURCE_GENERATOR, cachedGenerator));
+    EXPECT_EQ(generator, cachedGenerator);
+
+    fs::remove_all(directory);
+}
+
 // ------------------------------------------------------------------------------------------------
 TEST_F(ImporterTest, testIntProperty) {
     bool b = pImp->SetPropertyInteger("quakquak", 1503);
@@ -0,0 +1,188 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/InterleaveVerticesProcess.h"
+#include <assimp/Importer.hpp>
+#include <assimp/SceneCombiner.h>
+#include <assimp/config.h>
+#include <assimp/mesh.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cstring>
+
+using namespace Assimp;
+
+class utInterleaveVerticesProcess : public ::testing::Test {
+public:
+    void SetUp() override {
+        mMesh.reset(new aiMesh());
+        mMesh->mNumVertices = 3;
+        mMesh->mVertices = new aiVector3D[3]{ { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 } };
+        mMesh->mNormals = new aiVector3D[3]{ { 0, 0, 1 }, { 0, 0, -1 }, { 1, 0, 0 } };
+        mMesh->mColors[0] = new aiColor4D[3]{ { 1, 0, 0, 1 }, { 0, 1, 0, 1 }, { 0, 0, 1, 0.5f } };
+        mMesh->mNumFaces = 1;
+        mMesh->mFaces = new aiFace[1];
+        mMesh->mFaces[0].mNumIndices = 3;
+        mMesh->mFaces[0].mIndices = new unsigned int[3]{ 2, 1, 0 };
+    }
+
+protected:
+    std::unique_ptr<aiMesh> mMesh;
+};
+
+TEST_F(utInterleaveVerticesProcess, parseFormatTest) {
+    std::vector<aiVertexAttribute> attributes;
+    unsigned int stride = 0;
+    EXPECT_TRUE(InterleaveVerticesProcess::ParseFormat("position:float3 normal:short3n texcoord1:float2 color0:ubyte4n", attributes, stride));
+    ASSERT_EQ(4u, attributes.size());
+    EXPECT_EQ(aiVertexAttributeSemantic_POSITION, attributes[0].mSemantic);
+    EXPECT_EQ(0u, attributes[0].mOffset);
+    EXPECT_EQ(aiVertexAttributeType_SHORT_NORM, attributes[1].mType);
+    EXPECT_EQ(12u, attributes[1].mOffset);
+    EXPECT_EQ(aiVertexAttributeSemantic_TEXCOORD, attributes[2].mSemantic);
+    EXPECT_EQ(1u, attributes[2].mIndex);
+    EXPECT_EQ(20u, attributes[2].mOffset);
+    EXPECT_EQ(28u, attributes[3].mOffset);
+    EXPECT_EQ(32u, stride);
+
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("", attributes, stride));
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("position", attributes, stride));
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("position:float5", attributes, stride));
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("position:ubyte3", attributes, stride));
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("weight:float1", attributes, stride));
+    EXPECT_FALSE(InterleaveVerticesProcess::ParseFormat("color8:ubyte4n", attributes, stride));
+}
+
+TEST_F(utInterleaveVerticesProcess, processMeshTest) {
+    std::vector<aiVertexAttribute> attributes;
+    unsigned int stride = 0;
+    ASSERT_TRUE(InterleaveVerticesProcess::ParseFormat("position:float3 normal:short3n color0:ubyte4n texcoord0:float2", attributes, stride));
+    InterleaveVerticesProcess::ProcessMesh(mMesh.get(), attributes, stride);
+
+    const aiVertexBuffer *buffer = mMesh->mVertexBuffer;
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(32u, buffer->mStride);
+    EXPECT_EQ(3u, buffer->mNumVertices);
+    ASSERT_EQ(3u, buffer->mNumIndices);
+    EXPECT_EQ(2u, buffer->mIndices[0]);
+    EXPECT_EQ(0u, buffer->mIndices[2]);
+
+    const unsigned char *vertex = buffer->mData + buffer->mStride;
+    float position[3];
+    ::memcpy(position, vertex, sizeof(position));
+    EXPECT_FLOAT_EQ(1.0f, position[0]);
+    EXPECT_FLOAT_EQ(0.0f, position[1]);
+
+    int16_t normal[3];
+    ::memcpy(normal, vertex + 12, sizeof(normal));
+    EXPECT_EQ(0, normal[0]);
+    EXPECT_EQ(-32767, normal[2]);
+
+    vertex = buffer->mData + 2 * buffer->mStride;
+    EXPECT_EQ(0, vertex[20]);
+    EXPECT_EQ(255, vertex[22]);
+    EXPECT_EQ(128, vertex[23]);
+
+    // the mesh has no texture coordinates, they are written as zeros
+    float texcoord[2];
+    ::memcpy(texcoord, vertex + 24, sizeof(texcoord));
+    EXPECT_FLOAT_EQ(0.0f, texcoord[0]);
+    EXPECT_FLOAT_EQ(0.0f, texcoord[1]);
+}
+
+TEST_F(utInterleaveVerticesProcess, copyMeshTest) {
+    std::vector<aiVertexAttribute> attributes;
+    unsigned int stride = 0;
+    ASSERT_TRUE(InterleaveVerticesProcess::ParseFormat("position:float3", attributes, stride));
+    InterleaveVerticesProcess::ProcessMesh(mMesh.get(), attributes, stride);
+
+    aiMesh *copy = nullptr;
+    SceneCombiner::Copy(&copy, mMesh.get());
+    ASSERT_NE(nullptr, copy);
+    ASSERT_NE(nullptr, copy->mVertexBuffer);
+    EXPECT_NE(mMesh->mVertexBuffer, copy->mVertexBuffer);
+    EXPECT_EQ(0, ::memcmp(mMesh->mVertexBuffer->mData, copy->mVertexBuffer->mData, 3 * stride));
+    delete copy;
+}
+
+TEST_F(utInterleaveVerticesProcess, importerTest) {
+    static const char ObjModel[] =
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "v 0 1 0\n"
+            "f 1 2 3 4\n";
+
+    Importer importer;
+    importer.SetPropertyString(AI_CONFIG_PP_IV_VERTEX_FORMAT, "position:float3 normal:float3");
+    const aiScene *scene = importer.ReadFileFromMemory(ObjModel, sizeof(ObjModel) - 1, aiProcess_Triangulate | aiProcess_GenNormals, "obj");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+
+    const aiMesh *mesh = scene->mMeshes[0];
+    const aiVertexBuffer *buffer = mesh->mVertexBuffer;
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(24u, buffer->mStride);
+    EXPECT_EQ(mesh->mNumVertices, buffer->mNumVertices);
+    EXPECT_EQ(mesh->mNumFaces * 3, buffer->mNumIndices);
+
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        float vertex[6];
+        ::memcpy(vertex, buffer->mData + i * buffer->mStride, sizeof(vertex));
+        EXPECT_FLOAT_EQ(mesh->mVertices[i].x, vertex[0]);
+        EXPECT_FLOAT_EQ(mesh->mVertices[i].y, vertex[1]);
+        EXPECT_FLOAT_EQ(mesh->mNormals[i].z, vertex[5]);
+    }
+}
+
+TEST_F(utInterleaveVerticesProcess, isActiveTest) {
+    Importer importer;
+    InterleaveVerticesProcess process;
+    process.SetupProperties(&importer);
+    EXPECT_FALSE(process.IsActive(0xffffffffu));
+
+    importer.SetPropertyString(AI_CONFIG_PP_IV_VERTEX_FORMAT, "position:float3");
+    process.SetupProperties(&importer);
+    EXPECT_TRUE(process.IsActive(0));
+}
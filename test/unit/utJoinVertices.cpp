@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 
 #include "PostProcessing/JoinVerticesProcess.h"
+#include "Common/ThreadPool.h"
 
 using namespace std;
 using namespace Assimp;
@@ -140,3 +141,48 @@ TEST_F(utJoinVertices, testProcess) {
     }
     EXPECT_EQ(150.f * 299.f * 3.f, fSum); // gaussian sum equation
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testProcessComparesAllPresentChannels) {
+    // +0 and -0 are identical, a differing second UV set is not
+    pcMesh->mVertices[300].x = -0.f;
+    pcMesh->mTextureCoords[1] = new aiVector3D[900];
+    for (unsigned int i = 0; i < 900; ++i) {
+        pcMesh->mTextureCoords[1][i] = aiVector3D(i < 600 ? 0.f : 1.f);
+    }
+    piProcess->ProcessMesh(pcMesh, 0);
+
+    ASSERT_EQ(300U, pcMesh->mNumFaces);
+    EXPECT_EQ(600U, pcMesh->mNumVertices);
+    EXPECT_EQ(pcMesh->mFaces[0].mIndices[0], pcMesh->mFaces[100].mIndices[0]);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testProcessPartitioned) {
+    // large enough to be split into several partitions
+    const unsigned int numUnique = 100000;
+    aiMesh *mesh = new aiMesh();
+    mesh->mNumVertices = numUnique * 2;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        const unsigned int a = i % numUnique;
+        mesh->mVertices[i] = aiVector3D((float)(a % 100), (float)(a / 100), 1.f);
+    }
+    mesh->mNumFaces = mesh->mNumVertices;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        mesh->mFaces[i].mIndices = new unsigned int[mesh->mFaces[i].mNumIndices = 1];
+        mesh->mFaces[i].mIndices[0] = i;
+    }
+
+    ThreadPool pool(4);
+    piProcess->SetThreadPool(&pool);
+    piProcess->ProcessMesh(mesh, 0);
+
+    ASSERT_EQ(numUnique, mesh->mNumVertices);
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        // unique vertices keep the order of their first occurrence
+        EXPECT_EQ(i % numUnique, mesh->mFaces[i].mIndices[0]);
+    }
+    delete mesh;
+}
@@ -279,6 +279,98 @@ TEST_F(MaterialSystemTest, testMaterialTextureTypeEnum) {
     EXPECT_EQ(maxTextureType, AI_TEXTURE_TYPE_MAX) << "AI_TEXTURE_TYPE_MAX macro must be equal to the largest valid aiTextureType_XXX";
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testManyProperties) {
+    // enough properties to be looked up through the hashed index
+    for (int i = 0; i < 100; ++i) {
+        this->pcMat->AddProperty(&i, 1, "testKey", i % 10, i / 10);
+    }
+    EXPECT_EQ(100u, this->pcMat->mNumProperties);
+
+    for (int i = 0; i < 100; ++i) {
+        int value = -1;
+        EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", i % 10, i / 10, value));
+        EXPECT_EQ(i, value);
+    }
+    int value = -1;
+    EXPECT_EQ(AI_FAILURE, this->pcMat->Get("testKey", 10, 0, value));
+    EXPECT_EQ(AI_FAILURE, this->pcMat->Get("testKe", 0, 0, value));
+
+    // overwriting keeps the number of properties
+    const int replaced = 1000;
+    this->pcMat->AddProperty(&replaced, 1, "testKey", 5, 5);
+    EXPECT_EQ(100u, this->pcMat->mNumProperties);
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 5, 5, value));
+    EXPECT_EQ(replaced, value);
+
+    // removing invalidates the index
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->RemoveProperty("testKey", 5, 5));
+    EXPECT_EQ(AI_FAILURE, this->pcMat->Get("testKey", 5, 5, value));
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 6, 5, value));
+    EXPECT_EQ(56, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertySwappedInPlace) {
+    for (int i = 0; i < 32; ++i) {
+        this->pcMat->AddProperty(&i, 1, "testKey", 0, i);
+    }
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 0, 7, value));
+
+    // importers replacing properties directly drop the index
+    aiMaterial other;
+    const int swapped = 42;
+    other.AddProperty(&swapped, 1, "otherKey", 0, 0);
+    std::swap(this->pcMat->mProperties[7], other.mProperties[0]);
+    InvalidateMaterialPropertyIndex(this->pcMat);
+    EXPECT_EQ(AI_FAILURE, this->pcMat->Get("testKey", 0, 7, value));
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("otherKey", 0, 0, value));
+    EXPECT_EQ(swapped, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertiesRemovedDirectly) {
+    for (int i = 0; i < 20; ++i) {
+        this->pcMat->AddProperty(&i, 1, "testKey", 0, i);
+    }
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 0, 19, value));
+
+    // drop below the indexed size like TextureTransform does, then grow again
+    while (this->pcMat->mNumProperties > 10) {
+        delete this->pcMat->mProperties[--this->pcMat->mNumProperties];
+    }
+    for (int i = 10; i < 20; ++i) {
+        this->pcMat->AddProperty(&i, 1, "newKey", 0, i);
+    }
+    EXPECT_EQ(AI_FAILURE, this->pcMat->Get("testKey", 0, 19, value));
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("newKey", 0, 19, value));
+    EXPECT_EQ(19, value);
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 0, 9, value));
+    EXPECT_EQ(9, value);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testReserveProperties) {
+    ReserveMaterialProperties(this->pcMat, 64);
+    EXPECT_EQ(64u, this->pcMat->mNumAllocated);
+    aiMaterialProperty **properties = this->pcMat->mProperties;
+    for (int i = 0; i < 64; ++i) {
+        this->pcMat->AddProperty(&i, 1, "testKey", 0, i);
+    }
+    EXPECT_EQ(properties, this->pcMat->mProperties);
+
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 0, 63, value));
+    EXPECT_EQ(63, value);
+
+    // growing keeps the properties and the index
+    ReserveMaterialProperties(this->pcMat, 128);
+    EXPECT_EQ(AI_SUCCESS, this->pcMat->Get("testKey", 0, 31, value));
+    EXPECT_EQ(31, value);
+}
+
 #if defined(_MSC_VER)
 __pragma (warning(pop))
 #endif
@@ -0,0 +1,120 @@
+/*-------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+-------------------------------------------------------------------------*/
+#include "UnitTestPCH.h"
+#include "UnitTestFileGenerator.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/MemoryMappedIOSystem.h>
+#include <assimp/scene.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+using namespace ::Assimp;
+
+class utMemoryMappedIOSystem : public ::testing::Test {
+    // empty
+};
+
+static const char mappedData[]{"Lorem ipsum dolor sit amet, consectetur adipiscing elit."};
+
+TEST_F(utMemoryMappedIOSystem, readMappedFileTest) {
+    char fpath[] = { TMP_PATH "mmapfp.XXXXXX" };
+    FILE *fs = MakeTmpFile(fpath);
+    ASSERT_NE(nullptr, fs);
+    EXPECT_EQ(sizeof(mappedData), std::fwrite(mappedData, 1, sizeof(mappedData), fs));
+    std::fclose(fs);
+
+    MemoryMappedIOSystem io;
+    IOStream *stream = io.Open(fpath, "rb");
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(sizeof(mappedData), stream->FileSize());
+    ASSERT_NE(nullptr, stream->GetMappedData());
+    EXPECT_EQ(0, memcmp(mappedData, stream->GetMappedData(), sizeof(mappedData)));
+
+    char buffer[6] = {};
+    EXPECT_EQ(AI_SUCCESS, stream->Seek(6, aiOrigin_SET));
+    EXPECT_EQ(1u, stream->Read(buffer, 5, 1));
+    EXPECT_EQ(0, strncmp("ipsum", buffer, 5));
+    EXPECT_EQ(11u, stream->Tell());
+    EXPECT_EQ(AI_FAILURE, stream->Seek(sizeof(mappedData) + 1, aiOrigin_SET));
+    io.Close(stream);
+
+    // writers are served by the default implementation
+    stream = io.Open(fpath, "wb");
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(nullptr, stream->GetMappedData());
+    io.Close(stream);
+
+    std::remove(fpath);
+}
+
+TEST_F(utMemoryMappedIOSystem, missingFileTest) {
+    MemoryMappedIOSystem io;
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/does_not_exist.fbx", "rb"));
+}
+
+static void compareImport(const char *file) {
+    Importer reference;
+    const aiScene *expected = reference.ReadFile(file, 0);
+    ASSERT_NE(nullptr, expected);
+
+    Importer mapped;
+    mapped.SetIOHandler(new MemoryMappedIOSystem);
+    const aiScene *actual = mapped.ReadFile(file, 0);
+    ASSERT_NE(nullptr, actual);
+
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        ASSERT_EQ(expected->mMeshes[i]->mNumVertices, actual->mMeshes[i]->mNumVertices);
+        EXPECT_EQ(0, memcmp(expected->mMeshes[i]->mVertices, actual->mMeshes[i]->mVertices,
+                             expected->mMeshes[i]->mNumVertices * sizeof(aiVector3D)));
+    }
+}
+
+TEST_F(utMemoryMappedIOSystem, importBinaryFBXTest) {
+    compareImport(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utMemoryMappedIOSystem, importGLBTest) {
+    compareImport(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb");
+}
@@ -46,6 +46,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/config.h>
+
+#include <sstream>
 
 using namespace Assimp;
 
@@ -539,3 +542,53 @@ TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     // The MTL file is in `folder`, the image path should have been prefixed with the folder
     EXPECT_STREQ("folder/image.jpg", texturePath.C_Str());
 }
+
+TEST_F(utObjImportExport, parallel_parse_matches_serial) {
+    // large enough to be split into several chunks, with state changes
+    // and relative indices all over the file
+    std::ostringstream obj;
+    for (int group = 0; group < 40; ++group) {
+        obj << "g group" << group % 7 << "\n";
+        obj << "usemtl material" << group % 3 << "\n";
+        for (int i = 0; i < 400; ++i) {
+            obj << "v " << i * 0.25 << " " << group << " -" << i << ".125";
+            if (group % 5 == 0) {
+                obj << " 0.5 0.25 1";
+            }
+            obj << "\nvt " << i / 400.0 << " 0.5\nvn 0 0 1\n";
+            if (i % 4 == 3) {
+                obj << "f -4/-4/-4 -3/-3/-3 \\\n -2/-2/-2 -1/-1/-1\n";
+            }
+        }
+        obj << "# comment\nf 1/1 2/2 3/3\n";
+    }
+    const std::string text = obj.str();
+
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFileFromMemory(text.c_str(), text.size(), aiProcess_ValidateDataStructure, "obj");
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_OBJ_PARSE_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFileFromMemory(text.c_str(), text.size(), aiProcess_ValidateDataStructure, "obj");
+    ASSERT_NE(nullptr, parallel);
+
+    ASSERT_EQ(serial->mNumMeshes, parallel->mNumMeshes);
+    EXPECT_EQ(serial->mNumMaterials, parallel->mNumMaterials);
+    for (unsigned int m = 0; m < serial->mNumMeshes; ++m) {
+        const aiMesh *a = serial->mMeshes[m];
+        const aiMesh *b = parallel->mMeshes[m];
+        EXPECT_STREQ(a->mName.C_Str(), b->mName.C_Str());
+        EXPECT_EQ(a->mMaterialIndex, b->mMaterialIndex);
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        EXPECT_EQ(a->HasVertexColors(0), b->HasVertexColors(0));
+        for (unsigned int i = 0; i < a->mNumVertices; ++i) {
+            EXPECT_EQ(a->mVertices[i], b->mVertices[i]);
+            EXPECT_EQ(a->mTextureCoords[0][i], b->mTextureCoords[0][i]);
+            if (a->HasVertexColors(0)) {
+                EXPECT_EQ(a->mColors[0][i], b->mColors[0][i]);
+            }
+        }
+    }
+}
@@ -45,6 +45,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
 
 using namespace Assimp;
 
@@ -73,3 +74,24 @@ TEST_F(utOpenGEXImportExport, Importissue1340_EmptyCameraObject) {
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OpenGEX/empty_camera.ogex", 0);
     EXPECT_NE(nullptr, scene);
 }
+
+TEST_F(utOpenGEXImportExport, importVertexColorsForEveryVertex) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OpenGEX/animation_example.ogex", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    // the index array expands 80 colors to 156 vertices
+    const aiMesh *mesh = nullptr;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        if (scene->mMeshes[i]->HasVertexColors(0)) {
+            mesh = scene->mMeshes[i];
+        }
+    }
+    ASSERT_NE(nullptr, mesh);
+    EXPECT_EQ(156u, mesh->mNumVertices);
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        EXPECT_EQ(1.0f, mesh->mColors[0][i].r);
+        EXPECT_EQ(1.0f, mesh->mColors[0][i].g);
+        EXPECT_EQ(1.0f, mesh->mColors[0][i].b);
+    }
+}
@@ -261,3 +261,78 @@ TEST_F(utPLYImportExport, parseInvalidDoubleCustomProperty) {
     const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+// Builds a binary file with colored vertices and a single quad, the records are
+// written byte by byte so the result doesn't depend on the host byte order
+static std::string buildBinaryPLY(bool bigEndian, unsigned int numVertices) {
+    std::string out = std::string("ply\nformat ") + (bigEndian ? "binary_big_endian" : "binary_little_endian") + " 1.0\n"
+            "element vertex " + std::to_string(numVertices) + "\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property short nx\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+
+    auto append = [&](uint64_t value, unsigned int size) {
+        for (unsigned int i = 0; i < size; ++i) {
+            const unsigned int shift = 8 * (bigEndian ? size - 1 - i : i);
+            out.push_back(static_cast<char>((value >> shift) & 0xff));
+        }
+    };
+    auto appendFloat = [&](float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        append(bits, 4);
+    };
+
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        appendFloat(static_cast<float>(i));
+        appendFloat(static_cast<float>(i) * 0.5f);
+        appendFloat(-static_cast<float>(i));
+        append(i % 256, 1);
+        append(255, 1);
+        append(0, 1);
+        append(static_cast<uint16_t>(-static_cast<int16_t>(i % 100)), 2);
+    }
+    append(4, 1);
+    for (unsigned int index : { 0u, 1u, 2u, numVertices - 1 }) {
+        append(index, 4);
+    }
+    return out;
+}
+
+TEST_F(utPLYImportExport, importBinaryPLYBothByteOrders) {
+    // enough vertices to span several read blocks
+    const unsigned int numVertices = 100000;
+    for (bool bigEndian : { false, true }) {
+        const std::string data = buildBinaryPLY(bigEndian, numVertices);
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), aiProcess_ValidateDataStructure, "ply");
+        ASSERT_NE(nullptr, scene);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_NE(nullptr, mesh);
+        ASSERT_EQ(numVertices, mesh->mNumVertices);
+        ASSERT_TRUE(mesh->HasVertexColors(0));
+
+        for (unsigned int i : { 0u, 1u, 77777u, numVertices - 1 }) {
+            EXPECT_FLOAT_EQ(static_cast<float>(i), mesh->mVertices[i].x);
+            EXPECT_FLOAT_EQ(static_cast<float>(i) * 0.5f, mesh->mVertices[i].y);
+            EXPECT_FLOAT_EQ(-static_cast<float>(i), mesh->mVertices[i].z);
+            EXPECT_FLOAT_EQ((i % 256) / 255.0f, mesh->mColors[0][i].r);
+            EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][i].g);
+            EXPECT_FLOAT_EQ(0.0f, mesh->mColors[0][i].b);
+            EXPECT_FLOAT_EQ(1.0f, mesh->mColors[0][i].a);
+            EXPECT_FLOAT_EQ(-static_cast<float>(i % 100), mesh->mNormals[i].x);
+        }
+
+        ASSERT_EQ(1u, mesh->mNumFaces);
+        ASSERT_EQ(4u, mesh->mFaces[0].mNumIndices);
+        EXPECT_EQ(2u, mesh->mFaces[0].mIndices[2]);
+        EXPECT_EQ(numVertices - 1, mesh->mFaces[0].mIndices[3]);
+    }
+}
@@ -44,6 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UTLogStream.h"
 #include <assimp/Profiler.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/config.h>
 
 using namespace ::Assimp;
 using namespace ::Assimp::Profiling;
@@ -75,3 +78,55 @@ TEST_F( utProfiler, addRegion_success ) {
     //UTLogStream *stream( (UTLogStream*) m_stream );
     //EXPECT_FALSE( stream->m_messages.empty() );
 }
+
+TEST_F( utProfiler, nestedRegions_recordHierarchy ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "outer" );
+    myProfiler.BeginRegion( "inner" );
+    myProfiler.AddBytesRead( 42 );
+    myProfiler.EndRegion( "inner" );
+    myProfiler.EndRegion( "outer" );
+
+    const std::vector<ProfileRegion> &regions = myProfiler.GetRegions();
+    ASSERT_EQ( 2u, regions.size() );
+    EXPECT_EQ( "outer", regions[0].name );
+    EXPECT_EQ( ProfileRegion::NoParent, regions[0].parent );
+    EXPECT_EQ( "inner", regions[1].name );
+    EXPECT_EQ( 0u, regions[1].parent );
+    EXPECT_EQ( 1u, regions[1].depth );
+    EXPECT_EQ( 42u, regions[0].bytesRead );
+    EXPECT_EQ( 42u, regions[1].bytesRead );
+    EXPECT_GE( regions[0].duration, regions[1].duration );
+
+    const std::string json = myProfiler.ToJson();
+    EXPECT_NE( std::string::npos, json.find( "\"outer\"" ) );
+    EXPECT_NE( std::string::npos, json.find( "\"inner\"" ) );
+    const std::string trace = myProfiler.ToChromeTrace();
+    EXPECT_NE( std::string::npos, trace.find( "\"ph\":\"X\"" ) );
+
+    myProfiler.Clear();
+    EXPECT_TRUE( myProfiler.GetRegions().empty() );
+}
+
+TEST_F( utProfiler, importerProfile_success ) {
+    Importer importer;
+    EXPECT_EQ( nullptr, importer.GetProfile() );
+    importer.SetPropertyBool( AI_CONFIG_GLOB_MEASURE_TIME, true );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_Triangulate );
+    ASSERT_NE( nullptr, scene );
+
+    const Profiler *profile = importer.GetProfile();
+    ASSERT_NE( nullptr, profile );
+    const std::vector<ProfileRegion> &regions = profile->GetRegions();
+    ASSERT_FALSE( regions.empty() );
+    EXPECT_EQ( "total", regions[0].name );
+    EXPECT_GT( regions[0].bytesRead, 0u );
+
+    bool hasParse = false, hasTriangulate = false;
+    for ( const ProfileRegion &region : regions ) {
+        hasParse = hasParse || region.name == "parse";
+        hasTriangulate = hasTriangulate || region.name == "aiProcess_Triangulate";
+    }
+    EXPECT_TRUE( hasParse );
+    EXPECT_TRUE( hasTriangulate );
+}
@@ -0,0 +1,159 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include "AssetLib/STEPParser/STEPFileReader.h"
+
+#include <assimp/MemoryIOWrapper.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+namespace {
+
+const char *const StepHeader =
+        "ISO-10303-21;\n"
+        "HEADER;\n"
+        "FILE_SCHEMA(('TEST'));\n"
+        "ENDSEC;\n"
+        "DATA;\n";
+
+const char *const StepFooter =
+        "ENDSEC;\n"
+        "END-ISO-10303-21;\n";
+
+const STEP::EXPRESS::ConversionSchema::SchemaEntry SchemaEntries[] = {
+    STEP::EXPRESS::ConversionSchema::SchemaEntry("ifcdummy", nullptr)
+};
+
+// Tokenizes a STEP file held in memory, the records are not evaluated
+STEP::DB *ReadStep(const std::string &text, unsigned int threads) {
+    static const STEP::EXPRESS::ConversionSchema schema(SchemaEntries);
+    std::shared_ptr<IOStream> stream = std::make_shared<MemoryIOStream>(
+            reinterpret_cast<const uint8_t *>(text.data()), text.size());
+    std::unique_ptr<STEP::DB> db(STEP::ReadFileHeader(stream));
+    STEP::ReadFile(*db, schema, nullptr, 0, nullptr, 0, threads);
+    return db.release();
+}
+
+// Returns the warnings logged while tokenizing a STEP file held in memory
+std::vector<std::string> ReadStepWarnings(const std::string &text, unsigned int threads, size_t &numObjects) {
+    struct WarningObserver : LogStream {
+        std::vector<std::string> m_warnings;
+        void write(const char *message) override {
+            m_warnings.emplace_back(message);
+        }
+    };
+    WarningObserver observer;
+
+    DefaultLogger::get()->attachStream(&observer, Logger::Warn);
+    std::unique_ptr<STEP::DB> db(ReadStep(text, threads));
+    DefaultLogger::get()->detachStream(&observer, Logger::Warn);
+    numObjects = db->GetObjectCount();
+    return observer.m_warnings;
+}
+
+} // namespace
+
+TEST(utSTEPFileReader, outlierIdsStayReachable) {
+    // #5000 is far beyond the object count when it is read, the ids read later
+    // grow the dense table past it
+    std::string text = StepHeader;
+    text += "#5000=IFCDUMMY('outlier');\n";
+    for (unsigned int id = 1; id <= 6000; ++id) {
+        if (id != 5000) {
+            text += "#" + std::to_string(id) + "=IFCDUMMY('x');\n";
+        }
+    }
+    text += StepFooter;
+
+    std::unique_ptr<STEP::DB> db(ReadStep(text, 1));
+    ASSERT_EQ(6000u, db->GetObjectCount());
+    for (uint64_t id = 1; id <= 6000; ++id) {
+        const STEP::LazyObject *object = db->GetObject(id);
+        ASSERT_NE(nullptr, object) << id;
+        EXPECT_EQ(id, object->GetID());
+    }
+    EXPECT_EQ(nullptr, db->GetObject(6001));
+}
+
+TEST(utSTEPFileReader, parallelWarningLinesMatchSerial) {
+    // big enough for several chunks, with blank lines, CRLF line ends, tabs,
+    // records spanning lines and broken records spread over all of them
+    std::string text = StepHeader;
+    for (unsigned int id = 1; id <= 40000; ++id) {
+        const std::string record = "#" + std::to_string(id) + "=IFCDUMMY('some padding for the record');";
+        if (id % 97 == 0) {
+            text += "\n \n";
+        }
+        if (id % 107 == 0) {
+            text += "\t\n";
+        }
+        if (id % 101 == 0) {
+            text += "   ";
+        }
+        if (id % 103 == 0) {
+            text += "\t";
+        }
+        if (id % 109 == 0) {
+            text += "#" + std::to_string(id) + "=IFCDUMMY(\n'some',\n'padding');\n";
+        } else if (id % 113 == 0) {
+            text += "#" + std::to_string(id) + " IFCDUMMY('missing assignment');\n";
+        } else if (id % 127 == 0) {
+            text += "#" + std::to_string(id - 1) + "=IFCDUMMY('duplicate');\n";
+        } else {
+            text += record + (id % 89 == 0 ? "\r\n" : "\n");
+        }
+    }
+    text += StepFooter;
+    ASSERT_GT(text.size(), 1024u * 1024u);
+
+    size_t serialObjects = 0, parallelObjects = 0;
+    const std::vector<std::string> serial = ReadStepWarnings(text, 1, serialObjects);
+    const std::vector<std::string> parallel = ReadStepWarnings(text, 4, parallelObjects);
+    EXPECT_FALSE(serial.empty());
+    EXPECT_EQ(serial, parallel);
+    EXPECT_EQ(serialObjects, parallelObjects);
+}
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
 #include <vector>
 
 using namespace Assimp;
@@ -83,6 +84,36 @@ TEST_F(utSTLImporterExporter, importSTLformatdetection) {
     EXPECT_NE(nullptr, scene);
 }
 
+TEST_F(utSTLImporterExporter, importBinaryWeldedTest) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+
+    Assimp::Importer weldingImporter;
+    weldingImporter.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, true);
+    const aiScene *welded = weldingImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, welded);
+    ASSERT_EQ(1u, welded->mNumMeshes);
+    const aiMesh *weldedMesh = welded->mMeshes[0];
+
+    // same facets, but shared vertices
+    ASSERT_EQ(mesh->mNumFaces, weldedMesh->mNumFaces);
+    EXPECT_LT(weldedMesh->mNumVertices, mesh->mNumVertices);
+    EXPECT_FALSE(weldedMesh->HasNormals());
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        ASSERT_EQ(3u, weldedMesh->mFaces[i].mNumIndices);
+        for (unsigned int j = 0; j < 3; ++j) {
+            EXPECT_EQ(mesh->mVertices[mesh->mFaces[i].mIndices[j]], weldedMesh->mVertices[weldedMesh->mFaces[i].mIndices[j]]);
+        }
+    }
+
+    // no two vertices are left with the same position
+    std::vector<aiVector3D> positions(weldedMesh->mVertices, weldedMesh->mVertices + weldedMesh->mNumVertices);
+    std::sort(positions.begin(), positions.end());
+    EXPECT_EQ(positions.end(), std::adjacent_find(positions.begin(), positions.end()));
+}
+
 TEST_F(utSTLImporterExporter, test_with_two_solids) {
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/triangle_with_two_solids.stl", aiProcess_ValidateDataStructure);
@@ -727,6 +727,123 @@ TEST_F(utglTF2ImportExport, export_normalized_normals) {
     }
 }
 
+TEST_F(utglTF2ImportExport, export_quantized_meshopt) {
+    Assimp::Importer reference;
+    const aiScene *expected = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(expected, nullptr);
+
+    Assimp::Importer importer;
+    Assimp::Exporter exporter;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_QUANTIZE_ATTRIBUTES, true);
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, true);
+    const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured_meshopt_out.gltf",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured_meshopt_out.glb"
+    };
+    EXPECT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "gltf2", files[0], 0, &properties));
+    EXPECT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", files[1], 0, &properties));
+
+    // the compression is lossless, only the quantized attributes differ slightly
+    for (const char *file : files) {
+        Assimp::Importer roundTrip;
+        const aiScene *actual = roundTrip.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(actual, nullptr) << file;
+        ASSERT_EQ(actual->mNumMeshes, expected->mNumMeshes);
+        for (unsigned int m = 0; m < actual->mNumMeshes; ++m) {
+            const aiMesh *a = actual->mMeshes[m];
+            const aiMesh *e = expected->mMeshes[m];
+            ASSERT_EQ(a->mNumVertices, e->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, e->mNumFaces);
+            ASSERT_TRUE(a->HasNormals());
+            ASSERT_TRUE(a->HasTextureCoords(0));
+            for (unsigned int i = 0; i < a->mNumVertices; ++i) {
+                EXPECT_EQ(a->mVertices[i], e->mVertices[i]);
+                EXPECT_NEAR((a->mNormals[i] - e->mNormals[i]).Length(), 0, 1e-3);
+                EXPECT_NEAR((a->mTextureCoords[0][i] - e->mTextureCoords[0][i]).Length(), 0, 1e-3);
+            }
+
+            // triangles may be rotated by the index codec
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                const aiFace &fa = a->mFaces[f];
+                const aiFace &fe = e->mFaces[f];
+                ASSERT_EQ(fa.mNumIndices, 3u);
+                ASSERT_EQ(fe.mNumIndices, 3u);
+                unsigned int rotation = 0;
+                while (rotation < 3 && fa.mIndices[rotation] != fe.mIndices[0]) {
+                    ++rotation;
+                }
+                ASSERT_LT(rotation, 3u);
+                EXPECT_EQ(fa.mIndices[(rotation + 1) % 3], fe.mIndices[1]);
+                EXPECT_EQ(fa.mIndices[(rotation + 2) % 3], fe.mIndices[2]);
+            }
+        }
+    }
+}
+
+TEST_F(utglTF2ImportExport, import_meshopt_fixture) {
+    // the buffer views were encoded by hand from the EXT_meshopt_compression specification,
+    // not by the exporter: the positions use 2, 4 and 8 bit delta groups, the normals the
+    // octahedral filter and the indices a codeaux table entry followed by an edge fifo hit
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/meshopt/MeshoptQuad.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+    ASSERT_EQ(scene->mNumMeshes, 1u);
+    const aiMesh *mesh = scene->mMeshes[0];
+
+    const aiVector3D positions[] = { aiVector3D(0, 0, 0), aiVector3D(1, 0, 0), aiVector3D(1, 1, 0), aiVector3D(0, 1, 0) };
+    const aiVector3D normals[] = { aiVector3D(0, 0, 1), aiVector3D(1, 0, 0), aiVector3D(0, 1, 0), aiVector3D(0, 0, 1) };
+    ASSERT_EQ(mesh->mNumVertices, 4u);
+    ASSERT_TRUE(mesh->HasNormals());
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        EXPECT_EQ(mesh->mVertices[i], positions[i]);
+        EXPECT_NEAR((mesh->mNormals[i] - normals[i]).Length(), 0, 1e-6);
+    }
+
+    const unsigned int indices[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+    ASSERT_EQ(mesh->mNumFaces, 2u);
+    for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+        ASSERT_EQ(mesh->mFaces[f].mNumIndices, 3u);
+        for (unsigned int i = 0; i < 3; ++i) {
+            EXPECT_EQ(mesh->mFaces[f].mIndices[i], indices[f][i]);
+        }
+    }
+}
+
+TEST_F(utglTF2ImportExport, export_streamed_glb) {
+    const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/simple_skin/simple_skin.gltf",
+        ASSIMP_TEST_MODELS_DIR "/glTF2/AnimatedMorphCube/glTF/AnimatedMorphCube.gltf"
+    };
+
+    Assimp::ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_STREAM_BINARY, true);
+
+    // the streamed file has to match the one built in memory byte by byte
+    for (const char *file : files) {
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(scene, nullptr) << file;
+
+        Assimp::Exporter exporter;
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "glb2");
+        ASSERT_NE(blob, nullptr) << file;
+        const std::vector<uint8_t> expected(static_cast<const uint8_t *>(blob->data),
+                static_cast<const uint8_t *>(blob->data) + blob->size);
+
+        blob = exporter.ExportToBlob(scene, "glb2", 0, &properties);
+        ASSERT_NE(blob, nullptr) << file;
+        const std::vector<uint8_t> actual(static_cast<const uint8_t *>(blob->data),
+                static_cast<const uint8_t *>(blob->data) + blob->size);
+        EXPECT_EQ(expected, actual) << file;
+    }
+}
+
 #endif // ASSIMP_BUILD_NO_EXPORT
 
 TEST_F(utglTF2ImportExport, sceneMetadata) {
@@ -865,6 +982,37 @@ TEST_F(utglTF2ImportExport, allIndicesOutOfRange) {
     ASSERT_NE(error.find("Mesh \"Mesh\" has no faces"), std::string::npos);
 }
 
+TEST_F(utglTF2ImportExport, vertexRemapping) {
+    // The first primitive uses all vertices in order, the second one a subset in reverse order
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/VertexRemapping/VertexRemapping.gltf", aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+    ASSERT_EQ(scene->mNumMeshes, 2u);
+
+    const aiVector3D positions[] = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 } };
+    const aiVector3D tangents[] = { { 1, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, 1, 0 } };
+    const aiVector3D bitangents[] = { { 0, 1, 0 }, { 0, -1, 0 }, { -1, 0, 0 }, { 1, 0, 0 } };
+    const aiColor4D colors[] = { { 1, 0, 0, 1 }, { 0, 1, 0, 1 }, { 0, 0, 1, 1 }, { 1, 1, 1, 0 } };
+    const unsigned int sourceIndices[2][4] = { { 0, 1, 2, 3 }, { 3, 2, 1, 0 } };
+    const unsigned int numVertices[2] = { 4, 3 };
+
+    for (unsigned int m = 0; m < 2; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        ASSERT_EQ(mesh->mNumVertices, numVertices[m]);
+        ASSERT_TRUE(mesh->HasTangentsAndBitangents());
+        ASSERT_TRUE(mesh->HasVertexColors(0));
+        ASSERT_EQ(mesh->mNumAnimMeshes, 1u);
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            const unsigned int src = sourceIndices[m][i];
+            EXPECT_EQ(mesh->mVertices[i], positions[src]);
+            EXPECT_EQ(mesh->mTangents[i], tangents[src]);
+            EXPECT_EQ(mesh->mBitangents[i], bitangents[src]);
+            EXPECT_EQ(mesh->mColors[0][i], colors[src]);
+            EXPECT_EQ(mesh->mAnimMeshes[0]->mVertices[i], positions[src] + aiVector3D(0, 0, static_cast<ai_real>(src + 1)));
+        }
+    }
+}
+
 /////////////////////////////////
 // Draco decoding
 